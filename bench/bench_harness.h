@@ -0,0 +1,220 @@
+/*
+ * 统一基准测试框架（C / C++ 通用，仅头文件）
+ *
+ * 计时：单调时钟（CLOCK_MONOTONIC / QueryPerformanceCounter）测墙钟时间，rdtsc 测周期数。
+ * 每个用例先运行一次标定：单次耗时不足 sample_ns 的小消息在一个样本内重复多次，
+ * 避免计时开销淹没结果；随后预热 warmup 个样本，再按 budget_ns 采样（不少于 BENCH_MIN_REPS、
+ * 不多于 max_reps 个），报告 min/p50/p90/p99/max 与 cycles/byte 中位数。
+ *
+ * 输出为 JSON：
+ *   {"suite":..., "simd":..., "timer":..., "tsc_ghz":..., "results":[
+ *     {"op":..., "backend":..., "bytes":..., "items":..., "iters":..., "reps":...,
+ *      "ns":{"min","p50","p90","p99","max"}, "cpb":{"p50","p90"}, "gbps":..., "ops_per_sec":...}, ...]}
+ * bytes 为单条消息长度，items 为一次操作处理的消息（或证明）数，吞吐按 bytes*items 计算；
+ * bytes 为 0 的用例（如证明生成）cpb、gbps 输出 null。
+ *
+ * 以 -DCRYPTO_INSTRUMENT 编译时（见 instrument.h），每个结果另含采样区间内每次操作的
+ * "hw"（instructions / cycles / l1d_misses，perf 不可用时为 null）与 "prims"（各原语的调用数、字节数、周期数），
+ * 结尾附 "primitives" 总表，并把可读的总表打印到 stderr。
+ */
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "instrument.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <windows.h>
+#else
+#include <time.h>
+#include <x86intrin.h>
+#endif
+
+#define BENCH_MIN_REPS 3
+#define BENCH_MAX_REPS 63
+
+typedef void (*bench_fn)(void* ctx);
+
+typedef struct {
+    FILE* out;
+    int results;        /* 已输出的结果数 */
+    int warmup;         /* 正式采样前的预热样本数 */
+    int max_reps;       /* 每个用例最多采样数，不超过 BENCH_MAX_REPS */
+    double sample_ns;   /* 每个样本的最短时长 */
+    double budget_ns;   /* 每个用例的采样时间预算 */
+} bench_report;
+
+static inline uint64_t bench_cycles(void) {
+    return __rdtsc();
+}
+
+static inline uint64_t bench_now_ns(void) {
+#if defined(_MSC_VER)
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER t;
+    if (freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&t);
+    return (uint64_t)((double)t.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/* "4096"、"64K"、"16M"、"1G"；无后缀按 MiB，与各程序原有的 bench <MiB> 参数一致 */
+static inline size_t bench_parse_size(const char* s) {
+    char* end = NULL;
+    double v = strtod(s, &end);
+    switch (end && *end ? *end : 'M') {
+    case 'b': case 'B': return (size_t)v;
+    case 'k': case 'K': return (size_t)(v * 1024.0);
+    case 'g': case 'G': return (size_t)(v * 1024.0 * 1024.0 * 1024.0);
+    default:            return (size_t)(v * 1024.0 * 1024.0);
+    }
+}
+
+/* 消息长度序列：16 B 起每次乘 4，直到 max（16, 64, 256, ..., 256M, 1G） */
+static inline size_t bench_next_size(size_t bytes) {
+    return bytes * 4;
+}
+
+static inline int bench_cmp_double(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+/* 最近秩百分位，v 已升序 */
+static inline double bench_percentile(const double* v, int n, double q) {
+    int k = (int)ceil(q * n) - 1;
+    if (k < 0) k = 0;
+    if (k >= n) k = n - 1;
+    return v[k];
+}
+
+/* 以单调时钟为基准估计 TSC 频率，便于把 cycles 换算回时间 */
+static inline double bench_tsc_ghz(void) {
+    uint64_t t0 = bench_now_ns(), c0 = bench_cycles(), t1, c1;
+    do {
+        t1 = bench_now_ns();
+        c1 = bench_cycles();
+    } while (t1 - t0 < 20000000ull);
+    return (double)(c1 - c0) / (double)(t1 - t0);
+}
+
+static inline void bench_begin(bench_report* r, FILE* out, const char* suite, const char* simd) {
+    r->out = out;
+    r->results = 0;
+    r->warmup = 2;
+    r->max_reps = 31;
+    r->sample_ns = 1e6;
+    r->budget_ns = 5e8;
+    fprintf(out, "{\"suite\":\"%s\",\"simd\":\"%s\",\"timer\":\"%s\",\"tsc_ghz\":%.3f,\"results\":[\n",
+            suite, simd,
+#if defined(_MSC_VER)
+            "QueryPerformanceCounter",
+#else
+            "CLOCK_MONOTONIC",
+#endif
+            bench_tsc_ghz());
+}
+
+static inline void bench_end(bench_report* r) {
+#if defined(CRYPTO_INSTRUMENT)
+    instr_counter total[INSTR_COUNT];
+    instr_snapshot(total);
+    fprintf(r->out, "%s],\"primitives\":", r->results ? "\n" : "");
+    instr_write_json(r->out, NULL, total, 1.0);
+    fprintf(r->out, "}\n");
+    instr_dump(stderr);
+#else
+    fprintf(r->out, "%s]}\n", r->results ? "\n" : "");
+#endif
+    fflush(r->out);
+}
+
+static inline void bench_case(bench_report* r, const char* op, const char* backend,
+                              size_t bytes, size_t items, bench_fn fn, void* ctx) {
+    double ns[BENCH_MAX_REPS], cpb[BENCH_MAX_REPS];
+    uint64_t t0, t1, c0, c1, iters = 1, i;
+    int reps, k, warmup = r->warmup;
+    double once, total = (double)bytes * (double)items;
+
+    /* 标定：冷启动的一次同时充当第一次预热 */
+    t0 = bench_now_ns();
+    fn(ctx);
+    once = (double)(bench_now_ns() - t0);
+    if (once < 1.0) once = 1.0;
+    if (once < r->sample_ns) iters = (uint64_t)ceil(r->sample_ns / once);
+    else if (once * iters > r->budget_ns / BENCH_MIN_REPS) warmup = 0;
+
+    reps = (int)(r->budget_ns / (once * (double)iters));
+    if (reps > r->max_reps) reps = r->max_reps;
+    if (reps > BENCH_MAX_REPS) reps = BENCH_MAX_REPS;
+    if (reps < BENCH_MIN_REPS) reps = BENCH_MIN_REPS;
+
+    for (k = 0; k < warmup; k++) {
+        for (i = 0; i < iters; i++) fn(ctx);
+    }
+#if defined(CRYPTO_INSTRUMENT)
+    instr_counter before[INSTR_COUNT], after[INSTR_COUNT];
+    instr_hw hw;
+    instr_snapshot(before);
+    instr_hw_begin(&hw);
+#endif
+    for (k = 0; k < reps; k++) {
+        t0 = bench_now_ns();
+        c0 = bench_cycles();
+        for (i = 0; i < iters; i++) fn(ctx);
+        c1 = bench_cycles();
+        t1 = bench_now_ns();
+        ns[k] = (double)(t1 - t0) / (double)iters;
+        cpb[k] = total > 0 ? (double)(c1 - c0) / ((double)iters * total) : 0.0;
+    }
+#if defined(CRYPTO_INSTRUMENT)
+    instr_hw_end(&hw);
+    instr_snapshot(after);
+#endif
+    qsort(ns, (size_t)reps, sizeof(double), bench_cmp_double);
+    qsort(cpb, (size_t)reps, sizeof(double), bench_cmp_double);
+
+    double p50 = bench_percentile(ns, reps, 0.50);
+    fprintf(r->out,
+            "%s  {\"op\":\"%s\",\"backend\":\"%s\",\"bytes\":%llu,\"items\":%llu,\"iters\":%llu,\"reps\":%d,"
+            "\"ns\":{\"min\":%.1f,\"p50\":%.1f,\"p90\":%.1f,\"p99\":%.1f,\"max\":%.1f},",
+            r->results ? ",\n" : "", op, backend, (unsigned long long)bytes, (unsigned long long)items,
+            (unsigned long long)iters, reps, ns[0], p50, bench_percentile(ns, reps, 0.90),
+            bench_percentile(ns, reps, 0.99), ns[reps - 1]);
+    if (total > 0) {
+        fprintf(r->out, "\"cpb\":{\"p50\":%.3f,\"p90\":%.3f},\"gbps\":%.4f,",
+                bench_percentile(cpb, reps, 0.50), bench_percentile(cpb, reps, 0.90), total / p50);
+    }
+    else {
+        fprintf(r->out, "\"cpb\":null,\"gbps\":null,");
+    }
+    fprintf(r->out, "\"ops_per_sec\":%.1f", (double)items * 1e9 / p50);
+#if defined(CRYPTO_INSTRUMENT)
+    double ops = (double)reps * (double)iters;
+    if (hw.valid) {
+        fprintf(r->out, ",\"hw\":{\"instructions\":%.1f,\"cycles\":%.1f,\"l1d_misses\":%.1f}",
+                (double)hw.v[INSTR_HW_INSTRUCTIONS] / ops, (double)hw.v[INSTR_HW_CYCLES] / ops,
+                (double)hw.v[INSTR_HW_L1D_MISSES] / ops);
+    }
+    else {
+        fprintf(r->out, ",\"hw\":null");
+    }
+    fprintf(r->out, ",\"prims\":");
+    instr_write_json(r->out, before, after, ops);
+#endif
+    fprintf(r->out, "}");
+    fflush(r->out);
+    r->results++;
+}
+
+#endif /* BENCH_HARNESS_H */
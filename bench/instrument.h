@@ -0,0 +1,204 @@
+/*
+ * 热路径插桩（C / C++ 通用，仅头文件）
+ *
+ * 以 -DCRYPTO_INSTRUMENT 编译时，每个原语记录调用次数、处理字节数与 rdtsc 周期数，
+ * bench_harness.h 在每个基准用例前后取快照，把差值按每次操作折算后写入 JSON，并在结尾输出总表；
+ * Linux 下另用 perf_event_open 在基准区间内读取退休指令数、核心周期与 L1D 读缺失。
+ * 未定义 CRYPTO_INSTRUMENT 时所有宏展开为空，不产生任何代码。
+ *
+ * 周期为包含式：嵌套原语（如 GCM 内的 GHASH、Merkle 层内的 SM3 压缩）各自完整计入。
+ * 计数器以 relaxed 原子加累积，可在线程池中使用；硬件计数器只统计调用线程。
+ * Linux 下用到 syscall()，C 源文件须在包含任何系统头之前定义 _GNU_SOURCE（C++ 编译器默认已定义）。
+ */
+#ifndef CRYPTO_INSTRUMENT_H
+#define CRYPTO_INSTRUMENT_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+enum instr_prim {
+    INSTR_KEY_SCHEDULE,     /* SM4 密钥扩展 */
+    INSTR_ECB_BATCH,        /* SM4 多块并行加密核心（AVX2 8 块 / AVX-512 16 块） */
+    INSTR_CTR,              /* SM4-CTR 驱动 */
+    INSTR_GCM,              /* SM4-GCM 加密并生成标签 */
+    INSTR_GHASH_BLOCK,      /* GHASH 单块乘法 */
+    INSTR_SM3_COMPRESS,     /* SM3 单流压缩 */
+    INSTR_SM3_MB_COMPRESS,  /* SM3 多缓冲压缩（每通道一块） */
+    INSTR_MERKLE_LEVEL,     /* Merkle 整层哈希 */
+    INSTR_COUNT
+};
+
+#if defined(CRYPTO_INSTRUMENT)
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+static const char* const instr_names[INSTR_COUNT] = {
+    "key_schedule", "ecb_batch", "ctr", "gcm", "ghash_block", "sm3_compress", "sm3_mb_compress", "merkle_level"
+};
+
+typedef struct {
+    uint64_t calls, bytes, cycles;
+} instr_counter;
+
+static instr_counter instr_counters[INSTR_COUNT];
+
+static inline void instr_atomic_add(uint64_t* p, uint64_t v) {
+#if defined(_MSC_VER)
+    _InterlockedExchangeAdd64((volatile long long*)p, (long long)v);
+#else
+    __atomic_fetch_add(p, v, __ATOMIC_RELAXED);
+#endif
+}
+
+static inline uint64_t instr_atomic_load(const uint64_t* p) {
+#if defined(_MSC_VER)
+    return *(const volatile uint64_t*)p;
+#else
+    return __atomic_load_n(p, __ATOMIC_RELAXED);
+#endif
+}
+
+static inline void instr_add(int prim, uint64_t bytes, uint64_t cycles) {
+    instr_atomic_add(&instr_counters[prim].calls, 1);
+    instr_atomic_add(&instr_counters[prim].bytes, bytes);
+    instr_atomic_add(&instr_counters[prim].cycles, cycles);
+}
+
+static inline void instr_snapshot(instr_counter out[INSTR_COUNT]) {
+    for (int i = 0; i < INSTR_COUNT; i++) {
+        out[i].calls = instr_atomic_load(&instr_counters[i].calls);
+        out[i].bytes = instr_atomic_load(&instr_counters[i].bytes);
+        out[i].cycles = instr_atomic_load(&instr_counters[i].cycles);
+    }
+}
+
+/* 两次快照之差除以 per（通常为操作次数），只输出有调用的原语 */
+static inline void instr_write_json(FILE* out, const instr_counter* before, const instr_counter* after, double per) {
+    int first = 1;
+    fprintf(out, "{");
+    for (int i = 0; i < INSTR_COUNT; i++) {
+        uint64_t calls = after[i].calls - (before ? before[i].calls : 0);
+        if (calls == 0) continue;
+        uint64_t bytes = after[i].bytes - (before ? before[i].bytes : 0);
+        uint64_t cycles = after[i].cycles - (before ? before[i].cycles : 0);
+        fprintf(out, "%s\"%s\":{\"calls\":%.2f,\"bytes\":%.1f,\"cycles\":%.1f}", first ? "" : ",", instr_names[i],
+                (double)calls / per, (double)bytes / per, (double)cycles / per);
+        first = 0;
+    }
+    fprintf(out, "}");
+}
+
+static inline void instr_dump(FILE* out) {
+    instr_counter now[INSTR_COUNT];
+    instr_snapshot(now);
+    fprintf(out, "%-16s %14s %16s %18s %12s %12s\n", "primitive", "calls", "bytes", "cycles", "cyc/call",
+            "cyc/byte");
+    for (int i = 0; i < INSTR_COUNT; i++) {
+        if (now[i].calls == 0) continue;
+        fprintf(out, "%-16s %14llu %16llu %18llu %12.1f %12.3f\n", instr_names[i], (unsigned long long)now[i].calls,
+                (unsigned long long)now[i].bytes, (unsigned long long)now[i].cycles,
+                (double)now[i].cycles / (double)now[i].calls,
+                now[i].bytes ? (double)now[i].cycles / (double)now[i].bytes : 0.0);
+    }
+}
+
+/* ---------------- 硬件计数器 (perf_event_open) ---------------- */
+
+enum { INSTR_HW_INSTRUCTIONS, INSTR_HW_CYCLES, INSTR_HW_L1D_MISSES, INSTR_HW_COUNT };
+
+typedef struct {
+    int valid;
+    uint64_t v[INSTR_HW_COUNT];
+} instr_hw;
+
+#if defined(__linux__)
+/* 以指令数为组长打开一组计数器，只统计本线程的用户态；不可用（容器、perf_event_paranoid）时 leader 为 -1 */
+static struct {
+    int opened;
+    int fd[INSTR_HW_COUNT];
+} instr_perf = { 0, { -1, -1, -1 } };
+
+static inline int instr_perf_open(uint32_t type, uint64_t config, int group) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = group < 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+static inline void instr_perf_init(void) {
+    if (instr_perf.opened) return;
+    instr_perf.opened = 1;
+    int leader = instr_perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, -1);
+    if (leader < 0) return;
+    int cyc = instr_perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, leader);
+    int l1d = instr_perf_open(PERF_TYPE_HW_CACHE,
+                              PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), leader);
+    if (cyc < 0 || l1d < 0) {
+        if (cyc >= 0) close(cyc);
+        if (l1d >= 0) close(l1d);
+        close(leader);
+        return;
+    }
+    instr_perf.fd[INSTR_HW_INSTRUCTIONS] = leader;
+    instr_perf.fd[INSTR_HW_CYCLES] = cyc;
+    instr_perf.fd[INSTR_HW_L1D_MISSES] = l1d;
+}
+#endif
+
+static inline void instr_hw_begin(instr_hw* h) {
+    memset(h, 0, sizeof(*h));
+#if defined(__linux__)
+    instr_perf_init();
+    int leader = instr_perf.fd[INSTR_HW_INSTRUCTIONS];
+    if (leader < 0) return;
+    ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    h->valid = 1;
+#endif
+}
+
+static inline void instr_hw_end(instr_hw* h) {
+#if defined(__linux__)
+    if (!h->valid) return;
+    int leader = instr_perf.fd[INSTR_HW_INSTRUCTIONS];
+    ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    uint64_t buf[1 + INSTR_HW_COUNT];
+    if (read(leader, buf, sizeof(buf)) != (ssize_t)sizeof(buf) || buf[0] != INSTR_HW_COUNT) {
+        h->valid = 0;
+        return;
+    }
+    for (int i = 0; i < INSTR_HW_COUNT; i++) h->v[i] = buf[1 + i];
+#else
+    (void)h;
+#endif
+}
+
+#define INSTR_BEGIN(t) uint64_t t = __rdtsc()
+#define INSTR_END(prim, t, bytes) instr_add((prim), (uint64_t)(bytes), __rdtsc() - (t))
+
+#else
+
+#define INSTR_BEGIN(t)
+#define INSTR_END(prim, t, bytes) ((void)(bytes))
+
+#endif /* CRYPTO_INSTRUMENT */
+
+#endif /* CRYPTO_INSTRUMENT_H */
@@ -1,8 +1,9 @@
+#define _GNU_SOURCE    /* bench/instrument.h 的 syscall 与 bench_harness.h 的 clock_gettime 在 -std=c11 下也需要声明 */
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
-#include <time.h>
+#include "../bench/bench_harness.h"
 
 static inline uint32_t rotl32(uint32_t x, int n){ return (x<<n) | (x>>(32-n)); }
 static inline uint32_t rotr32(uint32_t x, int n){ return (x>>n) | (x<<(32-n)); }
@@ -72,9 +73,9 @@ static void sm4_build_Ttables(void){
         uint32_t x = ((uint32_t)s) << 24;       
         uint32_t t = L32(x);
         T0[b] = t;
-        T1[b] = rotl32(t, 8);
+        T1[b] = rotr32(t, 8);
         T2[b] = rotl32(t,16);
-        T3[b] = rotl32(t,24);
+        T3[b] = rotr32(t,24);
     }
 }
 
@@ -96,6 +97,7 @@ static inline uint32_t Lp32(uint32_t x){ // L'
 typedef struct { uint32_t rk[32]; uint32_t drk[32]; } sm4_key_t;
 
 static void sm4_key_schedule(sm4_key_t* ks, const uint8_t key[16]){
+    INSTR_BEGIN(t0);
     uint32_t K[4];
     K[0] = load_be32(key+0) ^ FK[0];
     K[1] = load_be32(key+4) ^ FK[1];
@@ -112,6 +114,7 @@ static void sm4_key_schedule(sm4_key_t* ks, const uint8_t key[16]){
     }
 
     for(int i=0;i<32;i++) ks->drk[i] = ks->rk[31-i];
+    INSTR_END(INSTR_KEY_SCHEDULE, t0, 16);
 }
 
 // ---------------------------- 单块加/解密（T-table） ----------------------------
@@ -149,14 +152,8 @@ static inline void inc_be128(uint8_t ctr[16]){
     for(int i=15;i>=0;--i){ if(++ctr[i]) break; }
 }
 
-void sm4_ctr_encrypt_tt(const sm4_key_t* ks,
-                        const uint8_t iv[16],
-                        const uint8_t* in,
-                        uint8_t* out,
-                        size_t len){
-    uint8_t ctr[16]; memcpy(ctr, iv, 16);
-
-
+// 标量 CTR 主体，ctr 原地递增；不计入插桩，SIMD 驱动处理尾部时也调用它，避免同一次调用计两次
+static void sm4_ctr_scalar(const sm4_key_t* ks, uint8_t ctr[16], const uint8_t* in, uint8_t* out, size_t len){
     while(len >= 16*8){
         uint8_t keystream[16*8];
         uint8_t ctmp[16];
@@ -183,82 +180,23 @@ void sm4_ctr_encrypt_tt(const sm4_key_t* ks,
     }
 }
 
-
-
-static int selftest(){
-    static const uint8_t key[16] = {
-        0x01,0x23,0x45,0x67,0x89,0xab,0xcd,0xef,0xfe,0xdc,0xba,0x98,0x76,0x54,0x32,0x10
-    };
-    static const uint8_t pt[16] = {
-        0x01,0x23,0x45,0x67,0x89,0xab,0xcd,0xef,0xfe,0xdc,0xba,0x98,0x76,0x54,0x32,0x10
-    };
-    static const uint8_t ct_ref[16] = {
-        0x68,0x1e,0xdf,0x34,0xd2,0x06,0x96,0x5e,0x86,0xb3,0xe9,0x4f,0x53,0x6e,0x42,0x46
-    };
-
-    sm4_build_Ttables();
-    sm4_key_t ks; sm4_key_schedule(&ks, key);
-
-    uint8_t ct[16]; sm4_encrypt_block_tt(&ks, pt, ct);
-    if(memcmp(ct, ct_ref, 16)!=0){
-        fprintf(stderr, "[FAIL] encrypt mismatched!\n");
-        return 0;
-    }
-    uint8_t rt[16]; sm4_decrypt_block_tt(&ks, ct, rt);
-    if(memcmp(rt, pt, 16)!=0){
-        fprintf(stderr, "[FAIL] decrypt mismatched!\n");
-        return 0;
-    }
-    fprintf(stdout, "[OK] SM4 T-table selftest passed.\n");
-    return 1;
+void sm4_ctr_encrypt_tt(const sm4_key_t* ks,
+                        const uint8_t iv[16],
+                        const uint8_t* in,
+                        uint8_t* out,
+                        size_t len){
+    INSTR_BEGIN(t0);
+    uint8_t ctr[16]; memcpy(ctr, iv, 16);
+    sm4_ctr_scalar(ks, ctr, in, out, len);
+    INSTR_END(INSTR_CTR, t0, len);
 }
 
-
-static void* xmalloc(size_t n){ void* p = malloc(n); if(!p){perror("malloc"); exit(1);} return p; }
-
-static void bench_ctr(size_t bytes){
-    uint8_t key[16]={0}; uint8_t iv[16]={0};
-    for(int i=0;i<16;i++){ key[i]=i; iv[i]=0xA0+i; }
-
-    sm4_build_Ttables();
-    sm4_key_t ks; sm4_key_schedule(&ks, key);
-
-    uint8_t* in  = (uint8_t*)xmalloc(bytes);
-    uint8_t* out = (uint8_t*)xmalloc(bytes);
-    for(size_t i=0;i<bytes;i++) in[i]=(uint8_t)i;
-
-    const int rounds = 3;
-    double best_gbps = 0.0;
-
-    for(int r=0;r<rounds;r++){
-        uint8_t iv_local[16]; memcpy(iv_local, iv, 16);
-        clock_t t0 = clock();
-        sm4_ctr_encrypt_tt(&ks, iv_local, in, out, bytes);
-        clock_t t1 = clock();
-        double secs = (double)(t1-t0)/CLOCKS_PER_SEC;
-        double gbps = (double)bytes / secs / 1e9;
-        if(gbps>best_gbps) best_gbps = gbps;
-    }
-    printf("CTR throughput: %.2f GB/s (best of %d)\n", best_gbps, rounds);
-    free(in); free(out);
+// len 须为 16 的整数倍
+void sm4_ecb_encrypt_tt(const sm4_key_t* ks, const uint8_t* in, uint8_t* out, size_t len){
+    for(size_t off=0; off+16<=len; off+=16) sm4_encrypt_block_tt(ks, in+off, out+off);
 }
 
-// ---------------------------- main函数 ----------------------------
 
-int main(int argc, char** argv){
-    if(argc==1){
-        return selftest()?0:1;
-    }
-    if(argc>=2 && strcmp(argv[1],"bench")==0){
-        size_t bytes = 256*1024*1024ull; 
-        if(argc>=3){ bytes = (size_t)atof(argv[2]) * 1024.0 * 1024.0; }
-        printf("Benchmarking SM4-CTR T-table on %zu bytes...\n", bytes);
-        bench_ctr(bytes);
-        return 0;
-    }
-    fprintf(stderr, "Usage: %s [bench <MiB>]\n", argv[0]);
-    return 0;
-}
 
 
 // ============================ AVX2 / AVX-512 版本（T-table + gather）============================
@@ -290,6 +228,7 @@ static inline __m256i sm4_round_tt_vec8(__m256i t){
 static inline void sm4_encrypt8_ecb_tt_avx2(const sm4_key_t* ks,
                                             const uint8_t in[8][16],
                                             uint8_t out[8][16]){
+    INSTR_BEGIN(t0);
     __m256i X0, X1, X2, X3;
     uint32_t x0[8],x1[8],x2[8],x3[8];
     for(int i=0;i<8;i++){
@@ -316,12 +255,15 @@ static inline void sm4_encrypt8_ecb_tt_avx2(const sm4_key_t* ks,
         store_be32(out[i]+0, x0[i]); store_be32(out[i]+4, x1[i]);
         store_be32(out[i]+8, x2[i]); store_be32(out[i]+12,x3[i]);
     }
+    INSTR_END(INSTR_ECB_BATCH, t0, 8*16);
 }
 
 void sm4_ctr_encrypt_tt_avx2(const sm4_key_t* ks,
                              const uint8_t iv[16],
                              const uint8_t* in, uint8_t* out, size_t len){
+    INSTR_BEGIN(t0);
     uint8_t ctr[16]; memcpy(ctr, iv, 16);
+    const size_t total = len;
 
 
     while(len >= 16*8){
@@ -332,11 +274,19 @@ void sm4_ctr_encrypt_tt_avx2(const sm4_key_t* ks,
             inc_be128(ctr);
         }
         sm4_encrypt8_ecb_tt_avx2(ks, inblk, ksblk);
-        for(int i=0;i<8*16;i++) out[i] = in[i] ^ ksblk[0][i];
+        for(int i=0;i<8*16;i++) out[i] = in[i] ^ ksblk[i/16][i%16];
         in += 128; out += 128; len -= 128;
     }
+    if(len) sm4_ctr_scalar(ks, ctr, in, out, len);
+    INSTR_END(INSTR_CTR, t0, total);
+}
 
-    if(len) sm4_ctr_encrypt_tt(ks, ctr, in, out, len);
+void sm4_ecb_encrypt_tt_avx2(const sm4_key_t* ks, const uint8_t* in, uint8_t* out, size_t len){
+    while(len >= 16*8){
+        sm4_encrypt8_ecb_tt_avx2(ks, (const uint8_t (*)[16])in, (uint8_t (*)[16])out);
+        in += 128; out += 128; len -= 128;
+    }
+    sm4_ecb_encrypt_tt(ks, in, out, len);
 }
 #endif // __AVX2__
 
@@ -366,6 +316,7 @@ static inline __m512i sm4_round_tt_vec16(__m512i t){
 static inline void sm4_encrypt16_ecb_tt_avx512(const sm4_key_t* ks,
                                                const uint8_t in[16][16],
                                                uint8_t out[16][16]){
+    INSTR_BEGIN(t0);
     __m512i X0, X1, X2, X3;
     uint32_t x0[16],x1[16],x2[16],x3[16];
     for(int i=0;i<16;i++){
@@ -393,12 +344,15 @@ static inline void sm4_encrypt16_ecb_tt_avx512(const sm4_key_t* ks,
         store_be32(out[i]+0, x0[i]); store_be32(out[i]+4, x1[i]);
         store_be32(out[i]+8, x2[i]); store_be32(out[i]+12,x3[i]);
     }
+    INSTR_END(INSTR_ECB_BATCH, t0, 16*16);
 }
 
 void sm4_ctr_encrypt_tt_avx512(const sm4_key_t* ks,
                                const uint8_t iv[16],
                                const uint8_t* in, uint8_t* out, size_t len){
+    INSTR_BEGIN(t0);
     uint8_t ctr[16]; memcpy(ctr, iv, 16);
+    const size_t total = len;
 
     while(len >= 16*16){
         uint8_t inblk[16][16];
@@ -408,10 +362,633 @@ void sm4_ctr_encrypt_tt_avx512(const sm4_key_t* ks,
             inc_be128(ctr);
         }
         sm4_encrypt16_ecb_tt_avx512(ks, inblk, ksblk);
-        for(int i=0;i<16*16;i++) out[i] = in[i] ^ ksblk[0][i];
+        for(int i=0;i<16*16;i++) out[i] = in[i] ^ ksblk[i/16][i%16];
+        in += 256; out += 256; len -= 256;
+    }
+    if(len) sm4_ctr_scalar(ks, ctr, in, out, len);
+    INSTR_END(INSTR_CTR, t0, total);
+}
+
+void sm4_ecb_encrypt_tt_avx512(const sm4_key_t* ks, const uint8_t* in, uint8_t* out, size_t len){
+    while(len >= 16*16){
+        sm4_encrypt16_ecb_tt_avx512(ks, (const uint8_t (*)[16])in, (uint8_t (*)[16])out);
         in += 256; out += 256; len -= 256;
     }
-    if(len) sm4_ctr_encrypt_tt(ks, ctr, in, out, len);
+    sm4_ecb_encrypt_tt(ks, in, out, len);
 }
 #endif // __AVX512F__
 
+static void* xmalloc(size_t n){ void* p = malloc(n); if(!p){perror("malloc"); exit(1);} return p; }
+
+// ============================ 异步任务队列（pthread）============================
+// 多个线程各自同步加密大量短消息时，每条消息只有几个分组，凑不满 8/16 路并行核心。
+// 任务按提交线程分配到各工作线程的队列；工作线程取出同一密钥的任务，把所有分组
+// （ECB 为明文分组，CTR 为各自的计数器分组）排成 SM4_JOB_LANES 路一批送入并行核心，
+// 分组不足一批时从队首任务入队起最多等待 max_delay，超时按不满的批次执行。
+// 自身队列为空的工作线程从其他队列尾部窃取一半。任务结构由调用者持有。
+// 提交只在队列由空变非空（开始计时）或刚凑满一批时唤醒工作线程，其余情况由工作线程在等待到期时看到；
+// 空闲工作线程只为窃取而定期醒来。等待任务的线程从自己提交到的队列取批次代为执行，
+// 提交线程多于核数时省去唤醒工作线程的上下文切换。销毁队列时先执行完已提交的任务。
+// project4/SM3.cpp 的 Sm3JobQueue 沿用同一套调度规则。
+#if !defined(_WIN32)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#if defined(__AVX512F__)
+#define SM4_JOB_LANES 16
+#elif defined(__AVX2__)
+#define SM4_JOB_LANES 8
+#else
+#define SM4_JOB_LANES 1
+#endif
+#define SM4_JOB_MAX_BATCH 64    // 一次取出的任务数上限
+
+enum { SM4_JOB_ECB, SM4_JOB_CTR };
+
+typedef struct sm4_job {
+    int kind;                   // SM4_JOB_ECB（len 须为 16 的整数倍，否则提交被拒绝）/ SM4_JOB_CTR
+    const sm4_key_t* ks;        // 同一 ks 指针的任务才会合批
+    uint8_t iv[16];             // CTR 初始计数器
+    const uint8_t* in;          // in / out 完成前须保持有效，可以相同
+    uint8_t* out;
+    size_t len;
+    // 设置了回调的任务完成时在工作线程上调用回调，否则置完成标志供轮询
+    void (*callback)(struct sm4_job*);
+    void* user;
+    int done;
+    uint64_t submitted_ns;
+} sm4_job;
+
+typedef struct {
+    pthread_mutex_t mtx;
+    pthread_cond_t cv;
+    sm4_job** jobs;             // 按提交顺序排列
+    size_t count, cap;
+    size_t blocks;              // 队列中的分组总数
+    pthread_t th;
+} sm4_worker;
+
+typedef struct {
+    sm4_worker* workers;
+    int n;
+    uint64_t max_delay_ns;
+    int stop;
+} sm4_job_queue;
+
+// 回调示例：完成时给 user 指向的计数器加一
+static void sm4_job_count_done(sm4_job* j){ __atomic_fetch_add((int*)j->user, 1, __ATOMIC_RELEASE); }
+
+static inline size_t sm4_job_blocks(const sm4_job* j){ return (j->len + 15) / 16; }
+
+static inline int sm4_job_ready(const sm4_job* j){ return __atomic_load_n(&j->done, __ATOMIC_ACQUIRE); }
+
+static inline void sm4_job_wait(const sm4_job* j){
+    while(!sm4_job_ready(j)) sched_yield();
+}
+
+// 把一批分组送入并行核心：ECB 直接写出密文，CTR 用密钥流与输入异或（最后一块可不满 16 字节）
+typedef struct { const uint8_t* in; uint8_t* out; size_t n; int ctr; } sm4_lane;
+
+static void sm4_lanes_flush(const sm4_key_t* ks, uint8_t blk[SM4_JOB_LANES][16],
+                            const sm4_lane* lane, int n){
+    uint8_t ksout[SM4_JOB_LANES][16];
+#if defined(__AVX512F__) || defined(__AVX2__)
+    // 不满一批时未用的通道清零，gather 核心不会以未初始化字节作为查表下标
+    if(n > 2 && n < SM4_JOB_LANES) memset(blk[n], 0, (size_t)(SM4_JOB_LANES - n) * 16);
+#endif
+#if defined(__AVX512F__)
+    if(n > 2) sm4_encrypt16_ecb_tt_avx512(ks, (const uint8_t (*)[16])blk, ksout);
+    else for(int i=0;i<n;i++) sm4_encrypt_block_tt(ks, blk[i], ksout[i]);
+#elif defined(__AVX2__)
+    if(n > 2) sm4_encrypt8_ecb_tt_avx2(ks, (const uint8_t (*)[16])blk, ksout);
+    else for(int i=0;i<n;i++) sm4_encrypt_block_tt(ks, blk[i], ksout[i]);
+#else
+    for(int i=0;i<n;i++) sm4_encrypt_block_tt(ks, blk[i], ksout[i]);
+#endif
+    for(int i=0;i<n;i++){
+        if(lane[i].ctr) for(size_t k=0;k<lane[i].n;k++) lane[i].out[k] = lane[i].in[k] ^ ksout[i][k];
+        else memcpy(lane[i].out, ksout[i], 16);
+    }
+}
+
+// batch 中的任务密钥相同；ECB 与 CTR 共用同一加密核心，可混在一批
+static void sm4_jobs_execute(sm4_job** batch, size_t m){
+    const sm4_key_t* ks = batch[0]->ks;
+    uint8_t blk[SM4_JOB_LANES][16];
+    sm4_lane lane[SM4_JOB_LANES];
+    int n = 0;
+    for(size_t j=0;j<m;j++){
+        sm4_job* job = batch[j];
+        uint8_t ctr[16];
+        memcpy(ctr, job->iv, 16);
+        for(size_t off=0; off<job->len; off+=16){
+            lane[n].in = job->in + off;
+            lane[n].out = job->out + off;
+            lane[n].n = job->len - off < 16 ? job->len - off : 16;
+            lane[n].ctr = job->kind == SM4_JOB_CTR;
+            if(lane[n].ctr){ memcpy(blk[n], ctr, 16); inc_be128(ctr); }
+            else memcpy(blk[n], job->in + off, 16);
+            if(++n == SM4_JOB_LANES){ sm4_lanes_flush(ks, blk, lane, n); n = 0; }
+        }
+    }
+    if(n) sm4_lanes_flush(ks, blk, lane, n);
+    for(size_t j=0;j<m;j++){
+        if(batch[j]->callback) batch[j]->callback(batch[j]);
+        else __atomic_store_n(&batch[j]->done, 1, __ATOMIC_RELEASE);
+    }
+}
+
+static void sm4_worker_push(sm4_worker* w, sm4_job* const* jobs, size_t n){
+    if(w->count + n > w->cap){
+        size_t cap = w->cap ? w->cap : 64;
+        while(cap < w->count + n) cap *= 2;
+        sm4_job** p = (sm4_job**)realloc(w->jobs, cap * sizeof(*p));
+        if(!p){ perror("realloc"); exit(1); }
+        w->jobs = p; w->cap = cap;
+    }
+    for(size_t i=0;i<n;i++){
+        w->jobs[w->count++] = jobs[i];
+        w->blocks += sm4_job_blocks(jobs[i]);
+    }
+}
+
+// 取出与队首同密钥的任务（至多 SM4_JOB_MAX_BATCH 个），其余保持原顺序
+static size_t sm4_worker_take(sm4_worker* w, sm4_job** batch){
+    const sm4_key_t* ks = w->jobs[0]->ks;
+    size_t n = 0, keep = 0;
+    for(size_t i=0;i<w->count;i++){
+        sm4_job* j = w->jobs[i];
+        if(j->ks == ks && n < SM4_JOB_MAX_BATCH){
+            batch[n++] = j;
+            w->blocks -= sm4_job_blocks(j);
+        }
+        else w->jobs[keep++] = j;
+    }
+    w->count = keep;
+    return n;
+}
+
+// 从其他队列尾部窃取一半；对方队首已到期时全部接手（对方正在执行，零散任务不必再等）
+static size_t sm4_worker_steal(sm4_job_queue* q, int self, sm4_job** into, size_t cap){
+    for(int k=1;k<q->n;k++){
+        sm4_worker* v = &q->workers[(self + k) % q->n];
+        pthread_mutex_lock(&v->mtx);
+        size_t n = v->count / 2;
+        if(n == 0 && v->count && bench_now_ns() >= v->jobs[0]->submitted_ns + q->max_delay_ns) n = v->count;
+        if(n > cap) n = cap;
+        for(size_t i=0;i<n;i++){
+            into[i] = v->jobs[v->count - n + i];
+            v->blocks -= sm4_job_blocks(into[i]);
+        }
+        v->count -= n;
+        pthread_mutex_unlock(&v->mtx);
+        if(n) return n;
+    }
+    return 0;
+}
+
+static void sm4_cond_wait_ns(sm4_worker* w, uint64_t ns){
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    uint64_t t = (uint64_t)tv.tv_sec * 1000000000ull + (uint64_t)tv.tv_usec * 1000ull + ns;
+    struct timespec ts = { (time_t)(t / 1000000000ull), (long)(t % 1000000000ull) };
+    pthread_cond_timedwait(&w->cv, &w->mtx, &ts);
+}
+
+typedef struct { sm4_job_queue* q; int self; } sm4_worker_arg;
+
+static void* sm4_worker_run(void* p){
+    sm4_worker_arg a = *(sm4_worker_arg*)p;
+    free(p);
+    sm4_job_queue* q = a.q;
+    sm4_worker* w = &q->workers[a.self];
+    sm4_job* batch[SM4_JOB_MAX_BATCH];
+    for(;;){
+        size_t n = 0;
+        pthread_mutex_lock(&w->mtx);
+        for(;;){
+            if(w->count){
+                uint64_t now = bench_now_ns(), deadline = w->jobs[0]->submitted_ns + q->max_delay_ns;
+                if(w->blocks >= SM4_JOB_LANES || __atomic_load_n(&q->stop, __ATOMIC_ACQUIRE) || now >= deadline){
+                    n = sm4_worker_take(w, batch);
+                    break;
+                }
+                sm4_cond_wait_ns(w, deadline - now);
+                continue;
+            }
+            if(__atomic_load_n(&q->stop, __ATOMIC_ACQUIRE)){
+                pthread_mutex_unlock(&w->mtx);
+                return NULL;
+            }
+            pthread_mutex_unlock(&w->mtx);
+            n = sm4_worker_steal(q, a.self, batch, SM4_JOB_MAX_BATCH);
+            pthread_mutex_lock(&w->mtx);
+            if(n){
+                sm4_worker_push(w, batch, n);
+                n = 0;
+                continue;
+            }
+            sm4_cond_wait_ns(w, q->max_delay_ns > 1000000 ? q->max_delay_ns : 1000000);
+        }
+        pthread_mutex_unlock(&w->mtx);
+        sm4_jobs_execute(batch, n);
+    }
+}
+
+// threads 为 0 时按在线核数
+static sm4_job_queue* sm4_jobq_create(int threads, uint32_t max_delay_us){
+    if(threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if(threads <= 0) threads = 1;
+    sm4_job_queue* q = (sm4_job_queue*)xmalloc(sizeof(*q));
+    q->workers = (sm4_worker*)xmalloc(sizeof(sm4_worker) * (size_t)threads);
+    memset(q->workers, 0, sizeof(sm4_worker) * (size_t)threads);
+    q->n = threads;
+    q->max_delay_ns = (uint64_t)max_delay_us * 1000ull;
+    q->stop = 0;
+    for(int i=0;i<threads;i++){
+        pthread_mutex_init(&q->workers[i].mtx, NULL);
+        pthread_cond_init(&q->workers[i].cv, NULL);
+    }
+    for(int i=0;i<threads;i++){
+        sm4_worker_arg* a = (sm4_worker_arg*)xmalloc(sizeof(*a));
+        a->q = q; a->self = i;
+        if(pthread_create(&q->workers[i].th, NULL, sm4_worker_run, a) != 0){ perror("pthread_create"); exit(1); }
+    }
+    return q;
+}
+
+// 同一次提交的任务进入同一个队列，只加一次锁；队列按提交线程固定分配
+static sm4_worker* sm4_jobq_home(sm4_job_queue* q){
+    static unsigned next_slot;
+    static __thread unsigned slot, has_slot;
+    if(!has_slot){ slot = __atomic_fetch_add(&next_slot, 1, __ATOMIC_RELAXED); has_slot = 1; }
+    return &q->workers[slot % (unsigned)q->n];
+}
+
+// 有 ECB 任务的 len 不是 16 的整数倍（批量核心总是整块读写）或 kind 无效时返回 -1，整组都不提交
+static int sm4_jobq_submit(sm4_job_queue* q, sm4_job* const* jobs, size_t n){
+    for(size_t i=0;i<n;i++){
+        if(jobs[i]->kind == SM4_JOB_CTR) continue;
+        if(jobs[i]->kind != SM4_JOB_ECB || jobs[i]->len % 16) return -1;
+    }
+    if(n == 0) return 0;
+    sm4_worker* w = sm4_jobq_home(q);
+    uint64_t now = bench_now_ns();
+    for(size_t i=0;i<n;i++){
+        jobs[i]->done = 0;
+        jobs[i]->submitted_ns = now;
+    }
+    pthread_mutex_lock(&w->mtx);
+    size_t before = w->blocks;
+    sm4_worker_push(w, jobs, n);
+    int wake = w->count == n || before / SM4_JOB_LANES != w->blocks / SM4_JOB_LANES;
+    pthread_mutex_unlock(&w->mtx);
+    if(wake) pthread_cond_signal(&w->cv);
+    return 0;
+}
+
+// 等待任务完成，期间代为执行本线程队列中的批次
+static void sm4_jobq_wait(sm4_job_queue* q, const sm4_job* job){
+    sm4_job* batch[SM4_JOB_MAX_BATCH];
+    while(!sm4_job_ready(job)){
+        size_t n = 0;
+        sm4_worker* w = sm4_jobq_home(q);
+        if(pthread_mutex_trylock(&w->mtx) == 0){
+            if(w->count) n = sm4_worker_take(w, batch);
+            pthread_mutex_unlock(&w->mtx);
+        }
+        if(n) sm4_jobs_execute(batch, n);
+        else sched_yield();
+    }
+}
+
+static void sm4_jobq_destroy(sm4_job_queue* q){
+    __atomic_store_n(&q->stop, 1, __ATOMIC_RELEASE);
+    for(int i=0;i<q->n;i++){
+        pthread_mutex_lock(&q->workers[i].mtx);
+        pthread_cond_signal(&q->workers[i].cv);
+        pthread_mutex_unlock(&q->workers[i].mtx);
+    }
+    for(int i=0;i<q->n;i++){
+        pthread_join(q->workers[i].th, NULL);
+        pthread_mutex_destroy(&q->workers[i].mtx);
+        pthread_cond_destroy(&q->workers[i].cv);
+        free(q->workers[i].jobs);
+    }
+    free(q->workers);
+    free(q);
+}
+#endif // !_WIN32
+
+
+static int selftest(){
+    static const uint8_t key[16] = {
+        0x01,0x23,0x45,0x67,0x89,0xab,0xcd,0xef,0xfe,0xdc,0xba,0x98,0x76,0x54,0x32,0x10
+    };
+    static const uint8_t pt[16] = {
+        0x01,0x23,0x45,0x67,0x89,0xab,0xcd,0xef,0xfe,0xdc,0xba,0x98,0x76,0x54,0x32,0x10
+    };
+    static const uint8_t ct_ref[16] = {
+        0x68,0x1e,0xdf,0x34,0xd2,0x06,0x96,0x5e,0x86,0xb3,0xe9,0x4f,0x53,0x6e,0x42,0x46
+    };
+
+    sm4_build_Ttables();
+    sm4_key_t ks; sm4_key_schedule(&ks, key);
+
+    uint8_t ct[16]; sm4_encrypt_block_tt(&ks, pt, ct);
+    if(memcmp(ct, ct_ref, 16)!=0){
+        fprintf(stderr, "[FAIL] encrypt mismatched!\n");
+        return 0;
+    }
+    uint8_t rt[16]; sm4_decrypt_block_tt(&ks, ct, rt);
+    if(memcmp(rt, pt, 16)!=0){
+        fprintf(stderr, "[FAIL] decrypt mismatched!\n");
+        return 0;
+    }
+    // 向量版本与标量 T-table 逐字节一致（长度覆盖整组与尾部）
+    static const uint8_t iv[16] = {
+        0xf0,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa,0xfb,0xfc,0xfd,0xfe,0xff
+    };
+    uint8_t msg[1000], ref[1000], got[1000];
+    for(int i=0;i<1000;i++) msg[i] = (uint8_t)(i*7+1);
+    sm4_ctr_encrypt_tt(&ks, iv, msg, ref, sizeof(msg));
+    for(size_t off=0; off+16<=sizeof(msg); off+=16){
+        sm4_decrypt_block_tt(&ks, ref+off, got+off);
+        sm4_encrypt_block_tt(&ks, got+off, got+off);
+        if(memcmp(got+off, ref+off, 16)!=0){
+            fprintf(stderr, "[FAIL] block round trip mismatched!\n");
+            return 0;
+        }
+    }
+#if defined(__AVX2__)
+    sm4_ctr_encrypt_tt_avx2(&ks, iv, msg, got, sizeof(msg));
+    if(memcmp(got, ref, sizeof(msg))!=0){
+        fprintf(stderr, "[FAIL] AVX2 CTR mismatched!\n");
+        return 0;
+    }
+#endif
+#if defined(__AVX512F__)
+    sm4_ctr_encrypt_tt_avx512(&ks, iv, msg, got, sizeof(msg));
+    if(memcmp(got, ref, sizeof(msg))!=0){
+        fprintf(stderr, "[FAIL] AVX-512 CTR mismatched!\n");
+        return 0;
+    }
+#endif
+    sm4_ecb_encrypt_tt(&ks, msg, ref, 992);
+#if defined(__AVX2__)
+    sm4_ecb_encrypt_tt_avx2(&ks, msg, got, 992);
+    if(memcmp(got, ref, 992)!=0){
+        fprintf(stderr, "[FAIL] AVX2 ECB mismatched!\n");
+        return 0;
+    }
+#endif
+#if defined(__AVX512F__)
+    sm4_ecb_encrypt_tt_avx512(&ks, msg, got, 992);
+    if(memcmp(got, ref, 992)!=0){
+        fprintf(stderr, "[FAIL] AVX-512 ECB mismatched!\n");
+        return 0;
+    }
+#endif
+#if !defined(_WIN32)
+    // 异步队列：两把密钥、ECB / CTR 混合、单条与成组提交、回调与轮询，结果与同步调用一致
+    {
+        enum { NJ = 240, MAXLEN = 320 };
+        static const uint8_t key2[16] = { 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16 };
+        sm4_key_t ks2; sm4_key_schedule(&ks2, key2);
+        sm4_job* jobs = (sm4_job*)xmalloc(sizeof(sm4_job) * NJ);
+        uint8_t* outs = (uint8_t*)xmalloc((size_t)NJ * MAXLEN);
+        memset(jobs, 0, sizeof(sm4_job) * NJ);
+        int callbacks = 0, expect = 0, ok = 1;
+        sm4_job_queue* q = sm4_jobq_create(2, 100);
+        for(int i=0;i<NJ;){
+            int m = i % 3 ? 1 : 7;
+            if(m > NJ - i) m = NJ - i;
+            sm4_job* batch[7];
+            for(int k=0;k<m;k++,i++){
+                sm4_job* j = &jobs[i];
+                j->kind = i % 2 ? SM4_JOB_CTR : SM4_JOB_ECB;
+                j->ks = i % 3 == 2 ? &ks2 : &ks;
+                j->len = j->kind == SM4_JOB_CTR ? (size_t)(i*37 % MAXLEN) + 1 : (size_t)(i*5 % 20 + 1) * 16;
+                j->in = msg + (size_t)(i*13) % (sizeof(msg) - j->len);
+                j->out = outs + (size_t)i * MAXLEN;
+                memcpy(j->iv, iv, 16);
+                j->iv[15] = (uint8_t)i;
+                if(i % 4 == 3){ j->callback = sm4_job_count_done; j->user = &callbacks; expect++; }
+                batch[k] = j;
+            }
+            if(sm4_jobq_submit(q, batch, (size_t)m) != 0) ok = 0;
+        }
+        // 不满整块的 ECB 任务被拒绝，不会被执行
+        sm4_job bad;
+        memset(&bad, 0, sizeof(bad));
+        bad.kind = SM4_JOB_ECB; bad.ks = &ks; bad.in = msg; bad.out = outs; bad.len = 20;
+        sm4_job* badp = &bad;
+        if(sm4_jobq_submit(q, &badp, 1) != -1) ok = 0;
+        for(int i=0;i<NJ;i++) if(!jobs[i].callback) sm4_job_wait(&jobs[i]);
+        while(__atomic_load_n(&callbacks, __ATOMIC_ACQUIRE) != expect) sched_yield();
+        sm4_jobq_destroy(q);
+        for(int i=0;i<NJ && ok;i++){
+            sm4_job* j = &jobs[i];
+            if(j->kind == SM4_JOB_CTR) sm4_ctr_encrypt_tt(j->ks, j->iv, j->in, ref, j->len);
+            else sm4_ecb_encrypt_tt(j->ks, j->in, ref, j->len);
+            ok = memcmp(ref, j->out, j->len) == 0;
+        }
+        free(jobs); free(outs);
+        if(!ok){
+            fprintf(stderr, "[FAIL] job queue mismatched!\n");
+            return 0;
+        }
+    }
+#endif
+    fprintf(stdout, "[OK] SM4 T-table selftest passed.\n");
+    return 1;
+}
+
+
+// ---------------------------- 基准测试 ----------------------------
+// ECB / CTR 各后端，消息长度 16 B 起每次乘 4 直到 max_bytes，结果以 JSON 输出到 stdout
+
+typedef void (*sm4_mode_fn)(const sm4_key_t* ks, const uint8_t* in, uint8_t* out, size_t len);
+
+typedef struct {
+    const sm4_key_t* ks;
+    const uint8_t* in;
+    uint8_t* out;
+    size_t len;
+    sm4_mode_fn fn;
+} sm4_bench_ctx;
+
+static const uint8_t bench_iv[16] = {
+    0xa0,0xa1,0xa2,0xa3,0xa4,0xa5,0xa6,0xa7,0xa8,0xa9,0xaa,0xab,0xac,0xad,0xae,0xaf
+};
+
+static void ctr_tt(const sm4_key_t* ks, const uint8_t* in, uint8_t* out, size_t len){
+    sm4_ctr_encrypt_tt(ks, bench_iv, in, out, len);
+}
+#if defined(__AVX2__)
+static void ctr_tt_avx2(const sm4_key_t* ks, const uint8_t* in, uint8_t* out, size_t len){
+    sm4_ctr_encrypt_tt_avx2(ks, bench_iv, in, out, len);
+}
+#endif
+#if defined(__AVX512F__)
+static void ctr_tt_avx512(const sm4_key_t* ks, const uint8_t* in, uint8_t* out, size_t len){
+    sm4_ctr_encrypt_tt_avx512(ks, bench_iv, in, out, len);
+}
+#endif
+
+static void bench_mode_once(void* p){
+    sm4_bench_ctx* c = (sm4_bench_ctx*)p;
+    c->fn(c->ks, c->in, c->out, c->len);
+}
+
+static void bench_suite(size_t max_bytes){
+    static const struct { const char* op; const char* backend; sm4_mode_fn fn; } cases[] = {
+        { "ecb", "tt",        sm4_ecb_encrypt_tt },
+        { "ctr", "tt",        ctr_tt },
+#if defined(__AVX2__)
+        { "ecb", "tt_avx2",   sm4_ecb_encrypt_tt_avx2 },
+        { "ctr", "tt_avx2",   ctr_tt_avx2 },
+#endif
+#if defined(__AVX512F__)
+        { "ecb", "tt_avx512", sm4_ecb_encrypt_tt_avx512 },
+        { "ctr", "tt_avx512", ctr_tt_avx512 },
+#endif
+    };
+    uint8_t key[16];
+    for(int i=0;i<16;i++) key[i]=(uint8_t)i;
+    sm4_build_Ttables();
+    sm4_key_t ks; sm4_key_schedule(&ks, key);
+
+    uint8_t* in  = (uint8_t*)xmalloc(max_bytes);
+    uint8_t* out = (uint8_t*)xmalloc(max_bytes);
+    for(size_t i=0;i<max_bytes;i++) in[i]=(uint8_t)i;
+
+    bench_report r;
+#if defined(__AVX512F__)
+    bench_begin(&r, stdout, "sm4", "avx512");
+#elif defined(__AVX2__)
+    bench_begin(&r, stdout, "sm4", "avx2");
+#else
+    bench_begin(&r, stdout, "sm4", "scalar");
+#endif
+    for(size_t c=0;c<sizeof(cases)/sizeof(cases[0]);c++){
+        for(size_t len=16; len<=max_bytes; len=bench_next_size(len)){
+            sm4_bench_ctx ctx = { &ks, in, out, len, cases[c].fn };
+            bench_case(&r, cases[c].op, cases[c].backend, len, 1, bench_mode_once, &ctx);
+        }
+    }
+    bench_end(&r);
+    free(in); free(out);
+}
+
+#if !defined(_WIN32)
+// ---------------------------- 异步队列基准 ----------------------------
+// producers 个线程各加密 per 条 msg_len 字节的消息（同一密钥，CTR）：各线程同步调用，
+// 与逐条提交到异步队列（每个线程保持至多 window 条未完成）对比
+typedef struct {
+    sm4_job_queue* q;           // NULL 时同步
+    const sm4_key_t* ks;
+    const uint8_t* in;
+    uint8_t* out;
+    size_t per, msg_len, window;
+} sm4_producer_ctx;
+
+static void* sm4_producer_run(void* p){
+    sm4_producer_ctx* c = (sm4_producer_ctx*)p;
+    if(!c->q){
+        for(size_t i=0;i<c->per;i++){
+#if defined(__AVX512F__)
+            sm4_ctr_encrypt_tt_avx512(c->ks, bench_iv, c->in + i*c->msg_len, c->out + i*c->msg_len, c->msg_len);
+#elif defined(__AVX2__)
+            sm4_ctr_encrypt_tt_avx2(c->ks, bench_iv, c->in + i*c->msg_len, c->out + i*c->msg_len, c->msg_len);
+#else
+            sm4_ctr_encrypt_tt(c->ks, bench_iv, c->in + i*c->msg_len, c->out + i*c->msg_len, c->msg_len);
+#endif
+        }
+        return NULL;
+    }
+    sm4_job* jobs = (sm4_job*)xmalloc(sizeof(sm4_job) * c->window);
+    memset(jobs, 0, sizeof(sm4_job) * c->window);
+    for(size_t i=0;i<c->per;i+=c->window){
+        size_t m = c->per - i < c->window ? c->per - i : c->window;
+        for(size_t k=0;k<m;k++){
+            sm4_job* j = &jobs[k];
+            j->kind = SM4_JOB_CTR;
+            j->ks = c->ks;
+            memcpy(j->iv, bench_iv, 16);
+            j->in = c->in + (i+k)*c->msg_len;
+            j->out = c->out + (i+k)*c->msg_len;
+            j->len = c->msg_len;
+            if(sm4_jobq_submit(c->q, &j, 1) != 0){ fprintf(stderr, "job rejected\n"); exit(1); }
+        }
+        for(size_t k=0;k<m;k++) sm4_jobq_wait(c->q, &jobs[k]);
+    }
+    free(jobs);
+    return NULL;
+}
+
+static void bench_jobs_run(const char* name, sm4_producer_ctx* ctx, int producers){
+    pthread_t* th = (pthread_t*)xmalloc(sizeof(pthread_t) * (size_t)producers);
+    uint64_t t0 = bench_now_ns();
+    for(int p=0;p<producers;p++) pthread_create(&th[p], NULL, sm4_producer_run, &ctx[p]);
+    for(int p=0;p<producers;p++) pthread_join(th[p], NULL);
+    double secs = (double)(bench_now_ns() - t0) / 1e9;
+    double jobs = (double)producers * (double)ctx[0].per;
+    printf("%-28s %10.0f jobs/s  %6.3f GB/s\n", name, jobs / secs, jobs * (double)ctx[0].msg_len / secs / 1e9);
+    free(th);
+}
+
+static void bench_jobs(int producers, size_t per, size_t msg_len, size_t window){
+    uint8_t key[16];
+    for(int i=0;i<16;i++) key[i]=(uint8_t)i;
+    sm4_build_Ttables();
+    sm4_key_t ks; sm4_key_schedule(&ks, key);
+    uint8_t* in = (uint8_t*)xmalloc(per * msg_len);
+    for(size_t i=0;i<per*msg_len;i++) in[i]=(uint8_t)i;
+    uint8_t* out = (uint8_t*)xmalloc(per * msg_len * (size_t)producers);
+    sm4_producer_ctx* ctx = (sm4_producer_ctx*)xmalloc(sizeof(sm4_producer_ctx) * (size_t)producers);
+    printf("%d producers x %zu jobs of %zu bytes\n", producers, per, msg_len);
+
+    for(int p=0;p<producers;p++){
+        sm4_producer_ctx c = { NULL, &ks, in, out + (size_t)p*per*msg_len, per, msg_len, window };
+        ctx[p] = c;
+    }
+    bench_jobs_run("synchronous SM4-CTR", ctx, producers);
+
+    sm4_job_queue* q = sm4_jobq_create(0, 50);
+    for(int p=0;p<producers;p++) ctx[p].q = q;
+    char name[64];
+    snprintf(name, sizeof(name), "sm4_job_queue (%d workers)", q->n);
+    bench_jobs_run(name, ctx, producers);
+    sm4_jobq_destroy(q);
+    free(ctx); free(in); free(out);
+}
+#endif
+
+// ---------------------------- main函数 ----------------------------
+
+int main(int argc, char** argv){
+    if(argc==1){
+        return selftest()?0:1;
+    }
+    if(argc>=2 && strcmp(argv[1],"bench")==0){
+        size_t max_bytes = 64*1024*1024ull;
+        if(argc>=3) max_bytes = bench_parse_size(argv[2]);
+        bench_suite(max_bytes);
+        return 0;
+    }
+#if !defined(_WIN32)
+    if(argc>=2 && strcmp(argv[1],"bench-jobs")==0){
+        int producers = argc>=3 ? atoi(argv[2]) : 16;
+        size_t msg_len = argc>=4 ? (size_t)atoi(argv[3]) : 64;
+        if(producers < 1) producers = 1;
+        if(msg_len < 1) msg_len = 1;
+        bench_jobs(producers, 20000, msg_len, 64);
+        return 0;
+    }
+#endif
+    fprintf(stderr, "Usage: %s [bench [max size, e.g. 64M / 1G] | bench-jobs [producers] [msg bytes]]\n", argv[0]);
+    return 0;
+}
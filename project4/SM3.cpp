@@ -5,11 +5,39 @@
 #include <cmath>
 #include <algorithm>
 #include <stdexcept>
+#include <cstdint>
+#include <type_traits>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <queue>
+#include <array>
+#include <new>
+#include <unordered_map>
+#include <future>
+#include <cstddef>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <random>
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "../bench/instrument.h"
 
 
 using namespace std;
 
-// ============================== SM3 ʵ ==============================
+// ============================== SM3 基础实现 ==============================
 class SM3 {
 public:
     static const size_t BLOCK_SIZE = 64;
@@ -32,9 +60,9 @@ public:
 
     void update(const uint8_t* data, size_t len) {
         size_t offset = 0;
-        count += len * 8;  // ؼ
+        count += len * 8;  // 按比特计数
 
-        // еĲ
+        // 处理缓冲区中的部分数据
         if (!buffer.empty()) {
             size_t to_copy = min(BLOCK_SIZE - buffer.size(), len);
             buffer.insert(buffer.end(), data, data + to_copy);
@@ -46,13 +74,13 @@ public:
             }
         }
 
-        // 
+        // 处理完整块
         while (offset + BLOCK_SIZE <= len) {
             compress(data + offset);
             offset += BLOCK_SIZE;
         }
 
-        // ʣݵ
+        // 保存剩余数据到缓冲区
         if (offset < len) {
             buffer.insert(buffer.end(), data + offset, data + len);
         }
@@ -67,8 +95,9 @@ public:
 
         pad();
 
-        if (!buffer.empty()) {
-            compress(buffer.data());
+        // 填充后可能是1块或2块
+        for (size_t off = 0; off < buffer.size(); off += BLOCK_SIZE) {
+            compress(buffer.data() + off);
         }
 
         for (size_t i = 0; i < 8; i++) {
@@ -130,14 +159,14 @@ private:
         size_t len = buffer.size();
         uint64_t bit_count = count;
 
-        // 0x80
+        // 添加0x80
         buffer.push_back(0x80);
 
-        // 0ֱ 
-        size_t pad_len = (len < 56) ? (56 - len) : (120 - len);
+        // 填充0直到长度满足 
+        size_t pad_len = (len < 56) ? (55 - len) : (119 - len);
         buffer.insert(buffer.end(), pad_len, 0);
 
-        // ӱسȣˣ
+        // 添加比特长度（大端）
         for (int i = 7; i >= 0; i--) {
             buffer.push_back((bit_count >> (i * 8)) & 0xFF);
         }
@@ -147,7 +176,7 @@ private:
         uint32_t w[68];
         uint32_t w_prime[64];
 
-        // Ϣչ
+        // 消息扩展
         for (int i = 0; i < 16; i++) {
             w[i] = read_uint32_be(block + i * 4);
         }
@@ -162,7 +191,7 @@ private:
             w_prime[i] = w[i] ^ w[i + 4];
         }
 
-        // ѹ
+        // 压缩函数
         uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
         uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
 
@@ -203,7 +232,509 @@ private:
     }
 };
 
-// ============================== ŻSM3 (4չ) ==============================
+// ============================== SM3 快速压缩核心 ==============================
+// 轮常量 T_j <<< (j mod 32) 在编译期生成；0~15 轮与 16~63 轮由模板在编译期区分；
+// 消息扩展与轮函数交错进行，不再预先展开全部 68 个 W 与 64 个 W'。
+#if defined(_MSC_VER)
+#define SM3_INLINE __forceinline
+#else
+#define SM3_INLINE inline __attribute__((always_inline))
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SM3_SIMD_EXPAND 1
+#include <emmintrin.h>
+#endif
+
+namespace sm3_core {
+
+    static const uint32_t IV[8] = {
+        0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600,
+        0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E
+    };
+
+    constexpr uint32_t rotl(uint32_t x, unsigned n) {
+        return n == 0 ? x : (x << n) | (x >> (32 - n));
+    }
+
+    // 预旋转的轮常量表
+    struct TjTable {
+        uint32_t v[64];
+        constexpr TjTable() : v() {
+            for (unsigned j = 0; j < 64; j++) {
+                v[j] = rotl(j < 16 ? 0x79CC4519u : 0x7A879D8Au, j % 32);
+            }
+        }
+    };
+    constexpr TjTable TJ{};
+
+    SM3_INLINE uint32_t load_be32(const uint8_t* p) {
+        return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    }
+
+    SM3_INLINE void store_be32(uint8_t* p, uint32_t v) {
+        p[0] = (uint8_t)(v >> 24);
+        p[1] = (uint8_t)(v >> 16);
+        p[2] = (uint8_t)(v >> 8);
+        p[3] = (uint8_t)v;
+    }
+
+    SM3_INLINE uint32_t p0(uint32_t x) { return x ^ rotl(x, 9) ^ rotl(x, 17); }
+    SM3_INLINE uint32_t p1(uint32_t x) { return x ^ rotl(x, 15) ^ rotl(x, 23); }
+
+    // 0~15 轮: FF = GG = x ^ y ^ z
+    SM3_INLINE uint32_t ff(uint32_t x, uint32_t y, uint32_t z, std::true_type) { return x ^ y ^ z; }
+    SM3_INLINE uint32_t gg(uint32_t x, uint32_t y, uint32_t z, std::true_type) { return x ^ y ^ z; }
+    // 16~63 轮: 多数函数与选择函数
+    SM3_INLINE uint32_t ff(uint32_t x, uint32_t y, uint32_t z, std::false_type) { return (x & y) | ((x | y) & z); }
+    SM3_INLINE uint32_t gg(uint32_t x, uint32_t y, uint32_t z, std::false_type) { return ((y ^ z) & x) ^ z; }
+
+    SM3_INLINE uint32_t expand_word(uint32_t w16, uint32_t w13, uint32_t w9, uint32_t w6, uint32_t w3) {
+        return p1(w16 ^ w9 ^ rotl(w3, 15)) ^ rotl(w13, 7) ^ w6;
+    }
+
+    // 单轮，通过调用方轮换参数顺序省去寄存器间的赋值：
+    // 只更新 b、d、f、h，下一轮以 (d, a, b, c, h, e, f, g) 的顺序调用
+    template <int J>
+    SM3_INLINE void round(uint32_t a, uint32_t& b, uint32_t c, uint32_t& d,
+                          uint32_t e, uint32_t& f, uint32_t g, uint32_t& h,
+                          uint32_t wj, uint32_t wj4) {
+        typedef std::integral_constant<bool, (J < 16)> low;
+        const uint32_t a12 = rotl(a, 12);
+        const uint32_t ss1 = rotl(a12 + e + TJ.v[J], 7);
+        const uint32_t ss2 = ss1 ^ a12;
+        const uint32_t tt1 = ff(a, b, c, low()) + d + ss2 + (wj ^ wj4);
+        const uint32_t tt2 = gg(e, f, g, low()) + h + ss1 + wj;
+        b = rotl(b, 9);
+        d = tt1;
+        f = rotl(f, 19);
+        h = p0(tt2);
+    }
+
+    // ---------- 标量版本: 16 字滑动窗口 ----------
+    // 第 J 轮需要 W[J] 与 W[J+4]，因此在第 J 轮之前生成 W[J+4]，
+    // 它覆盖的窗口槽位恰好是此后不再使用的 W[J-12]
+    template <int J>
+    struct WindowRounds {
+        static SM3_INLINE void run(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d,
+                                   uint32_t& e, uint32_t& f, uint32_t& g, uint32_t& h,
+                                   uint32_t* w) {
+            if (J + 4 >= 16) {
+                const int k = J + 4;
+                w[k & 15] = expand_word(w[(k - 16) & 15], w[(k - 13) & 15],
+                                        w[(k - 9) & 15], w[(k - 6) & 15], w[(k - 3) & 15]);
+            }
+            round<J>(a, b, c, d, e, f, g, h, w[J & 15], w[(J + 4) & 15]);
+            WindowRounds<J + 1>::run(d, a, b, c, h, e, f, g, w);
+        }
+    };
+
+    template <>
+    struct WindowRounds<64> {
+        static SM3_INLINE void run(uint32_t&, uint32_t&, uint32_t&, uint32_t&,
+                                   uint32_t&, uint32_t&, uint32_t&, uint32_t&, uint32_t*) {}
+    };
+
+    inline void compress_blocks_scalar(uint32_t V[8], const uint8_t* data, size_t nblocks) {
+        uint32_t w[16];
+        for (; nblocks > 0; nblocks--, data += 64) {
+            for (int i = 0; i < 16; i++) {
+                w[i] = load_be32(data + i * 4);
+            }
+            uint32_t a = V[0], b = V[1], c = V[2], d = V[3];
+            uint32_t e = V[4], f = V[5], g = V[6], h = V[7];
+            WindowRounds<0>::run(a, b, c, d, e, f, g, h, w);
+            V[0] ^= a; V[1] ^= b; V[2] ^= c; V[3] ^= d;
+            V[4] ^= e; V[5] ^= f; V[6] ^= g; V[7] ^= h;
+        }
+    }
+
+#ifdef SM3_SIMD_EXPAND
+    SM3_INLINE __m128i rotl_v(__m128i x, int n) {
+        return _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - n));
+    }
+
+    // ---------- SSE 版本: 每次并行生成 3 个 W ----------
+    // W[k] 依赖 W[k-3]，一组最多并行 3 个字；第 4 个通道的结果无效，
+    // 会被下一组的第 1 个通道覆盖，因此缓冲区在 68 字之后留出余量
+    template <int K>
+    SM3_INLINE void expand_group(uint32_t* w) {
+        const __m128i w16 = _mm_loadu_si128((const __m128i*)(w + K - 16));
+        const __m128i w13 = _mm_loadu_si128((const __m128i*)(w + K - 13));
+        const __m128i w9 = _mm_loadu_si128((const __m128i*)(w + K - 9));
+        const __m128i w6 = _mm_loadu_si128((const __m128i*)(w + K - 6));
+        const __m128i w3 = _mm_loadu_si128((const __m128i*)(w + K - 3));
+        __m128i x = _mm_xor_si128(_mm_xor_si128(w16, w9), rotl_v(w3, 15));
+        x = _mm_xor_si128(x, _mm_xor_si128(rotl_v(x, 15), rotl_v(x, 23)));
+        x = _mm_xor_si128(x, _mm_xor_si128(rotl_v(w13, 7), w6));
+        _mm_storeu_si128((__m128i*)(w + K), x);
+    }
+
+    template <int J>
+    struct SimdRounds {
+        static SM3_INLINE void run(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d,
+                                   uint32_t& e, uint32_t& f, uint32_t& g, uint32_t& h,
+                                   uint32_t* w) {
+            // 以 W[16] 为起点每 3 个字一组，在用到之前 4 轮生成
+            if (J + 4 >= 16 && (J + 4 - 16) % 3 == 0) {
+                expand_group<(J + 4 >= 16 ? J + 4 : 16)>(w);
+            }
+            round<J>(a, b, c, d, e, f, g, h, w[J], w[J + 4]);
+            SimdRounds<J + 1>::run(d, a, b, c, h, e, f, g, w);
+        }
+    };
+
+    template <>
+    struct SimdRounds<64> {
+        static SM3_INLINE void run(uint32_t&, uint32_t&, uint32_t&, uint32_t&,
+                                   uint32_t&, uint32_t&, uint32_t&, uint32_t&, uint32_t*) {}
+    };
+
+    inline void compress_blocks_simd(uint32_t V[8], const uint8_t* data, size_t nblocks) {
+        // 68 个 W + 最后一组 (W[67..70]) 的 4 通道写入余量
+        alignas(16) uint32_t w[72];
+        for (; nblocks > 0; nblocks--, data += 64) {
+            for (int i = 0; i < 16; i++) {
+                w[i] = load_be32(data + i * 4);
+            }
+            w[16] = 0;  // 首组第 4 通道读取 W[16]，避免读取未初始化的值
+            uint32_t a = V[0], b = V[1], c = V[2], d = V[3];
+            uint32_t e = V[4], f = V[5], g = V[6], h = V[7];
+            SimdRounds<0>::run(a, b, c, d, e, f, g, h, w);
+            V[0] ^= a; V[1] ^= b; V[2] ^= c; V[3] ^= d;
+            V[4] ^= e; V[5] ^= f; V[6] ^= g; V[7] ^= h;
+        }
+    }
+#endif
+
+    // 默认的单流压缩入口
+    inline void compress_blocks(uint32_t V[8], const uint8_t* data, size_t nblocks) {
+        INSTR_BEGIN(t0);
+#ifdef SM3_SIMD_EXPAND
+        compress_blocks_simd(V, data, nblocks);
+#else
+        compress_blocks_scalar(V, data, nblocks);
+#endif
+        INSTR_END(INSTR_SM3_COMPRESS, t0, nblocks * 64);
+    }
+
+    // ---------- 64 字节消息的第二个压缩块 ----------
+    // 消息恰为 64 字节时，填充块固定为 0x80 || 0...0 || 长度 512，
+    // 其 68 个 W 在编译期展开，第二次压缩可以跳过填充与消息扩展
+    struct PadSchedule {
+        uint32_t w[68];
+        constexpr PadSchedule() : w() {
+            w[0] = 0x80000000u;
+            w[15] = 512;
+            for (int k = 16; k < 68; k++) {
+                uint32_t x = w[k - 16] ^ w[k - 9] ^ rotl(w[k - 3], 15);
+                w[k] = x ^ rotl(x, 15) ^ rotl(x, 23) ^ rotl(w[k - 13], 7) ^ w[k - 6];
+            }
+        }
+    };
+    constexpr PadSchedule PAD64{};
+
+    template <int J>
+    struct PadRounds {
+        static SM3_INLINE void run(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d,
+                                   uint32_t& e, uint32_t& f, uint32_t& g, uint32_t& h) {
+            round<J>(a, b, c, d, e, f, g, h, PAD64.w[J], PAD64.w[J + 4]);
+            PadRounds<J + 1>::run(d, a, b, c, h, e, f, g);
+        }
+    };
+
+    template <>
+    struct PadRounds<64> {
+        static SM3_INLINE void run(uint32_t&, uint32_t&, uint32_t&, uint32_t&,
+                                   uint32_t&, uint32_t&, uint32_t&, uint32_t&) {}
+    };
+
+    inline void compress_pad64(uint32_t V[8]) {
+        INSTR_BEGIN(t0);
+        uint32_t a = V[0], b = V[1], c = V[2], d = V[3];
+        uint32_t e = V[4], f = V[5], g = V[6], h = V[7];
+        PadRounds<0>::run(a, b, c, d, e, f, g, h);
+        V[0] ^= a; V[1] ^= b; V[2] ^= c; V[3] ^= d;
+        V[4] ^= e; V[5] ^= f; V[6] ^= g; V[7] ^= h;
+        INSTR_END(INSTR_SM3_COMPRESS, t0, 64);
+    }
+
+} // namespace sm3_core
+
+// ============================== SM3 多缓冲 (AVX2 / AVX-512) ==============================
+// 每个通道独立计算一条消息，状态按字存放: V[i] 的第 l 个通道是第 l 条消息的第 i 个状态字
+#if defined(__AVX512F__)
+#define SM3_MB_LANES 16
+#elif defined(__AVX2__)
+#define SM3_MB_LANES 8
+#else
+#define SM3_MB_LANES 1
+#endif
+
+#if SM3_MB_LANES > 1
+#include <immintrin.h>
+
+namespace sm3_mb {
+
+    static const size_t LANES = SM3_MB_LANES;
+
+#if SM3_MB_LANES == 16
+    typedef __m512i vec;
+    SM3_INLINE vec vset1(uint32_t x) { return _mm512_set1_epi32((int)x); }
+    SM3_INLINE vec vadd(vec x, vec y) { return _mm512_add_epi32(x, y); }
+    SM3_INLINE vec vxor(vec x, vec y) { return _mm512_xor_si512(x, y); }
+    SM3_INLINE vec vxor3(vec x, vec y, vec z) { return _mm512_ternarylogic_epi32(x, y, z, 0x96); }
+    SM3_INLINE vec vmaj(vec x, vec y, vec z) { return _mm512_ternarylogic_epi32(x, y, z, 0xE8); }
+    SM3_INLINE vec vsel(vec x, vec y, vec z) { return _mm512_ternarylogic_epi32(x, y, z, 0xCA); }
+    template <int N> SM3_INLINE vec vrotl(vec x) { return _mm512_rol_epi32(x, N); }
+    SM3_INLINE vec vload(const uint32_t* p) { return _mm512_load_si512((const void*)p); }
+    SM3_INLINE void vstore(uint32_t* p, vec x) { _mm512_store_si512((void*)p, x); }
+#else
+    typedef __m256i vec;
+    SM3_INLINE vec vset1(uint32_t x) { return _mm256_set1_epi32((int)x); }
+    SM3_INLINE vec vadd(vec x, vec y) { return _mm256_add_epi32(x, y); }
+    SM3_INLINE vec vxor(vec x, vec y) { return _mm256_xor_si256(x, y); }
+    SM3_INLINE vec vxor3(vec x, vec y, vec z) { return _mm256_xor_si256(_mm256_xor_si256(x, y), z); }
+    SM3_INLINE vec vmaj(vec x, vec y, vec z) {
+        return _mm256_or_si256(_mm256_and_si256(x, y), _mm256_and_si256(_mm256_or_si256(x, y), z));
+    }
+    SM3_INLINE vec vsel(vec x, vec y, vec z) {
+        return _mm256_xor_si256(_mm256_and_si256(_mm256_xor_si256(y, z), x), z);
+    }
+    template <int N> SM3_INLINE vec vrotl(vec x) {
+        return _mm256_or_si256(_mm256_slli_epi32(x, N), _mm256_srli_epi32(x, 32 - N));
+    }
+    SM3_INLINE vec vload(const uint32_t* p) { return _mm256_load_si256((const __m256i*)p); }
+    SM3_INLINE void vstore(uint32_t* p, vec x) { _mm256_store_si256((__m256i*)p, x); }
+#endif
+
+    SM3_INLINE vec ff(vec x, vec y, vec z, std::true_type) { return vxor3(x, y, z); }
+    SM3_INLINE vec gg(vec x, vec y, vec z, std::true_type) { return vxor3(x, y, z); }
+    SM3_INLINE vec ff(vec x, vec y, vec z, std::false_type) { return vmaj(x, y, z); }
+    SM3_INLINE vec gg(vec x, vec y, vec z, std::false_type) { return vsel(x, y, z); }
+    SM3_INLINE vec p0(vec x) { return vxor3(x, vrotl<9>(x), vrotl<17>(x)); }
+    SM3_INLINE vec p1(vec x) { return vxor3(x, vrotl<15>(x), vrotl<23>(x)); }
+
+    // 与 sm3_core::round 相同的参数轮换方式
+    template <int J>
+    SM3_INLINE void round(vec a, vec& b, vec c, vec& d, vec e, vec& f, vec g, vec& h,
+                          vec wj, vec wj4) {
+        typedef std::integral_constant<bool, (J < 16)> low;
+        const vec a12 = vrotl<12>(a);
+        const vec ss1 = vrotl<7>(vadd(vadd(a12, e), vset1(sm3_core::TJ.v[J])));
+        const vec ss2 = vxor(ss1, a12);
+        const vec tt1 = vadd(vadd(ff(a, b, c, low()), d), vadd(ss2, vxor(wj, wj4)));
+        const vec tt2 = vadd(vadd(gg(e, f, g, low()), h), vadd(ss1, wj));
+        b = vrotl<9>(b);
+        d = tt1;
+        f = vrotl<19>(f);
+        h = p0(tt2);
+    }
+
+    template <int J>
+    struct WindowRounds {
+        static SM3_INLINE void run(vec& a, vec& b, vec& c, vec& d,
+                                   vec& e, vec& f, vec& g, vec& h, vec* w) {
+            if (J + 4 >= 16) {
+                const int k = J + 4;
+                w[k & 15] = vxor3(p1(vxor3(w[(k - 16) & 15], w[(k - 9) & 15], vrotl<15>(w[(k - 3) & 15]))),
+                                  vrotl<7>(w[(k - 13) & 15]), w[(k - 6) & 15]);
+            }
+            round<J>(a, b, c, d, e, f, g, h, w[J & 15], w[(J + 4) & 15]);
+            WindowRounds<J + 1>::run(d, a, b, c, h, e, f, g, w);
+        }
+    };
+
+    template <>
+    struct WindowRounds<64> {
+        static SM3_INLINE void run(vec&, vec&, vec&, vec&, vec&, vec&, vec&, vec&, vec*) {}
+    };
+
+    template <int J>
+    struct PadRounds {
+        static SM3_INLINE void run(vec& a, vec& b, vec& c, vec& d,
+                                   vec& e, vec& f, vec& g, vec& h) {
+            round<J>(a, b, c, d, e, f, g, h,
+                     vset1(sm3_core::PAD64.w[J]), vset1(sm3_core::PAD64.w[J + 4]));
+            PadRounds<J + 1>::run(d, a, b, c, h, e, f, g);
+        }
+    };
+
+    template <>
+    struct PadRounds<64> {
+        static SM3_INLINE void run(vec&, vec&, vec&, vec&, vec&, vec&, vec&, vec&) {}
+    };
+
+    SM3_INLINE void finish(vec V[8], vec a, vec b, vec c, vec d, vec e, vec f, vec g, vec h) {
+        V[0] = vxor(V[0], a); V[1] = vxor(V[1], b); V[2] = vxor(V[2], c); V[3] = vxor(V[3], d);
+        V[4] = vxor(V[4], e); V[5] = vxor(V[5], f); V[6] = vxor(V[6], g); V[7] = vxor(V[7], h);
+    }
+
+    inline void init(vec V[8]) {
+        for (int i = 0; i < 8; i++) V[i] = vset1(sm3_core::IV[i]);
+    }
+
+    // 各通道从各自的中间状态开始（如不同密钥的 HMAC）
+    inline void load(vec V[8], const uint32_t* const states[LANES]) {
+        alignas(64) uint32_t t[8][LANES];
+        for (size_t l = 0; l < LANES; l++) {
+            for (int i = 0; i < 8; i++) t[i][l] = states[l][i];
+        }
+        for (int i = 0; i < 8; i++) V[i] = vload(t[i]);
+    }
+
+    // 每个通道压缩一个 64 字节块
+    inline void compress(vec V[8], const uint8_t* const blocks[LANES]) {
+        INSTR_BEGIN(t0);
+        alignas(64) uint32_t t[16][LANES];
+        for (size_t l = 0; l < LANES; l++) {
+            for (int i = 0; i < 16; i++) t[i][l] = sm3_core::load_be32(blocks[l] + i * 4);
+        }
+        vec w[16];
+        for (int i = 0; i < 16; i++) w[i] = vload(t[i]);
+        vec a = V[0], b = V[1], c = V[2], d = V[3], e = V[4], f = V[5], g = V[6], h = V[7];
+        WindowRounds<0>::run(a, b, c, d, e, f, g, h, w);
+        finish(V, a, b, c, d, e, f, g, h);
+        INSTR_END(INSTR_SM3_MB_COMPRESS, t0, 64 * LANES);
+    }
+
+    // 每个通道压缩 64 字节消息的固定填充块
+    inline void compress_pad64(vec V[8]) {
+        INSTR_BEGIN(t0);
+        vec a = V[0], b = V[1], c = V[2], d = V[3], e = V[4], f = V[5], g = V[6], h = V[7];
+        PadRounds<0>::run(a, b, c, d, e, f, g, h);
+        finish(V, a, b, c, d, e, f, g, h);
+        INSTR_END(INSTR_SM3_MB_COMPRESS, t0, 64 * LANES);
+    }
+
+    inline void store(const vec V[8], uint8_t* const out[LANES]) {
+        alignas(64) uint32_t t[8][LANES];
+        for (int i = 0; i < 8; i++) vstore(t[i], V[i]);
+        for (size_t l = 0; l < LANES; l++) {
+            for (int i = 0; i < 8; i++) sm3_core::store_be32(out[l] + i * 4, t[i][l]);
+        }
+    }
+
+} // namespace sm3_mb
+#endif
+
+// ============================== 定长 64 字节 SM3 (Merkle 节点) ==============================
+// SM3(l || r)，l、r 均为 32 字节
+inline void sm3_64(const uint8_t l[32], const uint8_t r[32], uint8_t out[32]) {
+    uint8_t block[64];
+    memcpy(block, l, 32);
+    memcpy(block + 32, r, 32);
+    uint32_t V[8];
+    memcpy(V, sm3_core::IV, sizeof(V));
+    sm3_core::compress_blocks(V, block, 1);
+    sm3_core::compress_pad64(V);
+    for (int i = 0; i < 8; i++) sm3_core::store_be32(out + i * 4, V[i]);
+}
+
+// 多缓冲形式: out[i] = SM3(l[i] || r[i])
+inline void sm3_64_batch(const uint8_t* const* l, const uint8_t* const* r,
+                         uint8_t* const* out, size_t n) {
+    size_t i = 0;
+#if SM3_MB_LANES > 1
+    for (; i + sm3_mb::LANES <= n; i += sm3_mb::LANES) {
+        uint8_t blocks[sm3_mb::LANES][64];
+        const uint8_t* bp[sm3_mb::LANES];
+        for (size_t k = 0; k < sm3_mb::LANES; k++) {
+            memcpy(blocks[k], l[i + k], 32);
+            memcpy(blocks[k] + 32, r[i + k], 32);
+            bp[k] = blocks[k];
+        }
+        sm3_mb::vec V[8];
+        sm3_mb::init(V);
+        sm3_mb::compress(V, bp);
+        sm3_mb::compress_pad64(V);
+        sm3_mb::store(V, out + i);
+    }
+#endif
+    for (; i < n; i++) {
+        sm3_64(l[i], r[i], out[i]);
+    }
+}
+
+// 整层形式: children 为连续的 2n 个 32 字节节点，parents[i] = SM3(children[2i] || children[2i+1])
+inline void sm3_64_level(const uint8_t* children, uint8_t* parents, size_t n) {
+    size_t i = 0;
+#if SM3_MB_LANES > 1
+    for (; i + sm3_mb::LANES <= n; i += sm3_mb::LANES) {
+        const uint8_t* bp[sm3_mb::LANES];
+        uint8_t* op[sm3_mb::LANES];
+        for (size_t k = 0; k < sm3_mb::LANES; k++) {
+            bp[k] = children + (i + k) * 64;
+            op[k] = parents + (i + k) * 32;
+        }
+        sm3_mb::vec V[8];
+        sm3_mb::init(V);
+        sm3_mb::compress(V, bp);
+        sm3_mb::compress_pad64(V);
+        sm3_mb::store(V, op);
+    }
+#endif
+    for (; i < n; i++) {
+        sm3_64(children + i * 64, children + i * 64 + 32, parents + i * 32);
+    }
+}
+
+// ============================== 优化版SM3 ==============================
+// 可复制的中间状态：链接值、已处理比特数与未满的块，全部在栈上，复制即快照。
+// 对共享前缀只需计算一次，之后从快照继续
+struct SM3Midstate {
+    uint32_t state[8];
+    uint64_t count;        // 已处理的比特数
+    uint8_t block[64];
+    uint32_t used;         // block 中的字节数
+
+    SM3Midstate() : count(0), used(0) {
+        memcpy(state, sm3_core::IV, sizeof(state));
+    }
+
+    void update(const uint8_t* data, size_t len) {
+        count += (uint64_t)len * 8;
+        if (used > 0) {
+            size_t k = min<size_t>(64 - used, len);
+            memcpy(block + used, data, k);
+            used += (uint32_t)k;
+            data += k;
+            len -= k;
+            if (used < 64) return;
+            sm3_core::compress_blocks(state, block, 1);
+            used = 0;
+        }
+        size_t nblocks = len / 64;
+        if (nblocks > 0) {
+            sm3_core::compress_blocks(state, data, nblocks);
+            data += nblocks * 64;
+            len -= nblocks * 64;
+        }
+        if (len > 0) memcpy(block, data, len);
+        used = (uint32_t)len;
+    }
+
+    // 剩余数据加填充组成的最后 1 或 2 个块，返回块数
+    size_t final_blocks(uint8_t tail[128]) const {
+        size_t total = used < 56 ? 64 : 128;
+        memcpy(tail, block, used);
+        tail[used] = 0x80;
+        memset(tail + used + 1, 0, total - used - 9);
+        for (int i = 0; i < 8; i++) tail[total - 1 - i] = (uint8_t)(count >> (i * 8));
+        return total / 64;
+    }
+
+    // 不改变自身，可从同一快照多次结束
+    void digest(uint8_t out[32]) const {
+        uint8_t tail[128];
+        size_t nblocks = final_blocks(tail);
+        uint32_t V[8];
+        memcpy(V, state, sizeof(V));
+        sm3_core::compress_blocks(V, tail, nblocks);
+        for (int i = 0; i < 8; i++) sm3_core::store_be32(out + i * 4, V[i]);
+    }
+};
+
 class OptimizedSM3 {
 public:
     static const size_t BLOCK_SIZE = 64;
@@ -224,7 +755,7 @@ public:
         buffer.clear();
     }
 
-    // ӹڲ״̬
+    // 添加公共方法用于设置内部状态
     void set_state(const uint8_t* new_state) {
         for (int i = 0; i < 8; i++) {
             state[i] = (new_state[i * 4] << 24) |
@@ -234,16 +765,32 @@ public:
         }
     }
 
-    // ӹϢ
+    // 添加公共方法用于设置消息计数
     void set_count(uint64_t new_count) {
         count = new_count;
     }
 
+    // 保存当前中间状态，之后可 restore() 或直接在快照上继续计算
+    SM3Midstate checkpoint() const {
+        SM3Midstate m;
+        memcpy(m.state, state, sizeof(state));
+        m.count = count;
+        m.used = (uint32_t)buffer.size();
+        if (!buffer.empty()) memcpy(m.block, buffer.data(), buffer.size());
+        return m;
+    }
+
+    void restore(const SM3Midstate& m) {
+        memcpy(state, m.state, sizeof(state));
+        count = m.count;
+        buffer.assign(m.block, m.block + m.used);
+    }
+
     void update(const uint8_t* data, size_t len) {
         size_t offset = 0;
         count += len * 8;  
 
-        // еĲ
+        // 处理缓冲区中的部分数据
         if (!buffer.empty()) {
             size_t to_copy = min(BLOCK_SIZE - buffer.size(), len);
             buffer.insert(buffer.end(), data, data + to_copy);
@@ -255,13 +802,14 @@ public:
             }
         }
 
-        // 
-        while (offset + BLOCK_SIZE <= len) {
-            compress(data + offset);
-            offset += BLOCK_SIZE;
+        // 处理完整块
+        size_t nblocks = (len - offset) / BLOCK_SIZE;
+        if (nblocks > 0) {
+            sm3_core::compress_blocks(state, data + offset, nblocks);
+            offset += nblocks * BLOCK_SIZE;
         }
 
-        // ʣݵ
+        // 保存剩余数据到缓冲区
         if (offset < len) {
             buffer.insert(buffer.end(), data + offset, data + len);
         }
@@ -274,9 +822,7 @@ public:
         vector<uint8_t> saved_buffer = buffer;
         uint64_t saved_count = count;
         pad();
-        if (!buffer.empty()) {
-            compress(buffer.data());
-        }
+        sm3_core::compress_blocks(state, buffer.data(), buffer.size() / BLOCK_SIZE);
         
         for (size_t i = 0; i < 8; i++) {
             write_uint32_be(result.data() + i * 4, state[i]);
@@ -295,34 +841,6 @@ private:
     uint64_t count;
     vector<uint8_t> buffer;
 
-    static inline uint32_t left_rotate(uint32_t x, uint32_t n) {
-        return (x << n) | (x >> (32 - n));
-    }
-
-    static inline uint32_t ff0(uint32_t x, uint32_t y, uint32_t z) {
-        return x ^ y ^ z;
-    }
-
-    static inline uint32_t ff1(uint32_t x, uint32_t y, uint32_t z) {
-        return (x & y) | (x & z) | (y & z);
-    }
-
-    static inline uint32_t gg0(uint32_t x, uint32_t y, uint32_t z) {
-        return x ^ y ^ z;
-    }
-
-    static inline uint32_t gg1(uint32_t x, uint32_t y, uint32_t z) {
-        return (x & y) | (~x & z);
-    }
-
-    static inline uint32_t p0(uint32_t x) {
-        return x ^ left_rotate(x, 9) ^ left_rotate(x, 17);
-    }
-
-    static inline uint32_t p1(uint32_t x) {
-        return x ^ left_rotate(x, 15) ^ left_rotate(x, 23);
-    }
-
     void write_uint32_be(uint8_t* out, uint32_t val) {
         out[0] = (val >> 24) & 0xFF;
         out[1] = (val >> 16) & 0xFF;
@@ -330,286 +848,3827 @@ private:
         out[3] = val & 0xFF;
     }
 
-    uint32_t read_uint32_be(const uint8_t* in) {
-        return (in[0] << 24) | (in[1] << 16) | (in[2] << 8) | in[3];
-    }
-
     void pad() {
         size_t len = buffer.size();
         uint64_t bit_count = count;
 
-        // 0x80
+        // 添加0x80
         buffer.push_back(0x80);
 
-        // 0ֱ
-        size_t pad_len = (len < 56) ? (56 - len) : (120 - len);
+        // 填充0直到长度满足
+        size_t pad_len = (len < 56) ? (55 - len) : (119 - len);
         buffer.insert(buffer.end(), pad_len, 0);
 
-        // ӱسȣˣ
+        // 添加比特长度（大端）
         for (int i = 7; i >= 0; i--) {
             buffer.push_back((bit_count >> (i * 8)) & 0xFF);
         }
     }
 
-    // 4չѹ
+    // 压缩函数交由快速核心完成
     void compress(const uint8_t* block) {
-        uint32_t w[68];
-        uint32_t w_prime[64];
+        sm3_core::compress_blocks(state, block, 1);
+    }
+};
 
-        // Ϣչ
-        for (int i = 0; i < 16; i++) {
-            w[i] = read_uint32_be(block + i * 4);
-        }
+// ============================== SM3 前缀缓存 ==============================
+// 按前缀 ID 缓存中间状态（如 MAC 密钥块、固定的记录头），重复的工作负载只计算后缀。
+// add() 完成后可由多个线程并发调用 hash()
+class SM3PrefixCache {
+public:
+    void add(uint64_t id, const uint8_t* prefix, size_t len) {
+        SM3Midstate m;
+        m.update(prefix, len);
+        states[id] = m;
+    }
 
-        for (int i = 16; i < 68; i++) {
-            w[i] = p1(w[i - 16] ^ w[i - 9] ^ left_rotate(w[i - 3], 15))
-                ^ left_rotate(w[i - 13], 7)
-                ^ w[i - 6];
-        }
+    void add(uint64_t id, const vector<uint8_t>& prefix) {
+        add(id, prefix.data(), prefix.size());
+    }
 
-        for (int i = 0; i < 64; i++) {
-            w_prime[i] = w[i] ^ w[i + 4];
+    bool contains(uint64_t id) const { return states.count(id) != 0; }
+    size_t size() const { return states.size(); }
+
+    const SM3Midstate& get(uint64_t id) const {
+        auto it = states.find(id);
+        if (it == states.end()) throw out_of_range("Unknown SM3 prefix id");
+        return it->second;
+    }
+
+    // SM3(prefix[id] || data)
+    void hash(uint64_t id, const uint8_t* data, size_t len, uint8_t out[32]) const {
+        SM3Midstate m = get(id);
+        m.update(data, len);
+        m.digest(out);
+    }
+
+private:
+    unordered_map<uint64_t, SM3Midstate> states;
+};
+
+// ============================== 多缓冲 SM3 (变长消息) ==============================
+// out[i] = 从 starts[i] 继续吸收 data[i] 后的摘要；starts 为 nullptr 时各条均从 IV 开始。
+// 起点须块对齐（used == 0），如 HMAC 预先压缩的密钥块。
+// 按块数排序后每 SM3_MB_LANES 条一组多缓冲压缩，组内先结束的通道取出状态后以空块陪跑
+inline void sm3_batch_from(const SM3Midstate* const* starts, const uint8_t* const* data, const size_t* lens,
+                           uint8_t* const* out, size_t n) {
+    static const SM3Midstate iv;
+    for (size_t i = 0; starts && i < n; i++) {
+        if (starts[i]->used != 0) throw invalid_argument("sm3_batch_from: start state must be block aligned");
+    }
+#if SM3_MB_LANES > 1
+    const size_t L = sm3_mb::LANES;
+    vector<size_t> order(n);
+    for (size_t i = 0; i < n; i++) order[i] = i;
+    sort(order.begin(), order.end(), [&](size_t x, size_t y) { return lens[x] < lens[y]; });
+
+    for (size_t g = 0; g < n; g += L) {
+        size_t m = min(L, n - g);
+        uint8_t tail[sm3_mb::LANES][128];
+        size_t nfull[sm3_mb::LANES], steps[sm3_mb::LANES];
+        const uint32_t* states[sm3_mb::LANES];
+        alignas(64) uint32_t final_state[sm3_mb::LANES][8];
+        size_t max_steps = 0;
+        for (size_t l = 0; l < L; l++) {
+            size_t i = order[g + (l < m ? l : 0)];
+            const SM3Midstate& st = starts ? *starts[i] : iv;
+            size_t len = lens[i], r = len % 64;
+            nfull[l] = len / 64;
+            size_t t = r < 56 ? 1 : 2;
+            memcpy(tail[l], data[i] + nfull[l] * 64, r);
+            tail[l][r] = 0x80;
+            memset(tail[l] + r + 1, 0, t * 64 - r - 9);
+            uint64_t bits = st.count + (uint64_t)len * 8;
+            for (int k = 0; k < 8; k++) tail[l][t * 64 - 1 - k] = (uint8_t)(bits >> (k * 8));
+            steps[l] = nfull[l] + t;
+            states[l] = st.state;
+            max_steps = max(max_steps, steps[l]);
         }
 
-        // Ĵ
-        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
-        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        sm3_mb::vec V[8];
+        sm3_mb::load(V, states);
+        const uint8_t* bp[sm3_mb::LANES];
+        alignas(64) uint32_t snap[8][sm3_mb::LANES];
+        for (size_t s = 0; s < max_steps; s++) {
+            bool finishing = false;
+            for (size_t l = 0; l < L; l++) {
+                size_t i = order[g + (l < m ? l : 0)];
+                if (s < nfull[l]) bp[l] = data[i] + s * 64;
+                else if (s < steps[l]) bp[l] = tail[l] + (s - nfull[l]) * 64;
+                else bp[l] = tail[l];
+                finishing = finishing || steps[l] == s + 1;
+            }
+            sm3_mb::compress(V, bp);
+            if (!finishing) continue;
+            for (int w = 0; w < 8; w++) sm3_mb::vstore(snap[w], V[w]);
+            for (size_t l = 0; l < L; l++) {
+                if (steps[l] != s + 1) continue;
+                for (int w = 0; w < 8; w++) final_state[l][w] = snap[w][l];
+            }
+        }
+        for (size_t l = 0; l < m; l++) {
+            for (int w = 0; w < 8; w++) sm3_core::store_be32(out[order[g + l]] + w * 4, final_state[l][w]);
+        }
+    }
+#else
+    for (size_t i = 0; i < n; i++) {
+        SM3Midstate m = starts ? *starts[i] : iv;
+        m.update(data[i], lens[i]);
+        m.digest(out[i]);
+    }
+#endif
+}
 
-        // 4չ
-        for (int j = 0; j < 64; j += 4) {
-            // 1
-            uint32_t ss1 = left_rotate(left_rotate(a, 12) + e + left_rotate(j < 16 ? 0x79CC4519 : 0x7A879D8A, j), 7);
-            uint32_t ss2 = ss1 ^ left_rotate(a, 12);
-            uint32_t tt1 = (j < 16 ? ff0(a, b, c) : ff1(a, b, c)) + d + ss2 + w_prime[j];
-            uint32_t tt2 = (j < 16 ? gg0(e, f, g) : gg1(e, f, g)) + h + ss1 + w[j];
-
-            uint32_t next_d = c;
-            uint32_t next_c = left_rotate(b, 9);
-            uint32_t next_b = a;
-            uint32_t next_a = tt1;
-            uint32_t next_h = g;
-            uint32_t next_g = left_rotate(f, 19);
-            uint32_t next_f = e;
-            uint32_t next_e = p0(tt2);
-
-            // 2 (ʹøºļĴ)
-            ss1 = left_rotate(left_rotate(next_a, 12) + next_e + left_rotate(j + 1 < 16 ? 0x79CC4519 : 0x7A879D8A, j + 1), 7);
-            ss2 = ss1 ^ left_rotate(next_a, 12);
-            tt1 = (j + 1 < 16 ? ff0(next_a, next_b, next_c) : ff1(next_a, next_b, next_c)) + next_d + ss2 + w_prime[j + 1];
-            tt2 = (j + 1 < 16 ? gg0(next_e, next_f, next_g) : gg1(next_e, next_f, next_g)) + next_h + ss1 + w[j + 1];
-
-            d = next_c;
-            c = left_rotate(next_b, 9);
-            b = next_a;
-            a = tt1;
-            h = next_g;
-            g = left_rotate(next_f, 19);
-            f = next_e;
-            e = p0(tt2);
+// out[i] = SM3(data[i])
+inline void sm3_batch(const uint8_t* const* data, const size_t* lens, uint8_t* const* out, size_t n) {
+    sm3_batch_from(nullptr, data, lens, out, n);
+}
 
-            // 3
-            ss1 = left_rotate(left_rotate(a, 12) + e + left_rotate(j + 2 < 16 ? 0x79CC4519 : 0x7A879D8A, j + 2), 7);
-            ss2 = ss1 ^ left_rotate(a, 12);
-            tt1 = (j + 2 < 16 ? ff0(a, b, c) : ff1(a, b, c)) + d + ss2 + w_prime[j + 2];
-            tt2 = (j + 2 < 16 ? gg0(e, f, g) : gg1(e, f, g)) + h + ss1 + w[j + 2];
-
-            next_d = c;
-            next_c = left_rotate(b, 9);
-            next_b = a;
-            next_a = tt1;
-            next_h = g;
-            next_g = left_rotate(f, 19);
-            next_f = e;
-            next_e = p0(tt2);
-
-            // 4
-            ss1 = left_rotate(left_rotate(next_a, 12) + next_e + left_rotate(j + 3 < 16 ? 0x79CC4519 : 0x7A879D8A, j + 3), 7);
-            ss2 = ss1 ^ left_rotate(next_a, 12);
-            tt1 = (j + 3 < 16 ? ff0(next_a, next_b, next_c) : ff1(next_a, next_b, next_c)) + next_d + ss2 + w_prime[j + 3];
-            tt2 = (j + 3 < 16 ? gg0(next_e, next_f, next_g) : gg1(next_e, next_f, next_g)) + next_h + ss1 + w[j + 3];
-
-            d = next_c;
-            c = left_rotate(next_b, 9);
-            b = next_a;
-            a = tt1;
-            h = next_g;
-            g = left_rotate(next_f, 19);
-            f = next_e;
-            e = p0(tt2);
+// ============================== HMAC-SM3 ==============================
+// 每个密钥预先压缩 K^ipad 与 K^opad 两个块并保存中间状态，
+// 每条消息只需压缩数据块、内层填充块和一个外层块
+class HmacSM3 {
+public:
+    static const size_t BLOCK_SIZE = 64;
+    static const size_t MAC_SIZE = 32;
+
+    HmacSM3(const uint8_t* key, size_t len) {
+        uint8_t k[BLOCK_SIZE] = {};
+        if (len > BLOCK_SIZE) {
+            SM3Midstate h;
+            h.update(key, len);
+            h.digest(k);
+        }
+        else if (len > 0) {
+            memcpy(k, key, len);
         }
+        uint8_t pad[BLOCK_SIZE];
+        for (size_t i = 0; i < BLOCK_SIZE; i++) pad[i] = k[i] ^ 0x36;
+        inner_state.update(pad, BLOCK_SIZE);
+        for (size_t i = 0; i < BLOCK_SIZE; i++) pad[i] = k[i] ^ 0x5c;
+        outer_state.update(pad, BLOCK_SIZE);
+        memset(k, 0, sizeof(k));
+        memset(pad, 0, sizeof(pad));
+    }
 
-        state[0] ^= a;
-        state[1] ^= b;
-        state[2] ^= c;
-        state[3] ^= d;
-        state[4] ^= e;
-        state[5] ^= f;
-        state[6] ^= g;
-        state[7] ^= h;
+    explicit HmacSM3(const vector<uint8_t>& key) : HmacSM3(key.data(), key.size()) {}
+
+    void mac(const uint8_t* data, size_t len, uint8_t out[MAC_SIZE]) const {
+        SM3Midstate m = inner_state;
+        m.update(data, len);
+        uint8_t ih[32];
+        m.digest(ih);
+        m = outer_state;
+        m.update(ih, 32);
+        m.digest(out);
     }
-};
 
-// ============================== չ ==============================
-vector<uint8_t> length_extension_attack(
-    const vector<uint8_t>& original_hash,
-    size_t original_len,
-    const vector<uint8_t>& extension
-) {
-    // ԭʼϣָڲ״̬
-    if (original_hash.size() != 32)
-        throw invalid_argument("Invalid hash length");
+    vector<uint8_t> mac(const vector<uint8_t>& data) const {
+        vector<uint8_t> out(MAC_SIZE);
+        mac(data.data(), data.size(), out.data());
+        return out;
+    }
 
-    OptimizedSM3 sm3;
-    sm3.set_state(original_hash.data());
+    // 同一密钥下的多条消息
+    void mac_batch(const uint8_t* const* data, const size_t* lens, uint8_t* const* out, size_t n) const;
 
-    // ԭʼϢܱ
-    size_t pad_len = (55 - (original_len % 64) + 64) % 64;
-    uint64_t total_bits_after_padding = (original_len + 1 + pad_len + 8) * 8;
+    const SM3Midstate& inner() const { return inner_state; }
+    const SM3Midstate& outer() const { return outer_state; }
 
-    // ȷϢչ
-    sm3.set_count(total_bits_after_padding + extension.size() * 8);
+private:
+    SM3Midstate inner_state, outer_state;
+};
 
-    // չ
-    sm3.update(extension.data(), extension.size());
-    return sm3.digest();
+// out[i] = HMAC(keys[i], data[i])，各条消息的密钥可以不同。
+// 内层从各自的 K^ipad 状态多缓冲吸收消息，外层从 K^opad 状态吸收 32 字节内层摘要（单个块）
+inline void hmac_sm3_batch(const HmacSM3* const* keys, const uint8_t* const* data, const size_t* lens,
+                           uint8_t* const* out, size_t n) {
+    vector<const SM3Midstate*> starts(n);
+    vector<array<uint8_t, 32>> inner(n);
+    vector<const uint8_t*> ip(n);
+    vector<uint8_t*> op(n);
+    vector<size_t> ilen(n, 32);
+    for (size_t i = 0; i < n; i++) {
+        starts[i] = &keys[i]->inner();
+        ip[i] = op[i] = inner[i].data();
+    }
+    sm3_batch_from(starts.data(), data, lens, op.data(), n);
+    for (size_t i = 0; i < n; i++) starts[i] = &keys[i]->outer();
+    sm3_batch_from(starts.data(), ip.data(), ilen.data(), out, n);
 }
 
-// ============================== Merkleʵ (RFC6962) ==============================
-class MerkleTree {
-public:
-    MerkleTree(const vector<vector<uint8_t>>& leaves) {
-        if (leaves.empty()) return;
-
-        // ȷҶ2
-        size_t n = leaves.size();
-        size_t tree_size = 1;
-        while (tree_size < n) tree_size <<= 1;
+inline void HmacSM3::mac_batch(const uint8_t* const* data, const size_t* lens, uint8_t* const* out,
+                               size_t n) const {
+    vector<const HmacSM3*> keys(n, this);
+    hmac_sm3_batch(keys.data(), data, lens, out, n);
+}
 
-        tree.resize(2 * tree_size);
-        for (size_t i = 0; i < n; i++) {
-            tree[tree_size + i] = hash_leaf(leaves[i]);
+// ============================== SM3 密钥派生函数 ==============================
+// GB/T 32918 中的 KDF：K = SM3(Z || ct_1) || SM3(Z || ct_2) || ...，ct 为从 1 开始的 32 比特大端计数器，
+// 截取前 klen 字节。Z 的整块只压缩一次，每个计数器从这一中间状态补上 ct 与填充，每 SM3_MB_LANES 个一组多缓冲计算
+inline void sm3_kdf(const uint8_t* z, size_t zlen, uint8_t* out, size_t klen) {
+    if ((uint64_t)klen > (uint64_t)0xFFFFFFFF * 32) throw invalid_argument("KDF output too long");
+    SM3Midstate base;
+    base.update(z, zlen);
+    size_t blocks = (klen + 31) / 32;
+
+    // 计数器 ct 对应的末尾块，返回块数；V 为压缩这些块前的状态。
+    // Z 的残余块为 60..63 字节时 ct 会把它填满并先压缩一次，此时 V 不再等于 base.state
+    auto tail = [&](uint32_t ct, uint8_t t[128], uint32_t V[8]) {
+        uint8_t c[4];
+        sm3_core::store_be32(c, ct);
+        SM3Midstate m = base;
+        m.update(c, 4);
+        memcpy(V, m.state, 8 * sizeof(uint32_t));
+        return m.final_blocks(t);
+    };
+
+    size_t i = 0;
+#if SM3_MB_LANES > 1
+    const size_t L = sm3_mb::LANES;
+    uint32_t lane_states[sm3_mb::LANES][8];
+    const uint32_t* states[sm3_mb::LANES];
+    for (size_t l = 0; l < L; l++) states[l] = lane_states[l];
+    for (; i + L <= blocks; i += L) {
+        uint8_t tails[sm3_mb::LANES][128], last[32];
+        const uint8_t* bp[sm3_mb::LANES];
+        uint8_t* op[sm3_mb::LANES];
+        size_t nblocks = 0;
+        for (size_t l = 0; l < L; l++) {
+            nblocks = tail((uint32_t)(i + l + 1), tails[l], lane_states[l]);
+            op[l] = out + (i + l) * 32;
         }
-        for (size_t i = n; i < tree_size; i++) {
-            tree[tree_size + i] = vector<uint8_t>(32, 0);
+        // 输出长度不是 32 的整数倍时最后一个摘要写到临时缓冲再截取
+        bool partial = i + L == blocks && klen % 32 != 0;
+        if (partial) op[L - 1] = last;
+
+        sm3_mb::vec V[8];
+        sm3_mb::load(V, states);
+        for (size_t k = 0; k < nblocks; k++) {
+            for (size_t l = 0; l < L; l++) bp[l] = tails[l] + k * 64;
+            sm3_mb::compress(V, bp);
         }
+        sm3_mb::store(V, op);
+        if (partial) memcpy(out + (blocks - 1) * 32, last, klen % 32);
+    }
+#endif
+    for (; i < blocks; i++) {
+        uint8_t t[128], h[32];
+        uint32_t V[8];
+        size_t nblocks = tail((uint32_t)(i + 1), t, V);
+        sm3_core::compress_blocks(V, t, nblocks);
+        for (int w = 0; w < 8; w++) sm3_core::store_be32(h + w * 4, V[w]);
+        memcpy(out + i * 32, h, min<size_t>(32, klen - i * 32));
+    }
+}
 
-        // 
-        for (size_t i = tree_size - 1; i > 0; i--) {
-            tree[i] = hash_node(tree[2 * i], tree[2 * i + 1]);
-        }
+inline vector<uint8_t> sm3_kdf(const vector<uint8_t>& z, size_t klen) {
+    vector<uint8_t> out(klen);
+    sm3_kdf(z.data(), z.size(), out.data(), klen);
+    return out;
+}
+
+// ============================== SM2 数字签名 (GB/T 32918.2) ==============================
+// 推荐曲线 y^2 = x^3 - 3x + b，p = 2^256 - 2^224 - 2^96 + 2^64 - 1。
+// 域元素为 4 个 64 位小端字，乘积按 p 的特殊形式做 Solinas 约减（以 32 位字的小系数线性组合代替除法）；
+// 模 n 运算用 Montgomery 乘法。点运算在雅可比坐标下进行，倍点用 a = -3 的公式。
+// 签名与密钥生成的 k·G 查预计算表 sm2_gtable.h：k 拆成 52 个 5 位带符号奇数位，每位常量时间查表后做一次
+// 混合加法，不需要倍点；一般点的 k·P 用定长带符号窗口（窗口宽 4）。两者运算序列都与 k 无关。
+// 验签的 s·G + t·P_A 只涉及公开数据，用交错 wNAF 计算。Z_A 与 e 由 OptimizedSM3 计算。
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+#include "sm2_gtable.h"
+
+namespace sm2 {
+
+    struct u256 { uint64_t v[4]; };     // 小端 64 位字；域元素与标量通用
+
+    static const u256 P = { { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFF00000000ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFEFFFFFFFFull } };
+    static const u256 N = { { 0x53BBF40939D54123ull, 0x7203DF6B21C6052Bull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFEFFFFFFFFull } };
+    static const u256 B = { { 0xDDBCBD414D940E93ull, 0xF39789F515AB8F92ull, 0x4D5A9E4BCF6509A7ull, 0x28E9FA9E9D9F5E34ull } };
+    static const u256 GX = { { 0x715A4589334C74C7ull, 0x8FE30BBFF2660BE1ull, 0x5F9904466A39C994ull, 0x32C4AE2C1F198119ull } };
+    static const u256 GY = { { 0x02DF32E52139F0A0ull, 0xD0A9877CC62A4740ull, 0x59BDCEE36B692153ull, 0xBC3736A2F4F6779Cull } };
+    static const u256 N_R2 = { { 0x901192AF7C114F20ull, 0x3464504ADE6FA2FAull, 0x620FC84C3AFFE0D4ull, 0x1EB5E412A22B3D3Bull } };
+    static const uint64_t N0INV = 0x327F9E8872350975ull;   // -n^-1 mod 2^64
+
+    // ---------- 256 位基本运算（无分支） ----------
+    // x86-64 上用带进位加减指令串成一条进位链；其他平台用比较求进位
+    static SM3_INLINE uint64_t addc(uint64_t a, uint64_t b, uint64_t& carry) {
+#if defined(_M_X64) || defined(__x86_64__)
+        unsigned long long r;
+        carry = _addcarry_u64((unsigned char)carry, a, b, &r);
+        return r;
+#else
+        uint64_t s = a + carry;
+        uint64_t c = s < carry;
+        s += b;
+        carry = c | (s < b);
+        return s;
+#endif
     }
 
-    vector<uint8_t> root() const {
-        return tree.empty() ? vector<uint8_t>(32, 0) : tree[1];
+    static SM3_INLINE uint64_t subb(uint64_t a, uint64_t b, uint64_t& borrow) {
+#if defined(_M_X64) || defined(__x86_64__)
+        unsigned long long r;
+        borrow = _subborrow_u64((unsigned char)borrow, a, b, &r);
+        return r;
+#else
+        uint64_t t = a - b;
+        uint64_t c = a < b;
+        uint64_t d = t - borrow;
+        borrow = c | (t < borrow);
+        return d;
+#endif
     }
 
-    // ֤
-    vector<vector<uint8_t>> proof(size_t index) const {
-        vector<vector<uint8_t>> proof;
-        if (tree.empty()) return proof;
+    static SM3_INLINE uint64_t mul64(uint64_t a, uint64_t b, uint64_t& hi) {
+#if defined(_MSC_VER)
+        return _umul128(a, b, &hi);
+#else
+        unsigned __int128 t = (unsigned __int128)a * b;
+        hi = (uint64_t)(t >> 64);
+        return (uint64_t)t;
+#endif
+    }
 
-        size_t n = tree.size() / 2;
-        if (index >= n) throw out_of_range("Index out of range");
+    // 4 个字手工展开，便于编译器把整条进位链留在寄存器中
+    static SM3_INLINE uint64_t add256(u256& r, const u256& a, const u256& b) {
+        uint64_t c = 0;
+        r.v[0] = addc(a.v[0], b.v[0], c);
+        r.v[1] = addc(a.v[1], b.v[1], c);
+        r.v[2] = addc(a.v[2], b.v[2], c);
+        r.v[3] = addc(a.v[3], b.v[3], c);
+        return c;
+    }
 
-        size_t pos = n + index;
+    static SM3_INLINE uint64_t sub256(u256& r, const u256& a, const u256& b) {
+        uint64_t c = 0;
+        r.v[0] = subb(a.v[0], b.v[0], c);
+        r.v[1] = subb(a.v[1], b.v[1], c);
+        r.v[2] = subb(a.v[2], b.v[2], c);
+        r.v[3] = subb(a.v[3], b.v[3], c);
+        return c;
+    }
 
-        while (pos > 1) {
-            proof.push_back(tree[pos ^ 1]);
-            pos /= 2;
-        }
+    // mask 为全 1 时 r = a
+    static SM3_INLINE void cmov(u256& r, const u256& a, uint64_t mask) {
+        r.v[0] ^= (r.v[0] ^ a.v[0]) & mask;
+        r.v[1] ^= (r.v[1] ^ a.v[1]) & mask;
+        r.v[2] ^= (r.v[2] ^ a.v[2]) & mask;
+        r.v[3] ^= (r.v[3] ^ a.v[3]) & mask;
+    }
 
-        return proof;
+    static inline uint64_t is_zero(const u256& a) {
+        uint64_t t = a.v[0] | a.v[1] | a.v[2] | a.v[3];
+        return 1 ^ ((t | (0 - t)) >> 63);
     }
 
-    // ֤֤
-    static bool verify(
-        const vector<uint8_t>& leaf,
-        const vector<uint8_t>& root,
-        size_t index,
-        size_t tree_size,
-        const vector<vector<uint8_t>>& proof
-    ) {
-        vector<uint8_t> current = hash_leaf(leaf);
-        size_t n = 1;
-        while (n < tree_size) n <<= 1;
-        size_t pos = n + index;
+    static inline bool equal(const u256& a, const u256& b) {
+        return ((a.v[0] ^ b.v[0]) | (a.v[1] ^ b.v[1]) | (a.v[2] ^ b.v[2]) | (a.v[3] ^ b.v[3])) == 0;
+    }
 
-        for (const auto& p : proof) {
-            if (pos % 2 == 1) {
-                current = hash_node(p, current);
-            }
-            else {
-                current = hash_node(current, p);
-            }
-            pos /= 2;
-        }
+    // a < m 时 a mod m 的加减法
+    static SM3_INLINE void mod_add(u256& r, const u256& a, const u256& b, const u256& m) {
+        u256 t, u;
+        uint64_t c = add256(t, a, b);
+        uint64_t bw = sub256(u, t, m);
+        r = t;
+        cmov(r, u, 0 - (c | (bw ^ 1)));
+    }
 
-        return current == root;
+    static SM3_INLINE void mod_sub(u256& r, const u256& a, const u256& b, const u256& m) {
+        u256 t, u;
+        uint64_t bw = sub256(t, a, b);
+        add256(u, t, m);
+        r = t;
+        cmov(r, u, 0 - bw);
     }
 
-    // ɲ֤ 
-    pair<vector<vector<uint8_t>>, vector<vector<uint8_t>>> absence_proof(
-        const vector<uint8_t>& target,
-        size_t& insert_pos
-    ) const {
-        if (tree.empty()) {
-            insert_pos = 0;
-            return { {}, {} };
+    // x < 2m 时归约到 [0, m)
+    static SM3_INLINE void reduce_once(u256& r, const u256& x, const u256& m) {
+        u256 u;
+        uint64_t bw = sub256(u, x, m);
+        r = x;
+        cmov(r, u, bw - 1);
+    }
+
+    // Comba 乘法：逐列累加到三字累加器 (c0, c1, c2)，列结束时输出 c0 并右移一个字
+    static SM3_INLINE void mac(uint64_t a, uint64_t b, uint64_t& c0, uint64_t& c1, uint64_t& c2) {
+        uint64_t hi, lo = mul64(a, b, hi), c = 0;
+        c0 = addc(c0, lo, c);
+        c1 = addc(c1, hi, c);
+        c2 += c;
+    }
+
+    // 累加 2ab（平方的交叉项）
+    static SM3_INLINE void mac2(uint64_t a, uint64_t b, uint64_t& c0, uint64_t& c1, uint64_t& c2) {
+        uint64_t hi, lo = mul64(a, b, hi), c = 0;
+        c0 = addc(c0, lo, c);
+        c1 = addc(c1, hi, c);
+        c2 += c;
+        c = 0;
+        c0 = addc(c0, lo, c);
+        c1 = addc(c1, hi, c);
+        c2 += c;
+    }
+
+    static SM3_INLINE void col(uint64_t& out, uint64_t& c0, uint64_t& c1, uint64_t& c2) {
+        out = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+    }
+
+    static SM3_INLINE void mul_wide(uint64_t t[8], const u256& a, const u256& b) {
+        const uint64_t* x = a.v;
+        const uint64_t* y = b.v;
+        uint64_t c0 = 0, c1 = 0, c2 = 0;
+        mac(x[0], y[0], c0, c1, c2);
+        col(t[0], c0, c1, c2);
+        mac(x[0], y[1], c0, c1, c2); mac(x[1], y[0], c0, c1, c2);
+        col(t[1], c0, c1, c2);
+        mac(x[0], y[2], c0, c1, c2); mac(x[1], y[1], c0, c1, c2); mac(x[2], y[0], c0, c1, c2);
+        col(t[2], c0, c1, c2);
+        mac(x[0], y[3], c0, c1, c2); mac(x[1], y[2], c0, c1, c2); mac(x[2], y[1], c0, c1, c2); mac(x[3], y[0], c0, c1, c2);
+        col(t[3], c0, c1, c2);
+        mac(x[1], y[3], c0, c1, c2); mac(x[2], y[2], c0, c1, c2); mac(x[3], y[1], c0, c1, c2);
+        col(t[4], c0, c1, c2);
+        mac(x[2], y[3], c0, c1, c2); mac(x[3], y[2], c0, c1, c2);
+        col(t[5], c0, c1, c2);
+        mac(x[3], y[3], c0, c1, c2);
+        t[6] = c0;
+        t[7] = c1;
+    }
+
+    // 交叉项只乘一次：10 次乘法
+    static SM3_INLINE void sqr_wide(uint64_t t[8], const u256& a) {
+        const uint64_t* x = a.v;
+        uint64_t c0 = 0, c1 = 0, c2 = 0;
+        mac(x[0], x[0], c0, c1, c2);
+        col(t[0], c0, c1, c2);
+        mac2(x[0], x[1], c0, c1, c2);
+        col(t[1], c0, c1, c2);
+        mac2(x[0], x[2], c0, c1, c2); mac(x[1], x[1], c0, c1, c2);
+        col(t[2], c0, c1, c2);
+        mac2(x[0], x[3], c0, c1, c2); mac2(x[1], x[2], c0, c1, c2);
+        col(t[3], c0, c1, c2);
+        mac2(x[1], x[3], c0, c1, c2); mac(x[2], x[2], c0, c1, c2);
+        col(t[4], c0, c1, c2);
+        mac2(x[2], x[3], c0, c1, c2);
+        col(t[5], c0, c1, c2);
+        mac(x[3], x[3], c0, c1, c2);
+        t[6] = c0;
+        t[7] = c1;
+    }
+
+    // ---------- 模 p 运算 ----------
+    // Solinas 约减：以 2^32 为基，x^8 ≡ x^7 + x^3 - x^2 + 1 (mod p)，乘积的高 8 个字 c8..c15
+    // 各自折算为低 8 个字上的小整数系数。按字汇总系数（唯一的负项在第 2 个字），拼成 64 位字后
+    // 与低半部分做三条加减进位链；溢出的高位再按 2^256 ≡ 2^224 + 2^96 - 2^64 + 1 折回两次，最后减一次 p
+    static SM3_INLINE void fe_reduce(u256& r, const uint64_t t[8]) {
+        uint64_t c8 = t[4] & 0xFFFFFFFF, c9 = t[4] >> 32, c10 = t[5] & 0xFFFFFFFF, c11 = t[5] >> 32;
+        uint64_t c12 = t[6] & 0xFFFFFFFF, c13 = t[6] >> 32, c14 = t[7] & 0xFFFFFFFF, c15 = t[7] >> 32;
+        uint64_t w0 = c8 + c9 + c10 + c11 + c12 + 2 * (c13 + c14 + c15);
+        uint64_t w1 = c9 + c10 + c11 + c12 + c13 + 2 * (c14 + c15);
+        uint64_t w2 = c8 + c9 + c13 + c14;     // 取负
+        uint64_t w3 = c8 + c11 + c12 + 2 * c13 + c14 + c15;
+        uint64_t w4 = c9 + c12 + c13 + 2 * c14 + c15;
+        uint64_t w5 = c10 + c13 + c14 + 2 * c15;
+        uint64_t w6 = c11 + c14 + c15;
+        uint64_t w7 = c8 + c9 + c10 + c11 + 2 * (c12 + c13 + c14) + 3 * c15;
+
+        // 各 w 不超过 2^36：奇数字左移 32 位后跨入下一个 64 位字，与相邻偶数字的低 32 位不重叠
+        u256 x = { { t[0], t[1], t[2], t[3] } };
+        const u256 odd = { { w1 << 32, (w3 << 32) | (w1 >> 32), (w5 << 32) | (w3 >> 32), (w7 << 32) | (w5 >> 32) } };
+        const u256 even = { { w0, 0, w4, w6 } };
+        const u256 neg = { { 0, w2, 0, 0 } };
+        uint64_t top = w7 >> 32;
+        top += add256(x, x, odd);
+        top += add256(x, x, even);
+        top -= sub256(x, x, neg);           // 各行折算值均为正，总和不会小于 0
+
+        for (int round = 0; round < 2; round++) {
+            const u256 f = { { top, (top << 32) - top, 0, top << 32 } };
+            top = add256(x, x, f);
         }
+        reduce_once(r, x, P);
+    }
 
-        // Ҷӽڵжλλ
-        size_t n = tree.size() / 2;
-        size_t low = 0, high = n;
-        insert_pos = n; 
+    static SM3_INLINE void fe_mul(u256& r, const u256& a, const u256& b) {
+        uint64_t t[8];
+        mul_wide(t, a, b);
+        fe_reduce(r, t);
+    }
+
+    static SM3_INLINE void fe_sqr(u256& r, const u256& a) {
+        uint64_t t[8];
+        sqr_wide(t, a);
+        fe_reduce(r, t);
+    }
+
+    static SM3_INLINE void fe_add(u256& r, const u256& a, const u256& b) { mod_add(r, a, b, P); }
+    static SM3_INLINE void fe_sub(u256& r, const u256& a, const u256& b) { mod_sub(r, a, b, P); }
+
+    static inline void fe_sqr_n(u256& r, const u256& a, int n) {
+        fe_sqr(r, a);
+        for (int i = 1; i < n; i++) fe_sqr(r, r);
+    }
+
+    // a^(p-2)，p-2 = [31 个 1][0][128 个 1][32 个 0][62 个 1][0][1]；256 次平方 + 14 次乘法
+    static inline void fe_inv(u256& r, const u256& a) {
+        u256 x2, x3, x6, x12, x24, x30, x31, x32, t;
+        fe_sqr(x2, a);           fe_mul(x2, x2, a);
+        fe_sqr(x3, x2);          fe_mul(x3, x3, a);
+        fe_sqr_n(x6, x3, 3);     fe_mul(x6, x6, x3);
+        fe_sqr_n(x12, x6, 6);    fe_mul(x12, x12, x6);
+        fe_sqr_n(x24, x12, 12);  fe_mul(x24, x24, x12);
+        fe_sqr_n(x30, x24, 6);   fe_mul(x30, x30, x6);
+        fe_sqr(x31, x30);        fe_mul(x31, x31, a);
+        fe_sqr(x32, x31);        fe_mul(x32, x32, a);
+        fe_sqr(t, x31);
+        for (int i = 0; i < 4; i++) {
+            fe_sqr_n(t, t, 32);
+            fe_mul(t, t, x32);
+        }
+        fe_sqr_n(t, t, 64);
+        fe_mul(t, t, x32);
+        fe_sqr_n(t, t, 30);
+        fe_mul(t, t, x30);
+        fe_sqr_n(t, t, 2);
+        fe_mul(r, t, a);
+    }
+
+    static inline void from_bytes(u256& r, const uint8_t in[32]) {
+        for (int i = 0; i < 4; i++) {
+            uint64_t w = 0;
+            for (int k = 0; k < 8; k++) w = (w << 8) | in[(3 - i) * 8 + k];
+            r.v[i] = w;
+        }
+    }
+
+    static inline void to_bytes(uint8_t out[32], const u256& a) {
+        for (int i = 0; i < 4; i++) {
+            for (int k = 0; k < 8; k++) out[(3 - i) * 8 + k] = (uint8_t)(a.v[i] >> (56 - 8 * k));
+        }
+    }
+
+    static inline bool less_than(const u256& a, const u256& m) {
+        u256 t;
+        return sub256(t, a, m) != 0;
+    }
+
+    // ---------- 模 n 运算（Montgomery，R = 2^256） ----------
+    static inline void sc_mont_mul(u256& r, const u256& a, const u256& b) {
+        uint64_t t[9];
+        mul_wide(t, a, b);
+        t[8] = 0;
+        for (int i = 0; i < 4; i++) {
+            uint64_t m = t[i] * N0INV, carry = 0;
+            for (int j = 0; j < 4; j++) {
+                uint64_t hi, lo = mul64(m, N.v[j], hi);
+                lo += t[i + j];
+                hi += lo < t[i + j];
+                lo += carry;
+                hi += lo < carry;
+                t[i + j] = lo;
+                carry = hi;
+            }
+            for (int k = i + 4; k < 9; k++) {
+                t[k] += carry;
+                carry = t[k] < carry;
+            }
+        }
+        // 结果 < 2n，t[8] 为 2^256 位
+        u256 x = { { t[4], t[5], t[6], t[7] } }, u;
+        uint64_t bw = sub256(u, x, N);
+        r = x;
+        cmov(r, u, 0 - (t[8] | (bw ^ 1)));
+    }
+
+    static inline void sc_to_mont(u256& r, const u256& a) { sc_mont_mul(r, a, N_R2); }
+
+    static inline void sc_from_mont(u256& r, const u256& a) {
+        static const u256 one = { { 1, 0, 0, 0 } };
+        sc_mont_mul(r, a, one);
+    }
+
+    // Montgomery 域内求逆：a^(n-2)，指数公开，逐位平方-乘
+    static inline void sc_inv_mont(u256& r, const u256& a) {
+        u256 e, x;
+        static const u256 two = { { 2, 0, 0, 0 } };
+        sub256(e, N, two);
+        sc_to_mont(x, u256{ { 1, 0, 0, 0 } });
+        for (int i = 255; i >= 0; i--) {
+            sc_mont_mul(x, x, x);
+            if ((e.v[i / 64] >> (i % 64)) & 1) sc_mont_mul(x, x, a);
+        }
+        r = x;
+    }
+
+    // ---------- 点运算 ----------
+    struct jpoint { u256 X, Y, Z; };    // 雅可比坐标，Z = 0 为无穷远点
+    struct apoint { u256 x, y; };
+
+    // dbl-2001-b（a = -3）：3M + 5S；无穷远点自然得到 Z3 = 0
+    static inline void point_double(jpoint& r, const jpoint& p) {
+        u256 delta, gamma, beta, alpha, t, u;
+        fe_sqr(delta, p.Z);
+        fe_sqr(gamma, p.Y);
+        fe_mul(beta, p.X, gamma);
+        fe_sub(t, p.X, delta);
+        fe_add(u, p.X, delta);
+        fe_mul(alpha, t, u);
+        fe_add(t, alpha, alpha);
+        fe_add(alpha, alpha, t);
+        fe_add(t, p.Y, p.Z);
+        fe_sqr(t, t);
+        fe_sub(t, t, gamma);
+        fe_sub(r.Z, t, delta);
+        fe_add(beta, beta, beta);
+        fe_add(beta, beta, beta);          // 4·beta
+        fe_sqr(t, alpha);
+        fe_add(u, beta, beta);
+        fe_sub(r.X, t, u);
+        fe_sub(t, beta, r.X);
+        fe_mul(t, alpha, t);
+        fe_sqr(gamma, gamma);
+        fe_add(gamma, gamma, gamma);
+        fe_add(gamma, gamma, gamma);
+        fe_add(gamma, gamma, gamma);       // 8·gamma^2
+        fe_sub(r.Y, t, gamma);
+    }
+
+    // add-2007-bl：11M + 5S。两点相同时转为倍点、互为相反点时得到无穷远点；
+    // 签名路径中这些分支只在 k ≡ 2d (mod n)、|d| <= 15 时可能出现
+    static inline void point_add(jpoint& r, const jpoint& p, const jpoint& q) {
+        if (is_zero(p.Z)) { r = q; return; }
+        if (is_zero(q.Z)) { r = p; return; }
+        u256 z1z1, z2z2, u1, u2, s1, s2, h, i, j, rr, v, t;
+        fe_sqr(z1z1, p.Z);
+        fe_sqr(z2z2, q.Z);
+        fe_mul(u1, p.X, z2z2);
+        fe_mul(u2, q.X, z1z1);
+        fe_mul(t, q.Z, z2z2);
+        fe_mul(s1, p.Y, t);
+        fe_mul(t, p.Z, z1z1);
+        fe_mul(s2, q.Y, t);
+        fe_sub(h, u2, u1);
+        fe_sub(rr, s2, s1);
+        if (is_zero(h)) {
+            if (is_zero(rr)) {
+                point_double(r, p);
+            }
+            else {
+                r.X = r.Y = u256{ { 1, 0, 0, 0 } };
+                r.Z = u256{ { 0, 0, 0, 0 } };
+            }
+            return;
+        }
+        fe_add(rr, rr, rr);
+        fe_add(i, h, h);
+        fe_sqr(i, i);
+        fe_mul(j, h, i);
+        fe_mul(v, u1, i);
+        fe_add(t, p.Z, q.Z);
+        fe_sqr(t, t);
+        fe_sub(t, t, z1z1);
+        fe_sub(t, t, z2z2);
+        fe_mul(r.Z, t, h);
+        fe_sqr(t, rr);
+        fe_sub(t, t, j);
+        fe_sub(t, t, v);
+        fe_sub(r.X, t, v);
+        fe_sub(t, v, r.X);
+        fe_mul(t, rr, t);
+        fe_mul(s1, s1, j);
+        fe_add(s1, s1, s1);
+        fe_sub(r.Y, t, s1);
+    }
+
+    // madd-2007-bl（第二个点为仿射坐标，Z2 = 1）：7M + 4S。p 不能是无穷远点；
+    // 两点相同或互为相反点时同 point_add 处理，固定基乘法中只在 k ≡ ±(2^256 - n) (mod n) 时出现
+    static inline void point_add_mixed(jpoint& r, const jpoint& p, const apoint& q) {
+        u256 z1z1, u2, s2, h, hh, i, j, rr, v, yj, t;
+        fe_sqr(z1z1, p.Z);
+        fe_mul(u2, q.x, z1z1);
+        fe_mul(t, p.Z, z1z1);
+        fe_mul(s2, q.y, t);
+        fe_sub(h, u2, p.X);
+        fe_sub(rr, s2, p.Y);
+        if (is_zero(h)) {
+            if (is_zero(rr)) {
+                point_double(r, p);
+            }
+            else {
+                r.X = r.Y = u256{ { 1, 0, 0, 0 } };
+                r.Z = u256{ { 0, 0, 0, 0 } };
+            }
+            return;
+        }
+        fe_add(rr, rr, rr);
+        fe_sqr(hh, h);
+        fe_add(i, hh, hh);
+        fe_add(i, i, i);
+        fe_mul(j, h, i);
+        fe_mul(v, p.X, i);
+        fe_mul(yj, p.Y, j);
+        fe_add(t, p.Z, h);
+        fe_sqr(t, t);
+        fe_sub(t, t, z1z1);
+        fe_sub(r.Z, t, hh);
+        fe_sqr(t, rr);
+        fe_sub(t, t, j);
+        fe_sub(t, t, v);
+        fe_sub(r.X, t, v);
+        fe_sub(t, v, r.X);
+        fe_mul(t, rr, t);
+        fe_add(yj, yj, yj);
+        fe_sub(r.Y, t, yj);
+    }
+
+    static inline void point_neg(jpoint& r, const jpoint& p) {
+        r = p;
+        fe_sub(r.Y, u256{ { 0, 0, 0, 0 } }, p.Y);
+    }
+
+    static inline void to_affine(apoint& r, const jpoint& p) {
+        u256 zi, zi2;
+        fe_inv(zi, p.Z);
+        fe_sqr(zi2, zi);
+        fe_mul(r.x, p.X, zi2);
+        fe_mul(zi2, zi2, zi);
+        fe_mul(r.y, p.Y, zi2);
+    }
+
+    static inline jpoint from_affine(const apoint& a) {
+        return jpoint{ a.x, a.y, u256{ { 1, 0, 0, 0 } } };
+    }
+
+    // y^2 = x^3 - 3x + b，且坐标在 [0, p)
+    static inline bool on_curve(const apoint& a) {
+        if (!less_than(a.x, P) || !less_than(a.y, P)) return false;
+        u256 l, r, t;
+        fe_sqr(l, a.y);
+        fe_sqr(r, a.x);
+        fe_mul(r, r, a.x);
+        fe_add(t, a.x, a.x);
+        fe_add(t, t, a.x);
+        fe_sub(r, r, t);
+        fe_add(r, r, B);
+        return equal(l, r);
+    }
+
+    // table[i] = (2i+1)·P，i = 0..7
+    static inline void odd_multiples(jpoint table[8], const jpoint& p) {
+        jpoint p2;
+        point_double(p2, p);
+        table[0] = p;
+        for (int i = 1; i < 8; i++) point_add(table[i], table[i - 1], p2);
+    }
+
+    // 常量时间取 table[idx]：遍历全部表项按掩码选择
+    static inline void lookup(jpoint& r, const jpoint table[8], uint64_t idx) {
+        r = table[0];
+        for (uint64_t i = 1; i < 8; i++) {
+            uint64_t mask = 0 - (((i ^ idx) - 1) >> 63);
+            cmov(r.X, table[i].X, mask);
+            cmov(r.Y, table[i].Y, mask);
+            cmov(r.Z, table[i].Z, mask);
+        }
+    }
+
+    static inline void cneg(jpoint& p, uint64_t neg) {
+        u256 ny;
+        fe_sub(ny, u256{ { 0, 0, 0, 0 } }, p.Y);
+        cmov(p.Y, ny, 0 - neg);
+    }
+
+    static inline void cneg(apoint& p, uint64_t neg) {
+        u256 ny;
+        fe_sub(ny, u256{ { 0, 0, 0, 0 } }, p.y);
+        cmov(p.y, ny, 0 - neg);
+    }
+
+    // 常量时间 k·P（k ∈ [1, n-1]，table 为 odd_multiples 的结果）。
+    // k 为偶数时改算 (n-k)·P 再取负，使 k 为奇数；奇数 k 按 k_i = (k_{i-1} mod 32) - 16 逐窗口拆成
+    // 64 个奇数位 ±1..±15 与最高位 1 或 3，每个窗口固定 4 次倍点、1 次查表与 1 次点加
+    static inline void scalar_mult_ct(jpoint& r, const u256& k, const jpoint table[8]) {
+        u256 kk = k, nk;
+        sub256(nk, N, k);
+        uint64_t neg = (k.v[0] & 1) ^ 1;
+        cmov(kk, nk, 0 - neg);
+
+        int8_t digits[65];
+        for (int i = 0; i < 64; i++) {
+            digits[i] = (int8_t)((int)(kk.v[0] & 31) - 16);
+            // kk = (kk >> 5) * 2 + 1
+            for (int w = 0; w < 3; w++) kk.v[w] = (kk.v[w] >> 4) | (kk.v[w + 1] << 60);
+            kk.v[3] >>= 4;
+            kk.v[0] = (kk.v[0] & ~(uint64_t)1) | 1;
+        }
+        digits[64] = (int8_t)kk.v[0];
+
+        jpoint q;
+        lookup(r, table, (uint64_t)(digits[64] - 1) >> 1);
+        for (int i = 63; i >= 0; i--) {
+            for (int d = 0; d < 4; d++) point_double(r, r);
+            int64_t di = digits[i];
+            uint64_t s = (uint64_t)di >> 63;
+            uint64_t a = (uint64_t)((di ^ -(int64_t)s) + (int64_t)s);
+            lookup(q, table, (a - 1) >> 1);
+            cneg(q, s);
+            point_add(r, r, q);
+        }
+        cneg(r, neg);
+    }
+
+    // ---------- 固定基 k·G ----------
+    // SM2_G_TABLE[i][j] = (2j+1)·2^(5i)·G 的仿射坐标，由 compute_g_table 用通用点运算算出，
+    // 经 `SM3 gen-sm2-table > sm2_gtable.h` 写成常量数组随源码提交
+    static const int G_WINDOWS = 52;
+    static const int G_ENTRIES = 16;
+    static_assert(sizeof(SM2_G_TABLE) == sizeof(uint64_t) * 8 * G_ENTRIES * G_WINDOWS,
+                  "sm2_gtable.h does not match G_WINDOWS / G_ENTRIES; regenerate it");
+
+    // 结果按 SM2_G_TABLE 的顺序平铺：table[i * G_ENTRIES + j]
+    static void compute_g_table(apoint* table) {
+        jpoint base = from_affine(apoint{ GX, GY }), p2, t;
+        for (int i = 0; i < G_WINDOWS; i++) {
+            point_double(p2, base);
+            t = base;
+            for (int j = 0; j < G_ENTRIES; j++) {
+                if (j) point_add(t, t, p2);
+                to_affine(table[i * G_ENTRIES + j], t);
+            }
+            for (int d = 0; d < 5; d++) point_double(base, base);
+        }
+    }
+
+    static void write_g_table(FILE* out) {
+        vector<apoint> table(G_WINDOWS * G_ENTRIES);
+        compute_g_table(table.data());
+        fprintf(out, "// 由 `SM3 gen-sm2-table > sm2_gtable.h` 生成，请勿手工修改。\n");
+        fprintf(out, "// SM2_G_TABLE[i][j] = (2j+1)·2^(5i)·G 的仿射坐标 x、y，各为 4 个 64 位小端字\n");
+        fprintf(out, "#ifndef SM2_GTABLE_H\n#define SM2_GTABLE_H\n\n#include <stdint.h>\n\n");
+        fprintf(out, "alignas(64) static const uint64_t SM2_G_TABLE[%d][%d][8] = {\n", G_WINDOWS, G_ENTRIES);
+        for (int i = 0; i < G_WINDOWS; i++) {
+            fprintf(out, "    {   // 2^%d·G\n", 5 * i);
+            for (int j = 0; j < G_ENTRIES; j++) {
+                const apoint& a = table[i * G_ENTRIES + j];
+                fprintf(out, "        {");
+                for (int w = 0; w < 8; w++) {
+                    fprintf(out, "%s0x%016llX", w ? ", " : " ", (unsigned long long)(w < 4 ? a.x.v[w] : a.y.v[w - 4]));
+                }
+                fprintf(out, " },\n");
+            }
+            fprintf(out, "    },\n");
+        }
+        fprintf(out, "};\n\n#endif\n");
+    }
+
+    // 常量时间取 SM2_G_TABLE[w][idx]
+    static inline void lookup_g(apoint& r, int w, uint64_t idx) {
+        const uint64_t (*row)[8] = SM2_G_TABLE[w];
+        for (int k = 0; k < 4; k++) {
+            r.x.v[k] = row[0][k];
+            r.y.v[k] = row[0][k + 4];
+        }
+        for (uint64_t i = 1; i < (uint64_t)G_ENTRIES; i++) {
+            uint64_t mask = 0 - (((i ^ idx) - 1) >> 63);
+            for (int k = 0; k < 4; k++) {
+                r.x.v[k] ^= (r.x.v[k] ^ row[i][k]) & mask;
+                r.y.v[k] ^= (r.y.v[k] ^ row[i][k + 4]) & mask;
+            }
+        }
+    }
+
+    // 常量时间 k·G（k ∈ [1, n-1]）。与 scalar_mult_ct 相同地把 k 变为奇数，再按 k_i = (k_{i-1} mod 64) - 32
+    // 拆成 51 个奇数位 ±1..±31 与最高位 1 或 3；第 i 位从 SM2_G_TABLE[i] 取值，从低位起累加，
+    // 共 51 次混合加法，没有倍点
+    static inline void scalar_mult_base(jpoint& r, const u256& k) {
+        u256 kk = k, nk;
+        sub256(nk, N, k);
+        uint64_t neg = (k.v[0] & 1) ^ 1;
+        cmov(kk, nk, 0 - neg);
+
+        int8_t digits[G_WINDOWS];
+        for (int i = 0; i < G_WINDOWS - 1; i++) {
+            digits[i] = (int8_t)((int)(kk.v[0] & 63) - 32);
+            // kk = (kk >> 6) * 2 + 1
+            for (int w = 0; w < 3; w++) kk.v[w] = (kk.v[w] >> 5) | (kk.v[w + 1] << 59);
+            kk.v[3] >>= 5;
+            kk.v[0] |= 1;
+        }
+        digits[G_WINDOWS - 1] = (int8_t)kk.v[0];
+
+        apoint q;
+        for (int i = 0; i < G_WINDOWS; i++) {
+            int64_t di = digits[i];
+            uint64_t s = (uint64_t)di >> 63;
+            uint64_t a = (uint64_t)((di ^ -(int64_t)s) + (int64_t)s);
+            lookup_g(q, i, (a - 1) >> 1);
+            cneg(q, s);
+            if (i == 0) r = from_affine(q);
+            else point_add_mixed(r, r, q);
+        }
+        cneg(r, neg);
+    }
+
+    // 宽度 5 的 wNAF（变长，仅用于公开标量），返回位数
+    static inline int wnaf(int8_t out[257], u256 k) {
+        int len = 0;
+        while (!is_zero(k)) {
+            int d = 0;
+            if (k.v[0] & 1) {
+                d = (int)(k.v[0] & 31);
+                if (d >= 16) d -= 32;
+                u256 t = { { (uint64_t)(d < 0 ? -d : d), 0, 0, 0 } };
+                if (d < 0) add256(k, k, t);
+                else sub256(k, k, t);
+            }
+            out[len++] = (int8_t)d;
+            for (int w = 0; w < 3; w++) k.v[w] = (k.v[w] >> 1) | (k.v[w + 1] << 63);
+            k.v[3] >>= 1;
+        }
+        return len;
+    }
+
+    static const jpoint* g_odd_multiples() {
+        static const struct Table {
+            jpoint t[8];
+            Table() { odd_multiples(t, from_affine(apoint{ GX, GY })); }
+        } table;
+        return table.t;
+    }
+
+    // u1·G + u2·Q（交错 wNAF，变长）
+    static inline void double_mult(jpoint& r, const u256& u1, const u256& u2, const jpoint qtable[8]) {
+        const jpoint* gtable = g_odd_multiples();
+        int8_t n1[257], n2[257];
+        int l1 = wnaf(n1, u1), l2 = wnaf(n2, u2);
+        r.X = r.Y = u256{ { 1, 0, 0, 0 } };
+        r.Z = u256{ { 0, 0, 0, 0 } };
+        jpoint t;
+        for (int i = max(l1, l2) - 1; i >= 0; i--) {
+            point_double(r, r);
+            if (i < l1 && n1[i]) {
+                if (n1[i] > 0) point_add(r, r, gtable[n1[i] >> 1]);
+                else { point_neg(t, gtable[(-n1[i]) >> 1]); point_add(r, r, t); }
+            }
+            if (i < l2 && n2[i]) {
+                if (n2[i] > 0) point_add(r, r, qtable[n2[i] >> 1]);
+                else { point_neg(t, qtable[(-n2[i]) >> 1]); point_add(r, r, t); }
+            }
+        }
+    }
+
+    // [1, n-1] 内的均匀随机标量（拒绝采样）
+    static inline void random_scalar(u256& k) {
+        static thread_local random_device rd;
+        do {
+            for (int i = 0; i < 4; i++) k.v[i] = ((uint64_t)rd() << 32) | rd();
+        } while (is_zero(k) || !less_than(k, N));
+    }
+
+} // namespace sm2
+
+static const char* const SM2_DEFAULT_ID = "1234567812345678";
+
+struct Sm2Signature {
+    uint8_t r[32];
+    uint8_t s[32];
+};
+
+class Sm2PublicKey {
+public:
+    // 坐标不在曲线上时抛出 invalid_argument
+    Sm2PublicKey(const uint8_t x[32], const uint8_t y[32], const string& id = SM2_DEFAULT_ID) {
+        sm2::apoint a;
+        sm2::from_bytes(a.x, x);
+        sm2::from_bytes(a.y, y);
+        if (!sm2::on_curve(a)) throw invalid_argument("SM2 public key is not on the curve");
+        init(a, id);
+    }
+
+    void x(uint8_t out[32]) const { memcpy(out, xb, 32); }
+    void y(uint8_t out[32]) const { memcpy(out, yb, 32); }
+    const uint8_t* za() const { return z; }
+
+    // e = SM3(Z_A || M)
+    void digest(const uint8_t* msg, size_t len, uint8_t e[32]) const {
+        OptimizedSM3 sm3;
+        sm3.update(z, 32);
+        sm3.update(msg, len);
+        auto h = sm3.digest();
+        memcpy(e, h.data(), 32);
+    }
+
+    bool verify(const uint8_t* msg, size_t len, const Sm2Signature& sig) const {
+        uint8_t e[32];
+        digest(msg, len, e);
+        return verify_digest(e, sig);
+    }
+
+    bool verify_digest(const uint8_t e[32], const Sm2Signature& sig) const {
+        using namespace sm2;
+        u256 r, s, ev, t;
+        from_bytes(r, sig.r);
+        from_bytes(s, sig.s);
+        if (is_zero(r) || !less_than(r, N) || is_zero(s) || !less_than(s, N)) return false;
+        mod_add(t, r, s, N);
+        if (is_zero(t)) return false;
+        jpoint R;
+        double_mult(R, s, t, table);
+        if (is_zero(R.Z)) return false;
+        // 要求 (e + x1) mod n == r，即 x1 ≡ r - e (mod n)；x1 < p 时候选值为 r - e 或 r - e + n。
+        // 与 X1 = x1·Z^2 比较，省去一次求逆
+        from_bytes(ev, e);
+        reduce_once(ev, ev, N);
+        u256 x, z2, xz;
+        mod_sub(x, r, ev, N);
+        fe_sqr(z2, R.Z);
+        fe_mul(xz, x, z2);
+        if (equal(xz, R.X)) return true;
+        if (add256(x, x, N) || !less_than(x, P)) return false;
+        fe_mul(xz, x, z2);
+        return equal(xz, R.X);
+    }
+
+private:
+    friend class Sm2PrivateKey;
+    Sm2PublicKey() {}
+
+    uint8_t xb[32], yb[32];
+    uint8_t z[32];              // Z_A
+    sm2::jpoint table[8];       // 公钥的奇数倍点，供验签复用
+
+    void init(const sm2::apoint& a, const string& id) {
+        if (id.size() >= 8192) throw invalid_argument("SM2 user ID too long");
+        sm2::to_bytes(xb, a.x);
+        sm2::to_bytes(yb, a.y);
+        sm2::odd_multiples(table, sm2::from_affine(a));
+        // Z_A = SM3(ENTL_A || ID_A || a || b || x_G || y_G || x_A || y_A)
+        uint8_t buf[32];
+        uint8_t entl[2] = { (uint8_t)(id.size() * 8 >> 8), (uint8_t)(id.size() * 8) };
+        OptimizedSM3 sm3;
+        sm3.update(entl, 2);
+        sm3.update((const uint8_t*)id.data(), id.size());
+        sm2::u256 a3;
+        sm2::sub256(a3, sm2::P, sm2::u256{ { 3, 0, 0, 0 } });
+        const sm2::u256* params[] = { &a3, &sm2::B, &sm2::GX, &sm2::GY, &a.x, &a.y };
+        for (const sm2::u256* v : params) {
+            sm2::to_bytes(buf, *v);
+            sm3.update(buf, 32);
+        }
+        auto h = sm3.digest();
+        memcpy(z, h.data(), 32);
+    }
+};
+
+class Sm2PrivateKey {
+public:
+    // d ∈ [1, n-2]，否则抛出 invalid_argument
+    explicit Sm2PrivateKey(const uint8_t d[32], const string& id = SM2_DEFAULT_ID) {
+        sm2::u256 dv;
+        sm2::from_bytes(dv, d);
+        init(dv, id);
+        memset(&dv, 0, sizeof(dv));
+    }
+
+    static Sm2PrivateKey generate(const string& id = SM2_DEFAULT_ID) {
+        sm2::u256 d, nm1;
+        sm2::sub256(nm1, sm2::N, sm2::u256{ { 1, 0, 0, 0 } });
+        do sm2::random_scalar(d);
+        while (!sm2::less_than(d, nm1));
+        Sm2PrivateKey key;
+        key.init(d, id);
+        memset(&d, 0, sizeof(d));
+        return key;
+    }
+
+    ~Sm2PrivateKey() {
+        memset(&d_mont, 0, sizeof(d_mont));
+        memset(&dinv_mont, 0, sizeof(dinv_mont));
+    }
+
+    const Sm2PublicKey& public_key() const { return pub; }
+
+    Sm2Signature sign(const uint8_t* msg, size_t len) const {
+        uint8_t e[32];
+        pub.digest(msg, len, e);
+        return sign_digest(e);
+    }
+
+    Sm2Signature sign_digest(const uint8_t e[32]) const {
+        Sm2Signature sig;
+        sm2::u256 k;
+        do sm2::random_scalar(k);
+        while (!try_sign(e, k, sig));
+        memset(&k, 0, sizeof(k));
+        return sig;
+    }
+
+    // 指定 k（测试向量用），k ∈ [1, n-1]；k 导致 r = 0、r + k = n 或 s = 0 时抛出 invalid_argument
+    Sm2Signature sign_digest(const uint8_t e[32], const uint8_t k[32]) const {
+        sm2::u256 kv;
+        sm2::from_bytes(kv, k);
+        if (sm2::is_zero(kv) || !sm2::less_than(kv, sm2::N)) throw invalid_argument("SM2 nonce out of range");
+        Sm2Signature sig;
+        if (!try_sign(e, kv, sig)) throw invalid_argument("SM2 nonce rejected");
+        return sig;
+    }
+
+private:
+    Sm2PrivateKey() {}
+
+    sm2::u256 d_mont;           // d·R mod n
+    sm2::u256 dinv_mont;        // (1+d)^-1·R mod n
+    Sm2PublicKey pub;
+
+    void init(const sm2::u256& d, const string& id) {
+        using namespace sm2;
+        u256 nm1;
+        sub256(nm1, N, u256{ { 1, 0, 0, 0 } });
+        if (is_zero(d) || !less_than(d, nm1)) throw invalid_argument("SM2 private key out of range");
+        sc_to_mont(d_mont, d);
+        u256 d1;
+        add256(d1, d, u256{ { 1, 0, 0, 0 } });
+        sc_to_mont(d1, d1);
+        sc_inv_mont(dinv_mont, d1);
+        jpoint Q;
+        apoint a;
+        scalar_mult_base(Q, d);
+        to_affine(a, Q);
+        pub.init(a, id);
+    }
+
+    // r = (e + x1) mod n，s = (1+d)^-1·(k - r·d) mod n
+    bool try_sign(const uint8_t e[32], const sm2::u256& k, Sm2Signature& sig) const {
+        using namespace sm2;
+        jpoint K;
+        apoint a;
+        scalar_mult_base(K, k);
+        to_affine(a, K);
+        u256 ev, x1, r, rk, rd, t, s;
+        from_bytes(ev, e);
+        reduce_once(ev, ev, N);
+        reduce_once(x1, a.x, N);
+        mod_add(r, ev, x1, N);
+        add256(rk, r, k);
+        if (is_zero(r) || equal(rk, N)) return false;
+        sc_mont_mul(rd, r, d_mont);         // Montgomery 乘积抵消 R，得到普通形式的 r·d
+        mod_sub(t, k, rd, N);
+        sc_mont_mul(s, t, dinv_mont);
+        if (is_zero(s)) return false;
+        to_bytes(sig.r, r);
+        to_bytes(sig.s, s);
+        return true;
+    }
+};
+
+// ============================== 长度扩展攻击 ==============================
+// 由 SM3(secret || msg) 恢复链接值，从原消息填充后的位置继续计算 SM3(secret || msg || glue || extension)，
+// glue 为原消息的填充：0x80、若干 0、64 比特长度
+static void sm3_restore_midstate(const vector<uint8_t>& hash, SM3Midstate& m) {
+    if (hash.size() != 32)
+        throw invalid_argument("Invalid hash length");
+    for (int i = 0; i < 8; i++) m.state[i] = sm3_core::load_be32(hash.data() + i * 4);
+    m.count = 0;
+    m.used = 0;
+}
+
+// 原消息（含 secret）共 total_len 字节时的 glue，返回其长度（9 到 72 字节）
+inline size_t length_extension_glue(uint64_t total_len, uint8_t glue[72]) {
+    size_t zeros = (size_t)((55 - total_len % 64 + 64) % 64);
+    glue[0] = 0x80;
+    memset(glue + 1, 0, zeros);
+    uint64_t bits = total_len * 8;
+    for (int i = 0; i < 8; i++) glue[zeros + 8 - i] = (uint8_t)(bits >> (i * 8));
+    return zeros + 9;
+}
+
+vector<uint8_t> length_extension_attack(
+    const vector<uint8_t>& original_hash,
+    size_t original_len,
+    const vector<uint8_t>& extension
+) {
+    // 从原始哈希恢复内部状态
+    SM3Midstate m;
+    sm3_restore_midstate(original_hash, m);
+
+    // 计数从原始消息填充后的总长度开始，update 再累加扩展部分
+    size_t pad_len = (55 - (original_len % 64) + 64) % 64;
+    m.count = (uint64_t)(original_len + 1 + pad_len + 8) * 8;
+    m.update(extension.data(), extension.size());
+
+    vector<uint8_t> out(32);
+    m.digest(out.data());
+    return out;
+}
+
+// secret 长度未知时对 [min_secret, max_secret] 中每个候选长度给出伪造结果，
+// emit(secret_len, glue, glue_len, digest)；伪造消息为 msg || glue || extension。
+// 摘要只通过填充后的长度依赖候选长度，每 64 个候选共用一个结果；扩展的整块与长度无关只压缩一次，
+// 不同填充长度的最后 1~2 个块按 SM3_MB_LANES 路多缓冲计算
+template <typename Emit>
+void length_extension_sweep(
+    const vector<uint8_t>& original_hash,
+    size_t msg_len,
+    size_t min_secret,
+    size_t max_secret,
+    const vector<uint8_t>& extension,
+    Emit emit
+) {
+    if (min_secret > max_secret) throw invalid_argument("Empty secret length range");
+    SM3Midstate base;
+    sm3_restore_midstate(original_hash, base);
+    base.update(extension.data(), extension.size());
+
+    // 候选长度单调递增时填充后的长度也单调递增，相邻候选大多相同
+    auto padded = [&](size_t secret) {
+        uint64_t total = (uint64_t)secret + msg_len;
+        return (total + 9 + 63) / 64 * 64;
+    };
+    vector<uint64_t> lengths;
+    for (uint64_t p = padded(min_secret); p <= padded(max_secret); p += 64) lengths.push_back(p);
+    vector<array<uint8_t, 32>> digests(lengths.size());
+
+    size_t i = 0;
+#if SM3_MB_LANES > 1
+    const size_t L = sm3_mb::LANES;
+    for (; i + L <= lengths.size(); i += L) {
+        uint8_t tails[sm3_mb::LANES][128];
+        const uint32_t* states[sm3_mb::LANES];
+        const uint8_t* bp[sm3_mb::LANES];
+        uint8_t* op[sm3_mb::LANES];
+        size_t nblocks = 0;
+        for (size_t l = 0; l < L; l++) {
+            SM3Midstate m = base;
+            m.count = (lengths[i + l] + extension.size()) * 8;
+            nblocks = m.final_blocks(tails[l]);
+            states[l] = base.state;
+            op[l] = digests[i + l].data();
+        }
+        sm3_mb::vec V[8];
+        sm3_mb::load(V, states);
+        for (size_t k = 0; k < nblocks; k++) {
+            for (size_t l = 0; l < L; l++) bp[l] = tails[l] + k * 64;
+            sm3_mb::compress(V, bp);
+        }
+        sm3_mb::store(V, op);
+    }
+#endif
+    for (; i < lengths.size(); i++) {
+        SM3Midstate m = base;
+        m.count = (lengths[i] + extension.size()) * 8;
+        m.digest(digests[i].data());
+    }
+
+    uint8_t glue[72];
+    uint64_t first = padded(min_secret);
+    for (size_t secret = min_secret; secret <= max_secret; secret++) {
+        size_t glue_len = length_extension_glue((uint64_t)secret + msg_len, glue);
+        emit(secret, (const uint8_t*)glue, glue_len, digests[(size_t)((padded(secret) - first) / 64)].data());
+        if (secret == max_secret) break;
+    }
+}
+
+enum class SweepFormat {
+    Csv,        // secret_len,glue_hex,digest_hex
+    Binary      // 每条: u32 secret_len (小端)、u8 glue_len、glue、32 字节摘要；max_secret 须 <= UINT32_MAX
+};
+
+// 以流的形式写出全部候选，返回条数；Binary 格式下 max_secret 超出 32 位时抛出 invalid_argument
+size_t length_extension_sweep(
+    const vector<uint8_t>& original_hash,
+    size_t msg_len,
+    size_t min_secret,
+    size_t max_secret,
+    const vector<uint8_t>& extension,
+    FILE* out,
+    SweepFormat fmt
+) {
+    if (fmt == SweepFormat::Binary && (uint64_t)max_secret > 0xFFFFFFFFull) {
+        throw invalid_argument("Secret length does not fit the 32-bit binary record");
+    }
+    static const char* hex_digits = "0123456789abcdef";
+    size_t count = 0;
+    string line;
+    length_extension_sweep(original_hash, msg_len, min_secret, max_secret, extension,
+        [&](size_t secret, const uint8_t* glue, size_t glue_len, const uint8_t* digest) {
+            if (fmt == SweepFormat::Binary) {
+                uint8_t rec[4 + 1 + 72 + 32];
+                for (int k = 0; k < 4; k++) rec[k] = (uint8_t)(secret >> (k * 8));
+                rec[4] = (uint8_t)glue_len;
+                memcpy(rec + 5, glue, glue_len);
+                memcpy(rec + 5 + glue_len, digest, 32);
+                fwrite(rec, 1, 5 + glue_len + 32, out);
+            }
+            else {
+                line = to_string(secret);
+                line.push_back(',');
+                for (size_t k = 0; k < glue_len; k++) {
+                    line.push_back(hex_digits[glue[k] >> 4]);
+                    line.push_back(hex_digits[glue[k] & 0x0F]);
+                }
+                line.push_back(',');
+                for (size_t k = 0; k < 32; k++) {
+                    line.push_back(hex_digits[digest[k] >> 4]);
+                    line.push_back(hex_digits[digest[k] & 0x0F]);
+                }
+                line.push_back('\n');
+                fwrite(line.data(), 1, line.size(), out);
+            }
+            count++;
+        });
+    return count;
+}
+
+// ============================== 线程池 ==============================
+// 固定数量的工作线程，可在多次构建之间复用；调用线程本身也参与计算，
+// 因此 ThreadPool(1) 即单线程执行
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t threads = thread::hardware_concurrency()) : stop(false) {
+        if (threads == 0) threads = 1;
+        for (size_t i = 1; i < threads; i++) {
+            workers.emplace_back([this] { worker_loop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            lock_guard<mutex> lock(mtx);
+            stop = true;
+        }
+        cv.notify_all();
+        for (auto& t : workers) t.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const { return workers.size() + 1; }
+
+    // 将 [0, n) 切成不小于 grain 的若干段并行执行 fn(begin, end)，全部完成后返回
+    template <typename Fn>
+    void parallel_for(size_t n, size_t grain, Fn fn) {
+        if (grain == 0) grain = 1;
+        size_t chunks = min(size(), (n + grain - 1) / grain);
+        if (chunks <= 1) {
+            if (n > 0) fn((size_t)0, n);
+            return;
+        }
+
+        size_t step = (n + chunks - 1) / chunks;
+        size_t pending = 0;
+        mutex done_mtx;
+        condition_variable done_cv;
+        {
+            lock_guard<mutex> lock(mtx);
+            for (size_t begin = step; begin < n; begin += step) {
+                size_t end = min(n, begin + step);
+                pending++;
+                jobs.push([&, begin, end] {
+                    fn(begin, end);
+                    lock_guard<mutex> done_lock(done_mtx);
+                    if (--pending == 0) done_cv.notify_one();
+                });
+            }
+        }
+        cv.notify_all();
+
+        fn((size_t)0, min(n, step));
+
+        unique_lock<mutex> done_lock(done_mtx);
+        done_cv.wait(done_lock, [&] { return pending == 0; });
+    }
+
+private:
+    vector<thread> workers;
+    queue<function<void()>> jobs;
+    mutex mtx;
+    condition_variable cv;
+    bool stop;
+
+    void worker_loop() {
+        for (;;) {
+            function<void()> job;
+            {
+                unique_lock<mutex> lock(mtx);
+                cv.wait(lock, [this] { return stop || !jobs.empty(); });
+                if (stop && jobs.empty()) return;
+                job = move(jobs.front());
+                jobs.pop();
+            }
+            job();
+        }
+    }
+};
+
+// 每段至少包含的节点数，太小的层直接在调用线程上完成
+static const size_t PARALLEL_GRAIN = 4096;
+
+// pool 为空时在调用线程上串行执行
+template <typename Fn>
+static void parallel_range(ThreadPool* pool, size_t n, Fn fn) {
+    if (pool) pool->parallel_for(n, PARALLEL_GRAIN, fn);
+    else if (n > 0) fn((size_t)0, n);
+}
+
+// ============================== 异步 SM3 任务队列 ==============================
+// 多个线程各自同步计算大量小消息时，每条只占一个通道，多缓冲核心用不上。
+// 调度规则（按提交线程分队列、最长等待 max_delay、窃取、唤醒条件、等待时代为执行、析构前执行完）
+// 与 project1/SM4_op.c 的异步任务队列相同，说明见该处；这里按任务类型（Hash / Hmac）而不是密钥凑批，
+// 凑满 SM3_MB_LANES 条后整批多缓冲计算。任务结构由调用者持有，队列内不为任务分配内存
+struct Sm3Job {
+    enum Kind { Hash, Hmac };
+
+    Kind kind = Hash;
+    const HmacSM3* key = nullptr;   // kind == Hmac 时使用
+    const uint8_t* data = nullptr;  // 完成前须保持有效
+    size_t len = 0;
+    uint8_t digest[32];
+    // 设置了回调的任务完成时只在工作线程上调用回调（回调中可释放或重新提交任务），
+    // 否则置完成标志，由 ready() 轮询、wait() 或 Sm3JobQueue::wait() 等待
+    void (*callback)(Sm3Job*) = nullptr;
+    void* user = nullptr;
+
+    bool ready() const { return done.load(memory_order_acquire); }
+    void wait() const {
+        while (!ready()) this_thread::yield();
+    }
+
+private:
+    friend class Sm3JobQueue;
+    atomic<bool> done{ false };
+    chrono::steady_clock::time_point submitted;
+};
+
+class Sm3JobQueue {
+public:
+    explicit Sm3JobQueue(size_t threads = thread::hardware_concurrency(),
+                         chrono::microseconds max_delay = chrono::microseconds(50))
+        : max_delay(max_delay), stop(false) {
+        if (threads == 0) threads = 1;
+        for (size_t i = 0; i < threads; i++) workers.emplace_back(new Worker);
+        for (size_t i = 0; i < threads; i++) workers[i]->th = thread([this, i] { run(i); });
+    }
+
+    ~Sm3JobQueue() {
+        stop.store(true);
+        for (auto& w : workers) {
+            lock_guard<mutex> lock(w->mtx);
+            w->cv.notify_one();
+        }
+        for (auto& w : workers) w->th.join();
+    }
+
+    Sm3JobQueue(const Sm3JobQueue&) = delete;
+    Sm3JobQueue& operator=(const Sm3JobQueue&) = delete;
+
+    size_t size() const { return workers.size(); }
+
+    // 等待任务完成，期间代为执行本线程队列中的批次
+    void wait(const Sm3Job* job) {
+        Sm3Job* batch[SM3_MB_LANES];
+        while (!job->ready()) {
+            size_t n = 0;
+            Worker& w = home();
+            {
+                unique_lock<mutex> lock(w.mtx, try_to_lock);
+                if (lock.owns_lock() && !w.jobs.empty()) n = take(w.jobs, batch);
+            }
+            if (n) execute(batch, n);
+            else this_thread::yield();
+        }
+    }
+
+    void submit(Sm3Job* job) { submit(&job, 1); }
+
+    // 同一次提交的任务进入同一个队列，只加一次锁
+    void submit(Sm3Job* const* jobs, size_t n) {
+        if (n == 0) return;
+        if (stop.load()) throw logic_error("Sm3JobQueue is shutting down");
+        auto now = chrono::steady_clock::now();
+        Worker& w = home();
+        bool wake;
+        {
+            lock_guard<mutex> lock(w.mtx);
+            size_t before = w.jobs.size();
+            for (size_t i = 0; i < n; i++) {
+                jobs[i]->done.store(false, memory_order_relaxed);
+                jobs[i]->submitted = now;
+                w.jobs.push_back(jobs[i]);
+            }
+            wake = before == 0 || before / LANES != w.jobs.size() / LANES;
+        }
+        if (wake) w.cv.notify_one();
+    }
+
+private:
+    static const size_t LANES = SM3_MB_LANES;
+
+    struct Worker {
+        mutex mtx;
+        condition_variable cv;
+        deque<Sm3Job*> jobs;
+        thread th;
+    };
+
+    vector<unique_ptr<Worker>> workers;
+    chrono::microseconds max_delay;
+    atomic<bool> stop;
+
+    Worker& home() { return *workers[hash<thread::id>()(this_thread::get_id()) % workers.size()]; }
+
+    // 队首任务同类的任务数，最多数到 LANES
+    static size_t same_kind(const deque<Sm3Job*>& q) {
+        size_t n = 0;
+        for (size_t i = 0; i < q.size() && n < LANES; i++) n += q[i]->kind == q.front()->kind;
+        return n;
+    }
+
+    // 取出与队首同类的至多 LANES 个任务，其余保持原顺序
+    static size_t take(deque<Sm3Job*>& q, Sm3Job** batch) {
+        Sm3Job::Kind kind = q.front()->kind;
+        size_t n = 0;
+        for (auto it = q.begin(); it != q.end() && n < LANES;) {
+            if ((*it)->kind == kind) {
+                batch[n++] = *it;
+                it = q.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        return n;
+    }
+
+    // 从其他队列尾部窃取一半，放入自己的队列
+    bool steal(size_t self, deque<Sm3Job*>& into) {
+        for (size_t k = 1; k < workers.size(); k++) {
+            Worker& v = *workers[(self + k) % workers.size()];
+            lock_guard<mutex> lock(v.mtx);
+            size_t n = v.jobs.size() / 2;
+            if (n == 0 && !v.jobs.empty() && chrono::steady_clock::now() >= v.jobs.front()->submitted + max_delay) {
+                n = v.jobs.size();   // 对方正在忙，到期的零散任务也接手
+            }
+            if (n == 0) continue;
+            into.insert(into.end(), v.jobs.end() - n, v.jobs.end());
+            v.jobs.erase(v.jobs.end() - n, v.jobs.end());
+            return true;
+        }
+        return false;
+    }
+
+    void run(size_t self) {
+        Worker& w = *workers[self];
+        Sm3Job* batch[SM3_MB_LANES];
+        for (;;) {
+            size_t n = 0;
+            {
+                unique_lock<mutex> lock(w.mtx);
+                for (;;) {
+                    if (!w.jobs.empty()) {
+                        auto deadline = w.jobs.front()->submitted + max_delay;
+                        if (same_kind(w.jobs) >= LANES || stop.load() || chrono::steady_clock::now() >= deadline) {
+                            n = take(w.jobs, batch);
+                            break;
+                        }
+                        w.cv.wait_until(lock, deadline);
+                        continue;
+                    }
+                    if (stop.load()) return;
+                    deque<Sm3Job*> stolen;
+                    lock.unlock();
+                    bool got = steal(self, stolen);
+                    lock.lock();
+                    if (got) {
+                        w.jobs.insert(w.jobs.end(), stolen.begin(), stolen.end());
+                        continue;
+                    }
+                    w.cv.wait_for(lock, max(max_delay, chrono::microseconds(1000)));
+                }
+            }
+            execute(batch, n);
+        }
+    }
+
+    static void execute(Sm3Job** batch, size_t n) {
+        if (n == 0) return;
+        const uint8_t* data[SM3_MB_LANES];
+        size_t lens[SM3_MB_LANES];
+        uint8_t* out[SM3_MB_LANES];
+        const HmacSM3* keys[SM3_MB_LANES];
+        for (size_t i = 0; i < n; i++) {
+            data[i] = batch[i]->data;
+            lens[i] = batch[i]->len;
+            out[i] = batch[i]->digest;
+            keys[i] = batch[i]->key;
+        }
+        if (batch[0]->kind == Sm3Job::Hmac) hmac_sm3_batch(keys, data, lens, out, n);
+        else sm3_batch(data, lens, out, n);
+        for (size_t i = 0; i < n; i++) {
+            if (batch[i]->callback) batch[i]->callback(batch[i]);
+            else batch[i]->done.store(true, memory_order_release);
+        }
+    }
+};
+
+// ============================== Merkle树实现 (RFC6962) ==============================
+// 64 字节对齐的分配器，节点数组按缓存行对齐
+template <typename T, size_t Align>
+struct AlignedAllocator {
+    typedef T value_type;
+    template <typename U> struct rebind { typedef AlignedAllocator<U, Align> other; };
+
+    AlignedAllocator() {}
+    template <typename U> AlignedAllocator(const AlignedAllocator<U, Align>&) {}
+
+    T* allocate(size_t n) {
+        size_t bytes = (n * sizeof(T) + Align - 1) / Align * Align;
+#if defined(_MSC_VER)
+        void* p = _aligned_malloc(bytes, Align);
+#else
+        void* p = aligned_alloc(Align, bytes);
+#endif
+        if (!p) throw bad_alloc();
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t) {
+#if defined(_MSC_VER)
+        _aligned_free(p);
+#else
+        free(p);
+#endif
+    }
+
+    template <typename U> bool operator==(const AlignedAllocator<U, Align>&) const { return true; }
+    template <typename U> bool operator!=(const AlignedAllocator<U, Align>&) const { return false; }
+};
+
+typedef array<uint8_t, 32> Hash256;
+// 证明中的兄弟节点直接指向树内存储，不复制哈希值
+typedef vector<const Hash256*> ProofView;
+
+template <typename Digest>
+struct BasicMultiProof {
+    vector<size_t> indices;  // 升序、无重复的叶子下标
+    vector<const Digest*> siblings;
+};
+typedef BasicMultiProof<Hash256> MultiProof;
+
+// 哈希策略：静态成员 digest_size、Digest、hash_leaf(data, len, out)、hash_node(l, r, out)，
+// 可选 hash_batch(l[], r[], out[], n) 与整层连续形式 hash_level(children, parents, n)。
+// 树按策略实例化，哈希调用全部静态内联，没有虚函数开销
+
+// 通用 SM3：节点也走流式接口
+struct Sm3ScalarPolicy {
+    static const size_t digest_size = 32;
+    typedef array<uint8_t, digest_size> Digest;
+
+    static void hash_leaf(const uint8_t* data, size_t len, uint8_t* out) {
+        OptimizedSM3 sm3;
+        sm3.update(data, len);
+        auto d = sm3.digest();
+        memcpy(out, d.data(), digest_size);
+    }
+
+    static void hash_node(const uint8_t* l, const uint8_t* r, uint8_t* out) {
+        OptimizedSM3 sm3;
+        sm3.update(l, digest_size);
+        sm3.update(r, digest_size);
+        auto d = sm3.digest();
+        memcpy(out, d.data(), digest_size);
+    }
+};
+
+// 定长 64 字节节点哈希：一个数据块加预展开的填充块，逐个计算
+struct Sm3Fixed64Policy {
+    static const size_t digest_size = 32;
+    typedef array<uint8_t, digest_size> Digest;
+
+    static void hash_leaf(const uint8_t* data, size_t len, uint8_t* out) {
+        Sm3ScalarPolicy::hash_leaf(data, len, out);
+    }
+
+    static void hash_node(const uint8_t* l, const uint8_t* r, uint8_t* out) {
+        sm3_64(l, r, out);
+    }
+};
+
+// 多缓冲：批量与整层哈希按 SM3_MB_LANES 路并行
+struct Sm3MultiBufferPolicy : Sm3Fixed64Policy {
+    static void hash_batch(const uint8_t* const* l, const uint8_t* const* r, uint8_t* const* out, size_t n) {
+        sm3_64_batch(l, r, out, n);
+    }
+
+    static void hash_level(const uint8_t* children, uint8_t* parents, size_t n) {
+        sm3_64_level(children, parents, n);
+    }
+};
+
+namespace merkle_hash {
+    template <typename P, typename = void>
+    struct has_batch : false_type {};
+    template <typename P>
+    struct has_batch<P, decltype(P::hash_batch((const uint8_t* const*)nullptr, (const uint8_t* const*)nullptr,
+                                               (uint8_t* const*)nullptr, size_t()), void())> : true_type {};
+
+    template <typename P, typename = void>
+    struct has_level : false_type {};
+    template <typename P>
+    struct has_level<P, decltype(P::hash_level((const uint8_t*)nullptr, (uint8_t*)nullptr, size_t()), void())>
+        : true_type {};
+
+    template <typename P>
+    SM3_INLINE void batch(const uint8_t* const* l, const uint8_t* const* r, uint8_t* const* out, size_t n, true_type) {
+        P::hash_batch(l, r, out, n);
+    }
+    template <typename P>
+    SM3_INLINE void batch(const uint8_t* const* l, const uint8_t* const* r, uint8_t* const* out, size_t n, false_type) {
+        for (size_t i = 0; i < n; i++) P::hash_node(l[i], r[i], out[i]);
+    }
+    template <typename P>
+    SM3_INLINE void batch(const uint8_t* const* l, const uint8_t* const* r, uint8_t* const* out, size_t n) {
+        batch<P>(l, r, out, n, has_batch<P>());
+    }
+
+    template <typename P>
+    SM3_INLINE void level(const uint8_t* children, uint8_t* parents, size_t n, true_type) {
+        P::hash_level(children, parents, n);
+    }
+    // 没有整层形式时按块组装指针交给 batch
+    template <typename P>
+    SM3_INLINE void level(const uint8_t* children, uint8_t* parents, size_t n, false_type) {
+        const size_t d = P::digest_size;
+        const uint8_t* lp[64];
+        const uint8_t* rp[64];
+        uint8_t* op[64];
+        for (size_t i = 0; i < n; i += 64) {
+            size_t m = n - i < 64 ? n - i : 64;
+            for (size_t k = 0; k < m; k++) {
+                lp[k] = children + 2 * (i + k) * d;
+                rp[k] = lp[k] + d;
+                op[k] = parents + (i + k) * d;
+            }
+            batch<P>(lp, rp, op, m);
+        }
+    }
+    template <typename P>
+    SM3_INLINE void level(const uint8_t* children, uint8_t* parents, size_t n) {
+        INSTR_BEGIN(t0);
+        level<P>(children, parents, n, has_level<P>());
+        INSTR_END(INSTR_MERKLE_LEVEL, t0, n * 2 * P::digest_size);
+    }
+}
+
+template <typename HashPolicy>
+class BasicMerkleTree {
+public:
+    typedef typename HashPolicy::Digest Digest;
+    typedef vector<const Digest*> Proof;
+    typedef BasicMultiProof<Digest> MultiProof;
+
+    BasicMerkleTree(const vector<vector<uint8_t>>& leaves) {
+        build(leaves, nullptr);
+    }
+
+    // 并行构建：叶子分段并行哈希，再逐层并行归约，根与串行构建一致
+    BasicMerkleTree(const vector<vector<uint8_t>>& leaves, ThreadPool& pool) {
+        build(leaves, &pool);
+    }
+
+    const Digest& root() const {
+        static const Digest empty_root = {};
+        return nodes.empty() ? empty_root : nodes.back();
+    }
+
+    size_t size() const { return leaf_count; }
+
+    // 证明长度，所有叶子相同
+    size_t proof_depth() const {
+        return level_offset.empty() ? 0 : level_offset.size() - 1;
+    }
+
+    // 存在性证明
+    Proof proof(size_t index) const {
+        Proof proof(proof_depth());
+        if (nodes.empty()) return proof;
+        this->proof(index, proof.data());
+        return proof;
+    }
+
+    // 不分配内存的形式：out 需有 proof_depth() 个位置
+    void proof(size_t index, const Digest** out) const {
+        size_t n = level_offset.size() > 1 ? level_offset[1] : 1;
+        if (index >= n) throw out_of_range("Index out of range");
+
+        size_t pos = index;
+        for (size_t d = 0; d + 1 < level_offset.size(); d++) {
+            out[d] = &nodes[level_offset[d] + (pos ^ 1)];
+            pos /= 2;
+        }
+    }
+
+    // 验证存在性证明
+    static bool verify(
+        const vector<uint8_t>& leaf,
+        const Digest& root,
+        size_t index,
+        size_t tree_size,
+        const Proof& proof
+    ) {
+        size_t n = 1;
+        while (n < tree_size) n <<= 1;
+        if (index >= n) return false;
+
+        Digest current = hash_leaf(leaf);
+        size_t pos = index;
+
+        for (const Digest* p : proof) {
+            if (pos % 2 == 1) {
+                HashPolicy::hash_node(p->data(), current.data(), current.data());
+            }
+            else {
+                HashPolicy::hash_node(current.data(), p->data(), current.data());
+            }
+            pos /= 2;
+        }
+
+        return current == root;
+    }
+
+    // 生成不存在性证明 
+    pair<Proof, Proof> absence_proof(
+        const vector<uint8_t>& target,
+        size_t& insert_pos
+    ) const {
+        if (nodes.empty()) {
+            insert_pos = 0;
+            return { {}, {} };
+        }
+
+        // 在叶子节点中定位插入位置
+        size_t n = level_offset.size() > 1 ? level_offset[1] : 1;
+        size_t low = 0, high = n;
+        insert_pos = n; 
 
         while (low < high) {
             size_t mid = (low + high) / 2;
-            int cmp = memcmp(target.data(), tree[n + mid].data(), 32);
+            int cmp = memcmp(target.data(), nodes[mid].data(), HashPolicy::digest_size);
             if (cmp == 0) {
                 throw runtime_error("Target exists in tree");
             }
-            else if (cmp < 0) {
-                high = mid;
-                insert_pos = mid;
+            else if (cmp < 0) {
+                high = mid;
+                insert_pos = mid;
+            }
+            else {
+                low = mid + 1;
+            }
+        }
+
+        // 处理边界情况
+        Proof predecessor_proof;
+        Proof successor_proof;
+
+        if (insert_pos > 0) {
+            predecessor_proof = proof(insert_pos - 1);
+        }
+
+        if (insert_pos < n) {
+            successor_proof = proof(insert_pos);
+        }
+
+        return { predecessor_proof, successor_proof };
+    }
+
+    // 多叶子证明：对一组下标只给出重建根所需的最少兄弟节点。
+    // 逐层处理已知节点，兄弟也已知（同样被证明或可由下层算出）时不放入证明；
+    // 兄弟节点按层、层内按位置升序排列，与 verify_multi 的消费顺序一致
+    MultiProof multiproof(vector<size_t> indices) const {
+        sort(indices.begin(), indices.end());
+        indices.erase(unique(indices.begin(), indices.end()), indices.end());
+        size_t n = level_offset.size() > 1 ? level_offset[1] : 1;
+        if (!indices.empty() && indices.back() >= n) throw out_of_range("Index out of range");
+
+        MultiProof mp;
+        mp.indices = indices;
+        vector<size_t> known = indices, next;
+        for (size_t d = 0; d + 1 < level_offset.size(); d++) {
+            next.clear();
+            for (size_t i = 0; i < known.size(); i++) {
+                size_t pos = known[i];
+                if (!(pos & 1) && i + 1 < known.size() && known[i + 1] == pos + 1) {
+                    i++;
+                }
+                else {
+                    mp.siblings.push_back(&nodes[level_offset[d] + (pos ^ 1)]);
+                }
+                next.push_back(pos / 2);
+            }
+            known.swap(next);
+        }
+        return mp;
+    }
+
+    // leaves[i] 对应 indices[i]（升序、无重复）；每个共同祖先只计算一次，每层整批哈希
+    static bool verify_multi(
+        const vector<size_t>& indices,
+        const vector<vector<uint8_t>>& leaves,
+        const Digest& root,
+        size_t tree_size,
+        const Proof& siblings
+    ) {
+        if (indices.empty() || indices.size() != leaves.size()) return false;
+        size_t n = 1;
+        while (n < tree_size) n <<= 1;
+
+        vector<size_t> pos(indices), next_pos;
+        vector<Digest> hashes(leaves.size()), next_hashes;
+        for (size_t i = 0; i < leaves.size(); i++) {
+            if (pos[i] >= n || (i > 0 && pos[i] <= pos[i - 1])) return false;
+            hashes[i] = hash_leaf(leaves[i]);
+        }
+
+        vector<const uint8_t*> lp, rp;
+        vector<uint8_t*> op;
+        size_t k = 0;
+        for (size_t width = n; width > 1; width /= 2) {
+            next_pos.clear();
+            lp.clear(); rp.clear();
+            for (size_t i = 0; i < pos.size(); i++) {
+                const uint8_t* self = hashes[i].data();
+                if (!(pos[i] & 1) && i + 1 < pos.size() && pos[i + 1] == pos[i] + 1) {
+                    lp.push_back(self);
+                    rp.push_back(hashes[++i].data());
+                }
+                else {
+                    if (k >= siblings.size()) return false;
+                    const uint8_t* sib = siblings[k++]->data();
+                    lp.push_back(pos[i] & 1 ? sib : self);
+                    rp.push_back(pos[i] & 1 ? self : sib);
+                }
+                next_pos.push_back(pos[i] / 2);
+            }
+            next_hashes.resize(next_pos.size());
+            op.clear();
+            for (auto& h : next_hashes) op.push_back(h.data());
+            merkle_hash::batch<HashPolicy>(lp.data(), rp.data(), op.data(), next_pos.size());
+            pos.swap(next_pos);
+            hashes.swap(next_hashes);
+        }
+
+        return k == siblings.size() && hashes.size() == 1 && hashes[0] == root;
+    }
+
+    size_t memory_bytes() const {
+        return nodes.size() * sizeof(Digest);
+    }
+
+    // 修改一个叶子，只重新计算它到根的 O(log n) 条路径
+    void update(size_t index, const vector<uint8_t>& leaf) {
+        if (index >= leaf_count) throw out_of_range("Index out of range");
+        nodes[index] = hash_leaf(leaf);
+        size_t pos = index;
+        for (size_t d = 1; d < level_offset.size(); d++) {
+            pos /= 2;
+            const Digest* child = &nodes[level_offset[d - 1] + 2 * pos];
+            HashPolicy::hash_node(child[0].data(), child[1].data(), nodes[level_offset[d] + pos].data());
+        }
+    }
+
+    // 批量修改：脏下标排序后逐层去重，每个共同祖先只计算一次，每层整批多缓冲哈希；
+    // 同一下标出现多次时以最后一次为准
+    void update_batch(const vector<pair<size_t, vector<uint8_t>>>& updates, ThreadPool* pool = nullptr) {
+        vector<size_t> order(updates.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            if (updates[i].first >= leaf_count) throw out_of_range("Index out of range");
+            order[i] = i;
+        }
+        stable_sort(order.begin(), order.end(), [&](size_t x, size_t y) {
+            return updates[x].first < updates[y].first;
+        });
+        vector<size_t> last;
+        for (size_t i = 0; i < order.size(); i++) {
+            if (i + 1 < order.size() && updates[order[i + 1]].first == updates[order[i]].first) continue;
+            last.push_back(order[i]);
+        }
+
+        parallel_range(pool, last.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                nodes[updates[last[i]].first] = hash_leaf(updates[last[i]].second);
+            }
+        });
+
+        vector<size_t> dirty(last.size());
+        for (size_t i = 0; i < last.size(); i++) dirty[i] = updates[last[i]].first;
+        for (size_t d = 1; d < level_offset.size() && !dirty.empty(); d++) {
+            size_t m = 0;
+            for (size_t i = 0; i < dirty.size(); i++) {
+                size_t p = dirty[i] / 2;
+                if (m == 0 || dirty[m - 1] != p) dirty[m++] = p;
+            }
+            dirty.resize(m);
+
+            Digest* children = &nodes[level_offset[d - 1]];
+            Digest* parents = &nodes[level_offset[d]];
+            parallel_range(pool, m, [&](size_t begin, size_t end) {
+                vector<const uint8_t*> lp, rp;
+                vector<uint8_t*> op;
+                for (size_t i = begin; i < end; i++) {
+                    lp.push_back(children[2 * dirty[i]].data());
+                    rp.push_back(children[2 * dirty[i] + 1].data());
+                    op.push_back(parents[dirty[i]].data());
+                }
+                merkle_hash::batch<HashPolicy>(lp.data(), rp.data(), op.data(), end - begin);
+            });
+        }
+    }
+
+    // 保存为 MappedMerkleTree 可直接映射的文件
+    void save(const string& path) const;
+
+    static Digest hash_leaf(const vector<uint8_t>& data) {
+        Digest out;
+        HashPolicy::hash_leaf(data.data(), data.size(), out.data());
+        return out;
+    }
+
+private:
+    // 按层连续存放：先是全部叶子，然后逐层向上，最后一个节点是根
+    vector<Digest, AlignedAllocator<Digest, 64>> nodes;
+    // 第 d 层在 nodes 中的起始下标
+    vector<size_t> level_offset;
+    size_t leaf_count = 0;
+
+    void build(const vector<vector<uint8_t>>& leaves, ThreadPool* pool) {
+        if (leaves.empty()) return;
+
+        // 确保叶子数量是2的幂
+        size_t n = leaves.size();
+        size_t tree_size = 1;
+        while (tree_size < n) tree_size <<= 1;
+        leaf_count = n;
+
+        for (size_t w = tree_size, off = 0; w >= 1; off += w, w /= 2) {
+            level_offset.push_back(off);
+        }
+        nodes.resize(2 * tree_size - 1);
+
+        parallel_range(pool, tree_size, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                if (i < n) nodes[i] = hash_leaf(leaves[i]);
+                else nodes[i].fill(0);
+            }
+        });
+
+        // 构建树：每层的子节点连续存放，直接整层多缓冲计算
+        for (size_t d = 1; d < level_offset.size(); d++) {
+            const Digest* children = &nodes[level_offset[d - 1]];
+            Digest* parents = &nodes[level_offset[d]];
+            parallel_range(pool, tree_size >> d, [&](size_t begin, size_t end) {
+                merkle_hash::level<HashPolicy>(children[2 * begin].data(), parents[begin].data(), end - begin);
+            });
+        }
+    }
+};
+
+// 默认实例：定长节点哈希 + 多缓冲批量
+typedef BasicMerkleTree<Sm3MultiBufferPolicy> MerkleTree;
+
+// ============================== Merkle树文件 (内存映射) ==============================
+// 文件布局（小端）：64 字节文件头 + 按层连续存放的节点（与 MerkleTree 内存布局一致）
+//   0  magic "SM3MRKL1"     8  version      12 hash_id (1 = SM3)
+//   16 leaf_count           24 tree_size (补齐后的叶子数)  32 node_count
+//   40 data_checksum: 节点区 SM3 的前 8 字节，check() 时校验
+//   48 header_checksum: 前 48 字节 SM3 的前 8 字节，打开时校验
+//   56 保留
+// 打开只需映射并校验文件头，之后 root()/proof() 直接读取映射页，超出内存的树由页缓存承载
+struct MerkleFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t hash_id;
+    uint64_t leaf_count;
+    uint64_t tree_size;
+    uint64_t node_count;
+    uint64_t data_checksum;
+    uint64_t header_checksum;
+    uint64_t reserved;
+};
+static_assert(sizeof(MerkleFileHeader) == 64, "Merkle file header must be 64 bytes");
+
+static const char MERKLE_FILE_MAGIC[8] = { 'S', 'M', '3', 'M', 'R', 'K', 'L', '1' };
+
+static uint64_t sm3_checksum64(const uint8_t* data, size_t len) {
+    OptimizedSM3 sm3;
+    sm3.update(data, len);
+    auto d = sm3.digest();
+    uint64_t v;
+    memcpy(&v, d.data(), 8);
+    return v;
+}
+
+MerkleFileHeader make_merkle_header(size_t leaf_count, size_t node_count, uint64_t data_checksum) {
+    MerkleFileHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, MERKLE_FILE_MAGIC, 8);
+    h.version = 1;
+    h.hash_id = 1;
+    h.leaf_count = leaf_count;
+    h.tree_size = (node_count + 1) / 2;
+    h.node_count = node_count;
+    h.data_checksum = data_checksum;
+    h.header_checksum = sm3_checksum64((const uint8_t*)&h, offsetof(MerkleFileHeader, header_checksum));
+    return h;
+}
+
+void write_merkle_file(const string& path, size_t leaf_count, const Hash256* nodes, size_t node_count) {
+    MerkleFileHeader h = make_merkle_header(leaf_count, node_count,
+        sm3_checksum64(nodes[0].data(), node_count * sizeof(Hash256)));
+
+    FILE* fp = fopen(path.c_str(), "wb");
+    if (!fp) throw runtime_error("Cannot create " + path);
+    bool ok = fwrite(&h, sizeof(h), 1, fp) == 1
+        && fwrite(nodes, sizeof(Hash256), node_count, fp) == node_count;
+    ok = fclose(fp) == 0 && ok;
+    if (!ok) throw runtime_error("Write failed: " + path);
+}
+
+// 只读映射整个文件，空文件得到长度为 0 的映射；access 决定页缓存的预读方式
+class MappedFile {
+public:
+    enum Access { Sequential, Random };
+
+    MappedFile(const string& path, Access access) : base(nullptr), length(0) {
+        map_file(path, access);
+    }
+
+    ~MappedFile() { unmap_file(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const uint8_t* data() const { return base; }
+    size_t size() const { return length; }
+
+private:
+    const uint8_t* base;
+    size_t length;
+#if defined(_WIN32)
+    HANDLE file_handle = INVALID_HANDLE_VALUE;
+    HANDLE map_handle = nullptr;
+
+    void map_file(const string& path, Access access) {
+        DWORD flags = access == Sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_FLAG_RANDOM_ACCESS;
+        file_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, flags, nullptr);
+        if (file_handle == INVALID_HANDLE_VALUE) throw runtime_error("Cannot open " + path);
+        LARGE_INTEGER size;
+        GetFileSizeEx(file_handle, &size);
+        length = (size_t)size.QuadPart;
+        if (length == 0) return;
+        map_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (map_handle) base = (const uint8_t*)MapViewOfFile(map_handle, FILE_MAP_READ, 0, 0, 0);
+        if (!base) {
+            unmap_file();
+            throw runtime_error("Cannot map " + path);
+        }
+    }
+
+    void unmap_file() {
+        if (base) UnmapViewOfFile(base);
+        if (map_handle) CloseHandle(map_handle);
+        if (file_handle != INVALID_HANDLE_VALUE) CloseHandle(file_handle);
+        base = nullptr;
+        map_handle = nullptr;
+        file_handle = INVALID_HANDLE_VALUE;
+    }
+#else
+    void map_file(const string& path, Access access) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw runtime_error("Cannot open " + path);
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            throw runtime_error("Cannot stat " + path);
+        }
+        length = (size_t)st.st_size;
+        if (length == 0) {
+            close(fd);
+            return;
+        }
+        void* p = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (p == MAP_FAILED) throw runtime_error("Cannot map " + path);
+        madvise(p, length, access == Sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+        base = (const uint8_t*)p;
+    }
+
+    void unmap_file() {
+        if (base) munmap((void*)base, length);
+        base = nullptr;
+    }
+#endif
+};
+
+class MappedMerkleTree {
+public:
+    // 证明访问是随机的，不需要预读
+    explicit MappedMerkleTree(const string& path) : file(path, MappedFile::Random), nodes(nullptr) {
+        if (file.size() < sizeof(MerkleFileHeader)) throw runtime_error("Truncated Merkle file");
+        memcpy(&header, file.data(), sizeof(header));
+        if (memcmp(header.magic, MERKLE_FILE_MAGIC, 8) != 0 || header.version != 1 || header.hash_id != 1)
+            throw runtime_error("Not an SM3 Merkle file");
+        if (header.header_checksum !=
+            sm3_checksum64((const uint8_t*)&header, offsetof(MerkleFileHeader, header_checksum)))
+            throw runtime_error("Merkle file header checksum mismatch");
+        if (header.tree_size == 0 || (header.tree_size & (header.tree_size - 1)) != 0 ||
+            header.node_count != 2 * header.tree_size - 1 || header.leaf_count > header.tree_size ||
+            file.size() < sizeof(MerkleFileHeader) + header.node_count * sizeof(Hash256))
+            throw runtime_error("Corrupt Merkle file header");
+        nodes = reinterpret_cast<const Hash256*>(file.data() + sizeof(MerkleFileHeader));
+        for (size_t w = (size_t)header.tree_size, off = 0; w >= 1; off += w, w /= 2) {
+            level_offset.push_back(off);
+        }
+    }
+
+    MappedMerkleTree(const MappedMerkleTree&) = delete;
+    MappedMerkleTree& operator=(const MappedMerkleTree&) = delete;
+
+    size_t size() const { return (size_t)header.leaf_count; }
+
+    const Hash256& root() const { return nodes[header.node_count - 1]; }
+
+    // 与 MerkleTree::proof 相同，兄弟节点指向映射页
+    ProofView proof(size_t index) const {
+        if (index >= header.tree_size) throw out_of_range("Index out of range");
+        ProofView proof;
+        size_t pos = index;
+        for (size_t d = 0; d + 1 < level_offset.size(); d++) {
+            proof.push_back(&nodes[level_offset[d] + (pos ^ 1)]);
+            pos /= 2;
+        }
+        return proof;
+    }
+
+    // 完整校验节点区，O(n)
+    bool check() const {
+        return header.data_checksum ==
+            sm3_checksum64(nodes[0].data(), (size_t)header.node_count * sizeof(Hash256));
+    }
+
+private:
+    MappedFile file;
+    MerkleFileHeader header;
+    const Hash256* nodes;
+    vector<size_t> level_offset;
+};
+
+// 文件格式固定为 32 字节节点，所有 SM3 策略得到的节点相同
+template <typename HashPolicy>
+void BasicMerkleTree<HashPolicy>::save(const string& path) const {
+    static_assert(sizeof(Digest) == sizeof(Hash256), "Merkle file stores 32-byte digests");
+    if (nodes.empty()) throw logic_error("Cannot save an empty tree");
+    write_merkle_file(path, leaf_count, nodes.data(), nodes.size());
+}
+
+// ============================== 外存构建 Merkle树文件 ==============================
+// 叶子从文件流式读入，逐层写出与 MerkleTree::save 相同格式的文件。
+// 按层连续的布局使每层都是顺序追加：第 d 层由顺序读回的第 d-1 层计算。
+// 读取由后台线程预取下一块，与哈希重叠；内存只占用固定大小的块缓冲
+enum class LeafFormat {
+    Lines,          // 每行一个叶子（不含换行符）
+    LengthPrefixed  // 4 字节小端长度 + 数据
+};
+
+static void seek64(FILE* fp, uint64_t off) {
+#if defined(_WIN32)
+    _fseeki64(fp, (long long)off, SEEK_SET);
+#else
+    fseeko(fp, (off_t)off, SEEK_SET);
+#endif
+}
+
+// 双缓冲顺序读取：返回当前块的同时在后台读取下一块
+class PrefetchReader {
+public:
+    PrefetchReader(FILE* fp, size_t chunk_bytes, uint64_t limit = UINT64_MAX)
+        : fp(fp), chunk(chunk_bytes), remaining(limit), cur(0) {
+        start(1);
+    }
+
+    ~PrefetchReader() {
+        if (pending.valid()) pending.wait();
+    }
+
+    // 返回空缓冲表示读完
+    const vector<uint8_t>& next() {
+        size_t got = pending.get();
+        cur ^= 1;
+        buf[cur].resize(got);
+        if (got > 0) start(cur ^ 1);
+        return buf[cur];
+    }
+
+private:
+    FILE* fp;
+    size_t chunk;
+    uint64_t remaining;
+    vector<uint8_t> buf[2];
+    int cur;
+    future<size_t> pending;
+
+    void start(int slot) {
+        size_t want = (size_t)min<uint64_t>(chunk, remaining);
+        remaining -= want;
+        buf[slot].resize(chunk);
+        pending = async(launch::async, [this, slot, want] {
+            return want == 0 ? (size_t)0 : fread(buf[slot].data(), 1, want, fp);
+        });
+    }
+};
+
+class MerkleFileBuilder {
+public:
+    MerkleFileBuilder(const string& out_path, size_t chunk_nodes, ThreadPool* pool)
+        : path(out_path), chunk((chunk_nodes + 1) & ~(size_t)1), pool(pool), written(0) {
+        if (chunk < 2) chunk = 2;
+        out = fopen(path.c_str(), "w+b");
+        if (!out) throw runtime_error("Cannot create " + path);
+        // 先占位文件头，最后回填
+        MerkleFileHeader h;
+        memset(&h, 0, sizeof(h));
+        fwrite(&h, sizeof(h), 1, out);
+    }
+
+    ~MerkleFileBuilder() {
+        if (out) fclose(out);
+    }
+
+    Hash256 build(const string& leaf_path, LeafFormat fmt) {
+        size_t n = hash_leaves(leaf_path, fmt);
+        if (n == 0) throw runtime_error("No leaves in " + leaf_path);
+
+        size_t tree_size = 1;
+        while (tree_size < n) tree_size <<= 1;
+        vector<Hash256> zeros(min(chunk, tree_size - n));
+        for (auto& z : zeros) z.fill(0);
+        for (size_t left = tree_size - n; left > 0; ) {
+            size_t k = min(left, zeros.size());
+            emit(zeros.data(), k);
+            left -= k;
+        }
+
+        // 逐层：顺序读回上一层，整层多缓冲哈希后追加
+        uint64_t level_off = 0;
+        vector<Hash256> parents(chunk / 2);
+        for (size_t width = tree_size; width > 1; width /= 2) {
+            fflush(out);
+            FILE* in = fopen(path.c_str(), "rb");
+            if (!in) throw runtime_error("Cannot reopen " + path);
+            seek64(in, sizeof(MerkleFileHeader) + level_off * sizeof(Hash256));
+            {
+                PrefetchReader reader(in, chunk * sizeof(Hash256), (uint64_t)width * sizeof(Hash256));
+                for (;;) {
+                    const vector<uint8_t>& buf = reader.next();
+                    if (buf.empty()) break;
+                    size_t pairs = buf.size() / 64;
+                    const uint8_t* children = buf.data();
+                    parallel_range(pool, pairs, [&](size_t begin, size_t end) {
+                        sm3_64_level(children + begin * 64, parents[begin].data(), end - begin);
+                    });
+                    emit(parents.data(), pairs);
+                }
+            }
+            fclose(in);
+            level_off += width;
+        }
+
+        Hash256 root;
+        fflush(out);
+        FILE* in = fopen(path.c_str(), "rb");
+        if (!in) throw runtime_error("Cannot reopen " + path);
+        seek64(in, sizeof(MerkleFileHeader) + (written - 1) * sizeof(Hash256));
+        bool ok = fread(root.data(), 1, 32, in) == 32;
+        fclose(in);
+
+        MerkleFileHeader h = make_merkle_header(n, (size_t)written, digest64(checksum));
+        seek64(out, 0);
+        ok = ok && fwrite(&h, sizeof(h), 1, out) == 1;
+        ok = fclose(out) == 0 && ok;
+        out = nullptr;
+        if (!ok) throw runtime_error("Write failed: " + path);
+        return root;
+    }
+
+private:
+    string path;
+    size_t chunk;
+    ThreadPool* pool;
+    FILE* out;
+    uint64_t written;
+    OptimizedSM3 checksum;
+
+    void emit(const Hash256* nodes, size_t count) {
+        if (fwrite(nodes, sizeof(Hash256), count, out) != count) throw runtime_error("Write failed: " + path);
+        checksum.update(nodes[0].data(), count * sizeof(Hash256));
+        written += count;
+    }
+
+    // 返回叶子数；未成形的最后一条记录留在 carry 中与下一块拼接
+    size_t hash_leaves(const string& leaf_path, LeafFormat fmt) {
+        FILE* in = fopen(leaf_path.c_str(), "rb");
+        if (!in) throw runtime_error("Cannot open " + leaf_path);
+
+        size_t n = 0;
+        vector<uint8_t> carry;
+        vector<pair<const uint8_t*, size_t>> records;
+        vector<Hash256> hashes;
+        {
+            PrefetchReader reader(in, chunk * 32, UINT64_MAX);
+            for (bool eof = false; !eof; ) {
+                const vector<uint8_t>& buf = reader.next();
+                eof = buf.empty();
+                const uint8_t* p = buf.data();
+                size_t len = buf.size();
+                if (!carry.empty() || eof) {
+                    carry.insert(carry.end(), buf.begin(), buf.end());
+                    p = carry.data();
+                    len = carry.size();
+                }
+
+                records.clear();
+                size_t used = split_records(p, len, fmt, eof, records);
+
+                hashes.resize(records.size());
+                parallel_range(pool, records.size(), [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++) {
+                        OptimizedSM3 sm3;
+                        sm3.update(records[i].first, records[i].second);
+                        auto d = sm3.digest();
+                        memcpy(hashes[i].data(), d.data(), 32);
+                    }
+                });
+                if (!hashes.empty()) emit(hashes.data(), hashes.size());
+                n += records.size();
+
+                vector<uint8_t> rest(p + used, p + len);
+                carry.swap(rest);
+            }
+        }
+        fclose(in);
+        if (!carry.empty()) throw runtime_error("Truncated leaf record in " + leaf_path);
+        return n;
+    }
+
+    static size_t split_records(const uint8_t* p, size_t len, LeafFormat fmt, bool eof,
+                                vector<pair<const uint8_t*, size_t>>& records) {
+        size_t pos = 0;
+        if (fmt == LeafFormat::Lines) {
+            while (pos < len) {
+                const uint8_t* nl = (const uint8_t*)memchr(p + pos, '\n', len - pos);
+                if (!nl) {
+                    if (!eof) break;
+                    records.push_back({ p + pos, len - pos });
+                    return len;
+                }
+                records.push_back({ p + pos, (size_t)(nl - (p + pos)) });
+                pos = (size_t)(nl - p) + 1;
+            }
+        }
+        else {
+            while (pos + 4 <= len) {
+                uint32_t rlen = (uint32_t)p[pos] | ((uint32_t)p[pos + 1] << 8) |
+                    ((uint32_t)p[pos + 2] << 16) | ((uint32_t)p[pos + 3] << 24);
+                if (pos + 4 + rlen > len) break;
+                records.push_back({ p + pos + 4, rlen });
+                pos += 4 + rlen;
+            }
+        }
+        return pos;
+    }
+
+    static uint64_t digest64(const OptimizedSM3& sm3) {
+        OptimizedSM3 copy = sm3;
+        auto d = copy.digest();
+        uint64_t v;
+        memcpy(&v, d.data(), 8);
+        return v;
+    }
+};
+
+// 从叶子文件构建 Merkle 树文件，返回根；chunk_nodes 决定每块的节点数，即内存预算
+Hash256 build_merkle_file(const string& leaf_path, LeafFormat fmt, const string& out_path,
+                          size_t chunk_nodes = 1 << 16, ThreadPool* pool = nullptr) {
+    MerkleFileBuilder builder(out_path, chunk_nodes, pool);
+    return builder.build(leaf_path, fmt);
+}
+
+// ============================== 批量证明验证 ==============================
+// 针对同一个 MerkleTree 根批量验证存在性证明：
+// 1. 各证明按层同步推进，每层把所有未决的 hash_node 交给 sm3_64_batch；
+// 2. 同一批中在同一位置算出相同哈希的证明只保留一个继续向上，其余跟随它的结果；
+// 3. 已经验证到根的内部节点缓存下来，之后的证明到达这些节点时立即得出结论
+struct BatchItem {
+    const vector<uint8_t>* leaf;
+    size_t index;
+    const ProofView* proof;
+};
+
+class MerkleBatchVerifier {
+public:
+    MerkleBatchVerifier(const Hash256& root, size_t tree_size, size_t max_cached = 1 << 20)
+        : root(root), depth(0), capacity(max_cached) {
+        size_t n = 1;
+        while (n < tree_size) {
+            n <<= 1;
+            depth++;
+        }
+        leaves = n;
+    }
+
+    // 返回每个证明的结果（1 有效 / 0 无效）
+    vector<uint8_t> verify(const vector<BatchItem>& items) {
+        const size_t count = items.size();
+        vector<uint8_t> result(count, 0);
+        vector<int> state(count, PENDING);
+        vector<size_t> pos(count);
+        vector<Hash256> cur(count);
+        // 计算过的 (节点键, 哈希, 证明编号)，验证结束后只缓存有效证明上的节点
+        vector<pair<uint64_t, pair<Hash256, size_t>>> computed;
+        unordered_map<uint64_t, size_t> leader;
+
+        for (size_t i = 0; i < count; i++) {
+            if (items[i].index >= leaves || items[i].proof->size() != depth) {
+                state[i] = INVALID;
+                continue;
+            }
+            pos[i] = items[i].index;
+            cur[i] = MerkleTree::hash_leaf(*items[i].leaf);
+        }
+
+        vector<const uint8_t*> lp, rp;
+        vector<uint8_t*> op;
+        vector<size_t> active;
+        vector<Hash256> out;
+        for (size_t d = 0; ; d++) {
+            leader.clear();
+            active.clear();
+            for (size_t i = 0; i < count; i++) {
+                if (state[i] != PENDING) continue;
+                uint64_t k = key(d, pos[i]);
+                auto hit = cache.find(k);
+                if (hit != cache.end()) {
+                    state[i] = cur[i] == hit->second ? VALID : INVALID;
+                    continue;
+                }
+                auto it = leader.find(k);
+                if (it != leader.end() && cur[it->second] == cur[i]) {
+                    state[i] = FOLLOW_BASE + (int)it->second;
+                    continue;
+                }
+                if (it == leader.end()) leader.emplace(k, i);
+                if (d < depth) computed.push_back({ k, { cur[i], i } });
+                active.push_back(i);
+            }
+
+            if (d == depth) {
+                for (size_t i : active) state[i] = cur[i] == root ? VALID : INVALID;
+                break;
+            }
+            if (active.empty()) break;
+
+            lp.clear(); rp.clear(); op.clear();
+            out.resize(active.size());
+            for (size_t j = 0; j < active.size(); j++) {
+                size_t i = active[j];
+                const uint8_t* sib = (*items[i].proof)[d]->data();
+                lp.push_back(pos[i] & 1 ? sib : cur[i].data());
+                rp.push_back(pos[i] & 1 ? cur[i].data() : sib);
+                op.push_back(out[j].data());
+            }
+            sm3_64_batch(lp.data(), rp.data(), op.data(), active.size());
+            for (size_t j = 0; j < active.size(); j++) {
+                cur[active[j]] = out[j];
+                pos[active[j]] /= 2;
+            }
+        }
+
+        for (size_t i = 0; i < count; i++) result[i] = resolve(state, i);
+
+        // 放不下时清空重来；单批算出的节点比容量还多时只存到满为止，不突破 max_cached
+        if (cache.size() + computed.size() > capacity) cache.clear();
+        for (const auto& c : computed) {
+            if (cache.size() >= capacity) break;
+            if (result[c.second.second]) cache.emplace(c.first, c.second.first);
+        }
+        return result;
+    }
+
+    size_t cached_nodes() const { return cache.size(); }
+
+private:
+    enum { PENDING = -1, INVALID = 0, VALID = 1, FOLLOW_BASE = 2 };
+
+    Hash256 root;
+    size_t depth;
+    size_t leaves;
+    size_t capacity;
+    unordered_map<uint64_t, Hash256> cache;
+
+    // 高 8 位为层号，低 56 位为层内位置
+    static uint64_t key(size_t d, size_t pos) {
+        return ((uint64_t)d << 56) | (uint64_t)pos;
+    }
+
+    static uint8_t resolve(vector<int>& state, size_t i) {
+        if (state[i] >= FOLLOW_BASE) state[i] = resolve(state, (size_t)(state[i] - FOLLOW_BASE));
+        return state[i] == VALID ? 1 : 0;
+    }
+};
+
+// ============================== RFC 6962 Merkle树 ==============================
+// MTH(D[n]) 按不超过 n 的最大 2 的幂划分，叶子哈希 SM3(0x00 || d)，内部节点 SM3(0x01 || l || r)。
+// 等价于自底向上两两合并、奇数层的最后一个节点直接提升到上一层，
+// 因此只需存储真实存在的节点，内存与哈希次数都随 n 而不是 next_pow2(n) 增长
+
+inline void rfc6962_hash_leaf(const uint8_t* data, size_t len, uint8_t out[32]) {
+    static const uint8_t prefix = 0x00;
+    OptimizedSM3 sm3;
+    sm3.update(&prefix, 1);
+    sm3.update(data, len);
+    auto d = sm3.digest();
+    memcpy(out, d.data(), 32);
+}
+
+// prefix || l || r 共 65 字节，填充后固定为两个块，长度字段为 520 比特
+inline void rfc6962_node_blocks(const uint8_t l[32], const uint8_t r[32], uint8_t block[128],
+                                uint8_t prefix = 0x01) {
+    memset(block, 0, 128);
+    block[0] = prefix;
+    memcpy(block + 1, l, 32);
+    memcpy(block + 33, r, 32);
+    block[65] = 0x80;
+    block[126] = 0x02;
+    block[127] = 0x08;
+}
+
+// SM3(prefix || a || b)
+inline void sm3_prefixed_pair(uint8_t prefix, const uint8_t a[32], const uint8_t b[32], uint8_t out[32]) {
+    uint8_t block[128];
+    rfc6962_node_blocks(a, b, block, prefix);
+    uint32_t V[8];
+    memcpy(V, sm3_core::IV, sizeof(V));
+    sm3_core::compress_blocks(V, block, 2);
+    for (int i = 0; i < 8; i++) sm3_core::store_be32(out + i * 4, V[i]);
+}
+
+inline void rfc6962_hash_children(const uint8_t l[32], const uint8_t r[32], uint8_t out[32]) {
+    sm3_prefixed_pair(0x01, l, r, out);
+}
+
+// 整层形式: parents[i] = SM3(0x01 || children[2i] || children[2i+1])
+inline void rfc6962_hash_level(const uint8_t* children, uint8_t* parents, size_t n) {
+    size_t i = 0;
+#if SM3_MB_LANES > 1
+    for (; i + sm3_mb::LANES <= n; i += sm3_mb::LANES) {
+        uint8_t blocks[sm3_mb::LANES][128];
+        const uint8_t* b0[sm3_mb::LANES];
+        const uint8_t* b1[sm3_mb::LANES];
+        uint8_t* op[sm3_mb::LANES];
+        for (size_t k = 0; k < sm3_mb::LANES; k++) {
+            rfc6962_node_blocks(children + (i + k) * 64, children + (i + k) * 64 + 32, blocks[k]);
+            b0[k] = blocks[k];
+            b1[k] = blocks[k] + 64;
+            op[k] = parents + (i + k) * 32;
+        }
+        sm3_mb::vec V[8];
+        sm3_mb::init(V);
+        sm3_mb::compress(V, b0);
+        sm3_mb::compress(V, b1);
+        sm3_mb::store(V, op);
+    }
+#endif
+    for (; i < n; i++) {
+        rfc6962_hash_children(children + i * 64, children + i * 64 + 32, parents + i * 32);
+    }
+}
+
+class RFC6962Tree {
+public:
+    RFC6962Tree(const vector<vector<uint8_t>>& leaves) {
+        build(leaves, nullptr);
+    }
+
+    RFC6962Tree(const vector<vector<uint8_t>>& leaves, ThreadPool& pool) {
+        build(leaves, &pool);
+    }
+
+    size_t size() const {
+        return level_width.empty() ? 0 : level_width[0];
+    }
+
+    // 空树的根为 SM3("")
+    const Hash256& root() const {
+        return nodes.empty() ? empty_root() : nodes.back();
+    }
+
+    // 审计路径 PATH(m, D[n])，自叶子向根排列；被提升的节点在该层没有兄弟
+    ProofView proof(size_t index) const {
+        if (index >= size()) throw out_of_range("Index out of range");
+
+        ProofView proof;
+        size_t pos = index;
+        for (size_t d = 0; d + 1 < level_width.size(); d++) {
+            size_t sibling = pos ^ 1;
+            if (sibling < level_width[d]) {
+                proof.push_back(&nodes[level_offset[d] + sibling]);
+            }
+            pos /= 2;
+        }
+        return proof;
+    }
+
+    // RFC 9162 2.1.3.2 中的验证算法
+    static bool verify(
+        const vector<uint8_t>& leaf,
+        const Hash256& root,
+        size_t index,
+        size_t tree_size,
+        const ProofView& proof
+    ) {
+        if (index >= tree_size) return false;
+
+        Hash256 r;
+        rfc6962_hash_leaf(leaf.data(), leaf.size(), r.data());
+        size_t fn = index, sn = tree_size - 1;
+
+        for (const Hash256* p : proof) {
+            if (sn == 0) return false;
+            if ((fn & 1) || fn == sn) {
+                rfc6962_hash_children(p->data(), r.data(), r.data());
+                while (fn != 0 && !(fn & 1)) {
+                    fn >>= 1;
+                    sn >>= 1;
+                }
+            }
+            else {
+                rfc6962_hash_children(r.data(), p->data(), r.data());
+            }
+            fn >>= 1;
+            sn >>= 1;
+        }
+
+        return sn == 0 && r == root;
+    }
+
+    // MTH(D[lo:hi])；2^d 对齐的完整子树即第 d 层的一个节点
+    Hash256 subtree_hash(size_t lo, size_t hi) const {
+        size_t size = hi - lo;
+        if ((size & (size - 1)) == 0 && lo % size == 0) {
+            size_t d = 0;
+            while (((size_t)1 << d) < size) d++;
+            return nodes[level_offset[d] + (lo >> d)];
+        }
+        size_t k = 1;
+        while (k * 2 < size) k *= 2;
+        Hash256 l = subtree_hash(lo, lo + k), r = subtree_hash(lo + k, hi), out;
+        rfc6962_hash_children(l.data(), r.data(), out.data());
+        return out;
+    }
+
+    // 审计路径以哈希值而不是视图给出时（如 IncrementalMerkleTree::proof）
+    static bool verify(
+        const vector<uint8_t>& leaf,
+        const Hash256& root,
+        size_t index,
+        size_t tree_size,
+        const vector<Hash256>& proof
+    ) {
+        ProofView view;
+        for (const auto& h : proof) view.push_back(&h);
+        return verify(leaf, root, index, tree_size, view);
+    }
+
+    size_t memory_bytes() const {
+        return nodes.size() * sizeof(Hash256);
+    }
+
+private:
+    vector<Hash256, AlignedAllocator<Hash256, 64>> nodes;
+    vector<size_t> level_offset;
+    vector<size_t> level_width;
+
+    static const Hash256& empty_root() {
+        static const Hash256 h = [] {
+            Hash256 out;
+            OptimizedSM3 sm3;
+            auto d = sm3.digest();
+            memcpy(out.data(), d.data(), 32);
+            return out;
+        }();
+        return h;
+    }
+
+    void build(const vector<vector<uint8_t>>& leaves, ThreadPool* pool) {
+        size_t n = leaves.size();
+        if (n == 0) return;
+
+        size_t total = 0;
+        for (size_t w = n; ; w = (w + 1) / 2) {
+            level_offset.push_back(total);
+            level_width.push_back(w);
+            total += w;
+            if (w == 1) break;
+        }
+        nodes.resize(total);
+
+        parallel_range(pool, n, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                rfc6962_hash_leaf(leaves[i].data(), leaves[i].size(), nodes[i].data());
+            }
+        });
+
+        for (size_t d = 1; d < level_width.size(); d++) {
+            const Hash256* children = &nodes[level_offset[d - 1]];
+            Hash256* parents = &nodes[level_offset[d]];
+            size_t pairs = level_width[d - 1] / 2;
+            parallel_range(pool, pairs, [&](size_t begin, size_t end) {
+                rfc6962_hash_level(children[2 * begin].data(), parents[begin].data(), end - begin);
+            });
+            // 奇数层的最后一个节点原样提升
+            if (level_width[d - 1] & 1) {
+                parents[pairs] = children[level_width[d - 1] - 1];
+            }
+        }
+    }
+};
+
+// ============================== 增量 Merkle树 (只追加) ==============================
+// 与 RFC6962Tree 相同的哈希规则。frontier[d] 保存覆盖 2^d 个叶子的完整子树的根，
+// 仅当叶子数 n 的第 d 位为 1 时有效，因此追加与求根都是 O(log n)，内存也只有 O(log n)。
+// keep_nodes 为 true 时保留每一层已经完整的节点，以便之后生成审计路径
+class IncrementalMerkleTree {
+public:
+    explicit IncrementalMerkleTree(bool keep_nodes = false) : n(0), keep(keep_nodes) {}
+
+    size_t size() const { return n; }
+
+    void append(const uint8_t* data, size_t len) {
+        Hash256 h;
+        rfc6962_hash_leaf(data, len, h.data());
+        append_hash(h);
+    }
+
+    void append(const vector<uint8_t>& leaf) {
+        append(leaf.data(), leaf.size());
+    }
+
+    // 追加已经计算好的叶子哈希
+    void append_hash(Hash256 h) {
+        size_t d = 0;
+        if (keep) store(0, h);
+        while ((n >> d) & 1) {
+            rfc6962_hash_children(frontier[d].data(), h.data(), h.data());
+            d++;
+            if (keep) store(d, h);
+        }
+        if (d >= frontier.size()) frontier.resize(d + 1);
+        frontier[d] = h;
+        n++;
+    }
+
+    // 从最低的有效层向上合并 frontier
+    Hash256 root() const {
+        Hash256 r;
+        if (n == 0) {
+            OptimizedSM3 sm3;
+            auto d = sm3.digest();
+            memcpy(r.data(), d.data(), 32);
+            return r;
+        }
+        size_t d = 0;
+        while (!((n >> d) & 1)) d++;
+        r = frontier[d];
+        for (d++; d < frontier.size(); d++) {
+            if ((n >> d) & 1) rfc6962_hash_children(frontier[d].data(), r.data(), r.data());
+        }
+        return r;
+    }
+
+    // 当前大小下的审计路径，与 RFC6962Tree::proof 相同顺序；需要 keep_nodes
+    vector<Hash256> proof(size_t index) const {
+        if (!keep) throw logic_error("Proofs require keep_nodes");
+        if (index >= n) throw out_of_range("Index out of range");
+        vector<Hash256> path;
+        audit_path(index, 0, n, path);
+        return path;
+    }
+
+    size_t memory_bytes() const {
+        size_t bytes = frontier.size() * sizeof(Hash256);
+        for (const auto& level : levels) bytes += level.size() * sizeof(Hash256);
+        return bytes;
+    }
+
+    // MTH(D[lo:hi])；2^d 对齐的完整子树直接取已保存的节点
+    Hash256 subtree_hash(size_t lo, size_t hi) const {
+        size_t size = hi - lo;
+        if ((size & (size - 1)) == 0 && lo % size == 0) {
+            size_t d = 0;
+            while (((size_t)1 << d) < size) d++;
+            return levels[d][lo >> d];
+        }
+        size_t k = 1;
+        while (k * 2 < size) k *= 2;
+        Hash256 l = subtree_hash(lo, lo + k), r = subtree_hash(lo + k, hi), out;
+        rfc6962_hash_children(l.data(), r.data(), out.data());
+        return out;
+    }
+
+private:
+    size_t n;
+    bool keep;
+    vector<Hash256> frontier;
+    vector<vector<Hash256, AlignedAllocator<Hash256, 64>>> levels;
+
+    void store(size_t d, const Hash256& h) {
+        if (d >= levels.size()) levels.resize(d + 1);
+        levels[d].push_back(h);
+    }
+
+    void audit_path(size_t m, size_t lo, size_t hi, vector<Hash256>& path) const {
+        if (hi - lo <= 1) return;
+        size_t k = 1;
+        while (k * 2 < hi - lo) k *= 2;
+        if (m < lo + k) {
+            audit_path(m, lo, lo + k, path);
+            path.push_back(subtree_hash(lo + k, hi));
+        }
+        else {
+            audit_path(m, lo + k, hi, path);
+            path.push_back(subtree_hash(lo, lo + k));
+        }
+    }
+};
+
+// ============================== 一致性证明 (RFC 6962 2.1.2) ==============================
+// Tree 需提供 size() 与 subtree_hash(lo, hi)，RFC6962Tree 与保留节点的 IncrementalMerkleTree 均可
+template <typename Tree>
+static void rfc6962_subproof(const Tree& tree, size_t m, size_t lo, size_t hi, bool complete,
+                             vector<Hash256>& proof) {
+    size_t n = hi - lo;
+    if (m == n) {
+        if (!complete) proof.push_back(tree.subtree_hash(lo, hi));
+        return;
+    }
+    size_t k = 1;
+    while (k * 2 < n) k *= 2;
+    if (m <= k) {
+        rfc6962_subproof(tree, m, lo, lo + k, complete, proof);
+        proof.push_back(tree.subtree_hash(lo + k, hi));
+    }
+    else {
+        rfc6962_subproof(tree, m - k, lo + k, hi, false, proof);
+        proof.push_back(tree.subtree_hash(lo, lo + k));
+    }
+}
+
+// 证明前 m 个叶子的树是当前树的前缀，证明长度 O(log n)
+template <typename Tree>
+vector<Hash256> rfc6962_consistency_proof(const Tree& tree, size_t m) {
+    size_t n = tree.size();
+    if (m == 0 || m > n) throw out_of_range("Invalid old tree size");
+    vector<Hash256> proof;
+    rfc6962_subproof(tree, m, 0, n, true, proof);
+    return proof;
+}
+
+// RFC 9162 2.1.4.2 中的验证算法，只需 O(log n) 次哈希
+bool rfc6962_verify_consistency(size_t m, size_t n, const Hash256& old_root, const Hash256& new_root,
+                                const vector<Hash256>& proof) {
+    if (m == 0 || m > n) return false;
+    if (m == n) return proof.empty() && old_root == new_root;
+    if (proof.empty()) return false;
+
+    // m 为 2 的幂时旧根本身就是新树中的一个节点，证明中省略了它
+    vector<const Hash256*> path;
+    if ((m & (m - 1)) == 0) path.push_back(&old_root);
+    for (const auto& h : proof) path.push_back(&h);
+
+    size_t fn = m - 1, sn = n - 1;
+    while (fn & 1) {
+        fn >>= 1;
+        sn >>= 1;
+    }
+
+    Hash256 fr = *path[0], sr = *path[0];
+    for (size_t i = 1; i < path.size(); i++) {
+        const Hash256& c = *path[i];
+        if (sn == 0) return false;
+        if ((fn & 1) || fn == sn) {
+            rfc6962_hash_children(c.data(), fr.data(), fr.data());
+            rfc6962_hash_children(c.data(), sr.data(), sr.data());
+            while (fn != 0 && !(fn & 1)) {
+                fn >>= 1;
+                sn >>= 1;
+            }
+        }
+        else {
+            rfc6962_hash_children(sr.data(), c.data(), sr.data());
+        }
+        fn >>= 1;
+        sn >>= 1;
+    }
+
+    return sn == 0 && fr == old_root && sr == new_root;
+}
+
+// ============================== 稀疏 Merkle树 ==============================
+// 2^256 个槽位，键 key 的路径为 k = SM3(key)，按 k 的比特从高到低选择左(0)/右(1)。
+// 叶子哈希 SM3(0x00 || k || SM3(value))，内部节点 SM3(0x01 || l || r)，
+// 空子树使用预先计算的默认哈希 default[h]。子树中只有一个键时直接以该叶子代替整棵子树，
+// 其位置只由键集合决定，因此根与插入顺序无关，且缺失证明可以真正证明某个键不存在
+
+struct SparseProof {
+    array<uint8_t, 32> bitmap = {};   // 第 d 位为 1 表示深度 d 处的兄弟不是默认哈希
+    vector<Hash256> siblings;         // 非默认兄弟，按从根到叶的顺序
+    uint16_t depth = 0;               // 终点所在深度
+    bool has_leaf = false;            // 终点是叶子(否则为空子树)
+    Hash256 leaf_key = {};
+    Hash256 leaf_value = {};          // 终点叶子的 SM3(value)
+};
+
+class SparseMerkleTree {
+public:
+    SparseMerkleTree() : root_node(-1), count(0) {}
+
+    size_t size() const { return count; }
+
+    Hash256 root() const {
+        return root_node < 0 ? defaults()[256] : nodes[root_node].hash;
+    }
+
+    // 插入或修改
+    void update(const vector<uint8_t>& key, const vector<uint8_t>& value) {
+        Hash256 k = MerkleTree::hash_leaf(key);
+        Hash256 v = MerkleTree::hash_leaf(value);
+        root_node = insert(root_node, 0, k, v);
+    }
+
+    // 删除，键不存在时返回 false
+    bool erase(const vector<uint8_t>& key) {
+        Hash256 k = MerkleTree::hash_leaf(key);
+        bool removed = false;
+        root_node = remove(root_node, 0, k, removed);
+        if (removed) count--;
+        return removed;
+    }
+
+    // 对存在的键给出存在证明，否则给出缺失证明
+    SparseProof prove(const vector<uint8_t>& key) const {
+        Hash256 k = MerkleTree::hash_leaf(key);
+        SparseProof proof;
+        int32_t node = root_node;
+        int depth = 0;
+        while (node >= 0 && !nodes[node].leaf) {
+            int b = bit(k, depth);
+            int32_t sibling = b ? nodes[node].left : nodes[node].right;
+            if (sibling >= 0) {
+                proof.bitmap[depth >> 3] |= (uint8_t)(0x80 >> (depth & 7));
+                proof.siblings.push_back(nodes[sibling].hash);
             }
-            else {
-                low = mid + 1;
+            node = b ? nodes[node].right : nodes[node].left;
+            depth++;
+        }
+        proof.depth = (uint16_t)depth;
+        if (node >= 0) {
+            proof.has_leaf = true;
+            proof.leaf_key = nodes[node].key;
+            proof.leaf_value = nodes[node].value;
+        }
+        return proof;
+    }
+
+    // value 非空时验证 key -> *value 存在，为空时验证 key 不存在
+    static bool verify(const Hash256& root, const vector<uint8_t>& key, const vector<uint8_t>* value,
+                       const SparseProof& proof) {
+        int depth = proof.depth;
+        if (depth > 256) return false;
+        size_t expected = 0;
+        for (int d = 0; d < 256; d++) {
+            if (proof.bitmap[d >> 3] & (0x80 >> (d & 7))) {
+                if (d >= depth) return false;
+                expected++;
+            }
+        }
+        if (expected != proof.siblings.size()) return false;
+
+        Hash256 k = MerkleTree::hash_leaf(key);
+        const auto& def = defaults();
+        Hash256 h;
+        if (proof.has_leaf) {
+            // 终点叶子必须位于 k 的路径上
+            for (int d = 0; d < depth; d++) {
+                if (bit(proof.leaf_key, d) != bit(k, d)) return false;
+            }
+            if (value) {
+                if (proof.leaf_key != k || proof.leaf_value != MerkleTree::hash_leaf(*value)) return false;
+            }
+            else if (proof.leaf_key == k) {
+                return false;
             }
+            h = leaf_hash(proof.leaf_key, proof.leaf_value);
+        }
+        else {
+            if (value) return false;
+            h = def[256 - depth];
         }
 
-        // ߽
-        vector<vector<uint8_t>> predecessor_proof;
-        vector<vector<uint8_t>> successor_proof;
+        size_t idx = proof.siblings.size();
+        for (int d = depth - 1; d >= 0; d--) {
+            bool present = (proof.bitmap[d >> 3] & (0x80 >> (d & 7))) != 0;
+            const Hash256& s = present ? proof.siblings[--idx] : def[256 - d - 1];
+            if (bit(k, d)) rfc6962_hash_children(s.data(), h.data(), h.data());
+            else rfc6962_hash_children(h.data(), s.data(), h.data());
+        }
+        return h == root;
+    }
 
-        if (insert_pos > 0) {
-            predecessor_proof = proof(insert_pos - 1);
+    size_t memory_bytes() const {
+        return nodes.capacity() * sizeof(Node) + free_nodes.capacity() * sizeof(int32_t);
+    }
+
+private:
+    struct Node {
+        int32_t left, right;   // 子节点下标，-1 为空子树
+        bool leaf;
+        Hash256 key, value;    // 仅叶子使用
+        Hash256 hash;
+    };
+
+    vector<Node> nodes;
+    vector<int32_t> free_nodes;
+    int32_t root_node;
+    size_t count;
+
+    // default[h] 为高度 h 的空子树哈希
+    static const vector<Hash256>& defaults() {
+        static const vector<Hash256> table = [] {
+            vector<Hash256> t(257);
+            t[0].fill(0);
+            for (int h = 1; h <= 256; h++) rfc6962_hash_children(t[h - 1].data(), t[h - 1].data(), t[h].data());
+            return t;
+        }();
+        return table;
+    }
+
+    static int bit(const Hash256& k, int d) {
+        return (k[d >> 3] >> (7 - (d & 7))) & 1;
+    }
+
+    static Hash256 leaf_hash(const Hash256& k, const Hash256& v) {
+        Hash256 out;
+        sm3_prefixed_pair(0x00, k.data(), v.data(), out.data());
+        return out;
+    }
+
+    int32_t alloc() {
+        if (!free_nodes.empty()) {
+            int32_t n = free_nodes.back();
+            free_nodes.pop_back();
+            return n;
         }
+        if (nodes.size() >= (size_t)INT32_MAX) throw length_error("Sparse Merkle tree too large");
+        nodes.emplace_back();
+        return (int32_t)(nodes.size() - 1);
+    }
 
-        if (insert_pos < n) {
-            successor_proof = proof(insert_pos);
+    int32_t new_leaf(const Hash256& k, const Hash256& v) {
+        int32_t n = alloc();
+        Node& node = nodes[n];
+        node.left = node.right = -1;
+        node.leaf = true;
+        node.key = k;
+        node.value = v;
+        node.hash = leaf_hash(k, v);
+        return n;
+    }
+
+    int32_t new_internal(int32_t left, int32_t right, int depth) {
+        int32_t n = alloc();
+        nodes[n].left = left;
+        nodes[n].right = right;
+        nodes[n].leaf = false;
+        rehash(n, depth);
+        return n;
+    }
+
+    void rehash(int32_t n, int depth) {
+        const Hash256& def = defaults()[256 - depth - 1];
+        Node& node = nodes[n];
+        const Hash256& l = node.left >= 0 ? nodes[node.left].hash : def;
+        const Hash256& r = node.right >= 0 ? nodes[node.right].hash : def;
+        rfc6962_hash_children(l.data(), r.data(), node.hash.data());
+    }
+
+    // 两个叶子 a、b 落在深度 depth 的同一子树中，向下分裂直到路径分叉
+    int32_t split(int32_t a, int32_t b, int depth) {
+        int ba = bit(nodes[a].key, depth), bb = bit(nodes[b].key, depth);
+        if (ba == bb) {
+            int32_t child = split(a, b, depth + 1);
+            return ba ? new_internal(-1, child, depth) : new_internal(child, -1, depth);
+        }
+        return ba ? new_internal(b, a, depth) : new_internal(a, b, depth);
+    }
+
+    int32_t insert(int32_t n, int depth, const Hash256& k, const Hash256& v) {
+        if (n < 0) {
+            count++;
+            return new_leaf(k, v);
+        }
+        if (nodes[n].leaf) {
+            if (nodes[n].key == k) {
+                nodes[n].value = v;
+                nodes[n].hash = leaf_hash(k, v);
+                return n;
+            }
+            count++;
+            int32_t leaf = new_leaf(k, v);
+            return split(n, leaf, depth);
         }
+        if (bit(k, depth)) {
+            int32_t child = insert(nodes[n].right, depth + 1, k, v);
+            nodes[n].right = child;
+        }
+        else {
+            int32_t child = insert(nodes[n].left, depth + 1, k, v);
+            nodes[n].left = child;
+        }
+        rehash(n, depth);
+        return n;
+    }
 
-        return { predecessor_proof, successor_proof };
+    int32_t remove(int32_t n, int depth, const Hash256& k, bool& removed) {
+        if (n < 0) return n;
+        if (nodes[n].leaf) {
+            if (nodes[n].key != k) return n;
+            free_nodes.push_back(n);
+            removed = true;
+            return -1;
+        }
+        if (bit(k, depth)) {
+            int32_t child = remove(nodes[n].right, depth + 1, k, removed);
+            nodes[n].right = child;
+        }
+        else {
+            int32_t child = remove(nodes[n].left, depth + 1, k, removed);
+            nodes[n].left = child;
+        }
+        if (!removed) return n;
+
+        // 只剩一个叶子的子树收缩为该叶子
+        int32_t l = nodes[n].left, r = nodes[n].right;
+        if (l < 0 || r < 0) {
+            int32_t only = l < 0 ? r : l;
+            if (only < 0 || nodes[only].leaf) {
+                free_nodes.push_back(n);
+                return only;
+            }
+        }
+        rehash(n, depth);
+        return n;
+    }
+};
+
+// ============================== 大文件 SM3 ==============================
+// 标准 SM3：映射整个文件顺序压缩，或以双缓冲预读使读盘与压缩重叠。
+// 树哈希模式（需显式选择，结果不同于标准 SM3）：文件按固定大小分块，每块作为 RFC 6962 叶子
+// SM3(0x00 || chunk)，再由 IncrementalMerkleTree 合并为根；各块相互独立，可多线程、多缓冲计算
+enum class FileHashIO {
+    Mapped,     // 映射整个文件
+    Streamed    // fread + 后台预读下一块
+};
+
+static const size_t FILE_READ_CHUNK = 4 << 20;
+static const size_t FILE_TREE_CHUNK = 1 << 20;
+
+Hash256 sm3_file(const string& path, FileHashIO io = FileHashIO::Mapped) {
+    SM3Midstate m;
+    if (io == FileHashIO::Mapped) {
+        MappedFile file(path, MappedFile::Sequential);
+        m.update(file.data(), file.size());
+    }
+    else {
+        FILE* fp = fopen(path.c_str(), "rb");
+        if (!fp) throw runtime_error("Cannot open " + path);
+        {
+            PrefetchReader reader(fp, FILE_READ_CHUNK);
+            for (;;) {
+                const vector<uint8_t>& buf = reader.next();
+                if (buf.empty()) break;
+                m.update(buf.data(), buf.size());
+            }
+        }
+        bool failed = ferror(fp) != 0;
+        fclose(fp);
+        if (failed) throw runtime_error("Read failed: " + path);
+    }
+    Hash256 out;
+    m.digest(out.data());
+    return out;
+}
+
+// n 个等长块的叶子哈希 SM3(0x00 || chunk)，len 为 64 的整数倍。
+// 加上前缀后第 k 个块 (k >= 1) 恰好从 chunk + 64k - 1 开始，只有首块和尾块需要拼接，
+// 其余块直接从映射页读取；每 SM3_MB_LANES 块一组多缓冲压缩
+static void sm3_chunk_leaves(const uint8_t* const* chunks, size_t len, Hash256* out, size_t n) {
+    size_t i = 0;
+#if SM3_MB_LANES > 1
+    const size_t L = sm3_mb::LANES;
+    for (; i + L <= n; i += L) {
+        uint8_t first[sm3_mb::LANES][64], last[sm3_mb::LANES][64];
+        const uint8_t* bp[sm3_mb::LANES];
+        uint8_t* op[sm3_mb::LANES];
+        uint64_t bits = (uint64_t)(len + 1) * 8;
+        for (size_t l = 0; l < L; l++) {
+            first[l][0] = 0x00;
+            memcpy(first[l] + 1, chunks[i + l], 63);
+            memset(last[l], 0, 64);
+            last[l][0] = chunks[i + l][len - 1];
+            last[l][1] = 0x80;
+            for (int k = 0; k < 8; k++) last[l][63 - k] = (uint8_t)(bits >> (k * 8));
+            op[l] = out[i + l].data();
+        }
+
+        sm3_mb::vec V[8];
+        sm3_mb::init(V);
+        for (size_t l = 0; l < L; l++) bp[l] = first[l];
+        sm3_mb::compress(V, bp);
+        for (size_t k = 1; k < len / 64; k++) {
+            for (size_t l = 0; l < L; l++) bp[l] = chunks[i + l] + 64 * k - 1;
+            sm3_mb::compress(V, bp);
+        }
+        for (size_t l = 0; l < L; l++) bp[l] = last[l];
+        sm3_mb::compress(V, bp);
+        sm3_mb::store(V, op);
+    }
+#endif
+    for (; i < n; i++) rfc6962_hash_leaf(chunks[i], len, out[i].data());
+}
+
+// 树哈希模式，chunk_bytes 须为 64 的正整数倍；每个任务处理一组 SM3_MB_LANES 个整块
+Hash256 sm3_file_tree(const string& path, ThreadPool* pool = nullptr, size_t chunk_bytes = FILE_TREE_CHUNK) {
+    if (chunk_bytes == 0 || chunk_bytes % 64 != 0) throw invalid_argument("Chunk size must be a multiple of 64");
+    MappedFile file(path, MappedFile::Sequential);
+    size_t n = file.size();
+    size_t full = n / chunk_bytes;
+    vector<Hash256> leaves((n + chunk_bytes - 1) / chunk_bytes);
+
+    const size_t L = SM3_MB_LANES;
+    auto work = [&](size_t begin, size_t end) {
+        const uint8_t* chunks[SM3_MB_LANES];
+        for (size_t g = begin; g < end; g++) {
+            size_t first = g * L, cnt = min(L, full - first);
+            for (size_t l = 0; l < cnt; l++) chunks[l] = file.data() + (first + l) * chunk_bytes;
+            sm3_chunk_leaves(chunks, chunk_bytes, &leaves[first], cnt);
+        }
+    };
+    size_t groups = (full + L - 1) / L;
+    if (pool) pool->parallel_for(groups, 1, work);
+    else work(0, groups);
+    if (full < leaves.size()) {
+        rfc6962_hash_leaf(file.data() + full * chunk_bytes, n - full * chunk_bytes, leaves[full].data());
+    }
+
+    IncrementalMerkleTree tree;
+    for (const Hash256& h : leaves) tree.append_hash(h);
+    return tree.root();
+}
+
+// ============================== Merkle 证明服务 (Unix 域套接字) ==============================
+// 请求 12 字节 { id, index }，index 为全 1 时查询根；响应 16 字节头 + count 个 32 字节兄弟节点。
+// epoll 事件循环收集一轮就绪连接中的全部请求，由线程池整批查找证明，
+// 响应的 iovec 直接指向树内节点，用 writev 发出，不复制哈希值
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <cerrno>
+#include <climits>
+#include <chrono>
+#include <memory>
+
+namespace proof_wire {
+#pragma pack(push, 1)
+    struct Request {
+        uint32_t id;
+        uint64_t index;
+    };
+
+    struct ResponseHeader {
+        uint32_t id;
+        uint8_t status;
+        uint8_t count;      // 随后的 32 字节哈希个数
+        uint16_t reserved;
+        uint64_t tree_size;
+    };
+#pragma pack(pop)
+
+    const uint64_t ROOT_INDEX = ~0ull;
+    enum Status : uint8_t { OK = 0, OUT_OF_RANGE = 1 };
+
+    inline sockaddr_un address(const string& path) {
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path)) throw runtime_error("Socket path too long: " + path);
+        memcpy(addr.sun_path, path.c_str(), path.size());
+        return addr;
+    }
+}
+
+class MerkleProofServer {
+public:
+    // 服务期间 tree 不可修改；pool 为空时在事件循环线程中查找
+    MerkleProofServer(const MerkleTree& tree, const string& path, ThreadPool* pool = nullptr)
+        : tree(tree), path(path), pool(pool), depth(tree.proof_depth()) {
+        if (tree.size() == 0) throw logic_error("Cannot serve an empty tree");
+        sockaddr_un addr = proof_wire::address(path);
+        unlink(path.c_str());
+        listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listen_fd < 0) throw runtime_error(string("socket: ") + strerror(errno));
+        if (bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listen_fd, 128) < 0) {
+            int err = errno;
+            close(listen_fd);
+            throw runtime_error("Cannot listen on " + path + ": " + strerror(err));
+        }
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        watch(listen_fd, EPOLLIN, EPOLL_CTL_ADD);
+        watch(stop_fd, EPOLLIN, EPOLL_CTL_ADD);
+    }
+
+    ~MerkleProofServer() {
+        for (auto& kv : conns) close(kv.first);
+        close(stop_fd);
+        close(epoll_fd);
+        close(listen_fd);
+        unlink(path.c_str());
+    }
+
+    MerkleProofServer(const MerkleProofServer&) = delete;
+    MerkleProofServer& operator=(const MerkleProofServer&) = delete;
+
+    // 可从其他线程调用，run() 随后返回
+    void stop() {
+        uint64_t one = 1;
+        ssize_t r = write(stop_fd, &one, sizeof(one));
+        (void)r;
+    }
+
+    void run() {
+        epoll_event events[256];
+        vector<Pending> batch;
+        for (;;) {
+            int n = epoll_wait(epoll_fd, events, 256, -1);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                throw runtime_error(string("epoll_wait: ") + strerror(errno));
+            }
+
+            batch.clear();
+            for (int i = 0; i < n; i++) {
+                int fd = events[i].data.fd;
+                if (fd == stop_fd) return;
+                if (fd == listen_fd) {
+                    accept_all();
+                    continue;
+                }
+                auto it = conns.find(fd);
+                if (it == conns.end()) continue;
+                Connection& c = *it->second;
+                if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                    drop(fd);
+                    continue;
+                }
+                if ((events[i].events & EPOLLOUT) && !flush(c)) {
+                    drop(fd);
+                    continue;
+                }
+                if ((events[i].events & EPOLLIN) && !c.writing() && !receive(c, batch)) {
+                    drop(fd);
+                }
+            }
+            if (!batch.empty()) answer(batch);
+        }
     }
 
 private:
-    vector<vector<uint8_t>> tree;
+    struct Connection {
+        int fd;
+        vector<uint8_t> in;
+        vector<proof_wire::ResponseHeader> headers;
+        vector<iovec> iov;
+        size_t iov_pos = 0;
+        bool want_out = false;   // 当前等待可写而不是可读
+
+        bool writing() const { return iov_pos < iov.size(); }
+    };
+
+    // 每段至少包含的请求数。一次查找只是沿树收集 depth 个节点指针，远比哈希一个节点便宜，
+    // 而一轮通常只有几百到几千个请求，用 PARALLEL_GRAIN 会让整轮都落在事件循环线程上
+    static const size_t ANSWER_GRAIN = 256;
+
+    // 本轮待回答的请求；slot 为其在连接响应队列中的位置
+    struct Pending {
+        Connection* conn;
+        proof_wire::Request req;
+        size_t slot;
+    };
+
+    const MerkleTree& tree;
+    string path;
+    ThreadPool* pool;
+    size_t depth;
+    int listen_fd, epoll_fd, stop_fd;
+    bool accepting = true;      // listen_fd 是否在 epoll 集合中
+    unordered_map<int, unique_ptr<Connection>> conns;
+
+    void watch(int fd, uint32_t events, int op) {
+        epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = events;
+        ev.data.fd = fd;
+        if (epoll_ctl(epoll_fd, op, fd, &ev) < 0) throw runtime_error(string("epoll_ctl: ") + strerror(errno));
+    }
 
-    static vector<uint8_t> hash_leaf(const vector<uint8_t>& data) {
-        OptimizedSM3 sm3;
-        sm3.update(data.data(), data.size());
-        return sm3.digest();
+    // 描述符耗尽（EMFILE / ENFILE 等）时连接留在 backlog 中，水平触发的 listen_fd 会让 epoll_wait 立即返回而空转；
+    // 此时把 listen_fd 移出 epoll 集合，直到 drop() 释放一个连接
+    void accept_all() {
+        for (;;) {
+            int fd = accept4(listen_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0) {
+                if (errno == EINTR || errno == ECONNABORTED || errno == EPROTO) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) return;
+                epoll_ctl(epoll_fd, EPOLL_CTL_DEL, listen_fd, nullptr);
+                accepting = false;
+                return;
+            }
+            unique_ptr<Connection> c(new Connection());
+            c->fd = fd;
+            conns[fd] = move(c);
+            watch(fd, EPOLLIN, EPOLL_CTL_ADD);
+        }
     }
 
-    static vector<uint8_t> hash_node(const vector<uint8_t>& left, const vector<uint8_t>& right) {
-        OptimizedSM3 sm3;
-        sm3.update(left.data(), left.size());
-        sm3.update(right.data(), right.size());
-        return sm3.digest();
+    void drop(int fd) {
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        close(fd);
+        conns.erase(fd);
+        if (!accepting) {
+            accepting = true;
+            watch(listen_fd, EPOLLIN, EPOLL_CTL_ADD);
+        }
+    }
+
+    // 读入并解析完整的请求，单次最多 64 KiB 以限制每轮批量
+    bool receive(Connection& c, vector<Pending>& batch) {
+        uint8_t buf[65536];
+        ssize_t r = read(c.fd, buf, sizeof(buf));
+        if (r == 0) return false;
+        if (r < 0) return errno == EAGAIN || errno == EINTR;
+        c.in.insert(c.in.end(), buf, buf + r);
+
+        size_t count = c.in.size() / sizeof(proof_wire::Request);
+        c.headers.resize(count);
+        c.iov.resize(count * (depth + 1));
+        c.iov_pos = 0;
+        for (size_t i = 0; i < count; i++) {
+            Pending p;
+            p.conn = &c;
+            memcpy(&p.req, c.in.data() + i * sizeof(proof_wire::Request), sizeof(proof_wire::Request));
+            p.slot = i;
+            batch.push_back(p);
+        }
+        c.in.erase(c.in.begin(), c.in.begin() + count * sizeof(proof_wire::Request));
+        return true;
+    }
+
+    // 每个响应固定占 depth + 1 个 iovec，未用的置为零长度，各请求可独立并行填写
+    void answer(vector<Pending>& batch) {
+        auto fill = [&](size_t begin, size_t end) {
+            const Hash256* path_nodes[64];
+            for (size_t i = begin; i < end; i++) {
+                Connection& c = *batch[i].conn;
+                const proof_wire::Request& req = batch[i].req;
+                proof_wire::ResponseHeader& h = c.headers[batch[i].slot];
+                iovec* iov = &c.iov[batch[i].slot * (depth + 1)];
+                h.id = req.id;
+                h.reserved = 0;
+                h.tree_size = tree.size();
+                h.count = 0;
+                if (req.index == proof_wire::ROOT_INDEX) {
+                    h.status = proof_wire::OK;
+                    h.count = 1;
+                    iov[1].iov_base = (void*)tree.root().data();
+                    iov[1].iov_len = 32;
+                }
+                else if (req.index >= tree.size()) {
+                    h.status = proof_wire::OUT_OF_RANGE;
+                }
+                else {
+                    h.status = proof_wire::OK;
+                    h.count = (uint8_t)depth;
+                    tree.proof((size_t)req.index, path_nodes);
+                    for (size_t d = 0; d < depth; d++) {
+                        iov[d + 1].iov_base = (void*)path_nodes[d]->data();
+                        iov[d + 1].iov_len = 32;
+                    }
+                }
+                iov[0].iov_base = &h;
+                iov[0].iov_len = sizeof(h);
+                for (size_t d = h.count; d < depth; d++) iov[d + 1].iov_len = 0;
+            }
+        };
+        if (pool) pool->parallel_for(batch.size(), ANSWER_GRAIN, fill);
+        else fill((size_t)0, batch.size());
+
+        for (size_t i = 0; i < batch.size(); i++) {
+            Connection* c = batch[i].conn;
+            if (batch[i].slot + 1 == c->headers.size() && !flush(*c)) drop(c->fd);
+        }
+    }
+
+    // 写出剩余响应；写不完时改为等待可写，期间不再读取该连接（背压）
+    bool flush(Connection& c) {
+        while (c.iov_pos < c.iov.size()) {
+            int cnt = (int)min<size_t>(c.iov.size() - c.iov_pos, IOV_MAX);
+            ssize_t w = writev(c.fd, &c.iov[c.iov_pos], cnt);
+            if (w < 0) {
+                if (errno == EINTR) continue;
+                if (errno != EAGAIN) return false;
+                if (!c.want_out) watch(c.fd, EPOLLOUT, EPOLL_CTL_MOD);
+                c.want_out = true;
+                return true;
+            }
+            size_t left = (size_t)w;
+            while (c.iov_pos < c.iov.size() && left >= c.iov[c.iov_pos].iov_len) {
+                left -= c.iov[c.iov_pos].iov_len;
+                c.iov_pos++;
+            }
+            if (left > 0) {
+                c.iov[c.iov_pos].iov_base = (uint8_t*)c.iov[c.iov_pos].iov_base + left;
+                c.iov[c.iov_pos].iov_len -= left;
+            }
+        }
+        c.iov.clear();
+        c.headers.clear();
+        c.iov_pos = 0;
+        if (c.want_out) watch(c.fd, EPOLLIN, EPOLL_CTL_MOD);
+        c.want_out = false;
+        return true;
     }
 };
 
-// ==============================  ==============================
+// ---------- 负载生成 ----------
+struct ProofLoadResult {
+    size_t proofs = 0;
+    size_t failures = 0;
+    double seconds = 0;
+    double p50_us = 0, p99_us = 0;
+};
+
+// 每个连接保持 pipeline 个未完成请求，随机下标；leaves 非空时逐个验证收到的证明
+ProofLoadResult proof_load(const string& path, size_t connections, size_t requests_per_conn, size_t pipeline,
+                           const vector<vector<uint8_t>>* leaves = nullptr) {
+    typedef chrono::steady_clock Clock;
+    vector<vector<double>> latencies(connections);
+    vector<size_t> failures(connections, 0);
+    vector<thread> clients;
+    if (pipeline == 0) pipeline = 1;
+
+    auto t0 = Clock::now();
+    for (size_t t = 0; t < connections; t++) {
+        clients.emplace_back([&, t] {
+            int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            sockaddr_un addr = proof_wire::address(path);
+            if (fd < 0 || connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+                failures[t] = requests_per_conn;
+                if (fd >= 0) close(fd);
+                return;
+            }
+
+            // 带缓冲的阻塞读
+            vector<uint8_t> rbuf(65536);
+            size_t rpos = 0, rlen = 0;
+            auto read_exact = [&](void* dst, size_t n) {
+                uint8_t* p = (uint8_t*)dst;
+                while (n > 0) {
+                    if (rpos == rlen) {
+                        ssize_t r = read(fd, rbuf.data(), rbuf.size());
+                        if (r <= 0) return false;
+                        rpos = 0;
+                        rlen = (size_t)r;
+                    }
+                    size_t k = min(n, rlen - rpos);
+                    memcpy(p, rbuf.data() + rpos, k);
+                    rpos += k; p += k; n -= k;
+                }
+                return true;
+            };
+            auto write_all = [&](const void* src, size_t n) {
+                const uint8_t* p = (const uint8_t*)src;
+                while (n > 0) {
+                    ssize_t w = write(fd, p, n);
+                    if (w <= 0) return false;
+                    p += w; n -= (size_t)w;
+                }
+                return true;
+            };
+
+            proof_wire::ResponseHeader h;
+            Hash256 root;
+            proof_wire::Request info = { 0xffffffffu, proof_wire::ROOT_INDEX };
+            if (!write_all(&info, sizeof(info)) || !read_exact(&h, sizeof(h)) || h.count != 1 ||
+                !read_exact(root.data(), 32)) {
+                failures[t] = requests_per_conn;
+                close(fd);
+                return;
+            }
+            uint64_t tree_size = h.tree_size;
+
+            vector<Clock::time_point> sent_at(requests_per_conn);
+            vector<uint64_t> index_of(requests_per_conn);
+            vector<proof_wire::Request> out;
+            vector<Hash256> sib(64);
+            ProofView view;
+            uint64_t x = 0x9e3779b97f4a7c15ull * (t + 1);
+            size_t sent = 0, received = 0;
+            latencies[t].reserve(requests_per_conn);
+
+            while (received < requests_per_conn) {
+                // 未完成请求降到一半以下时一次补满，减少系统调用
+                if (sent < requests_per_conn && sent - received <= pipeline / 2) {
+                    out.clear();
+                    auto now = Clock::now();
+                    while (sent < requests_per_conn && sent - received < pipeline) {
+                        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+                        index_of[sent] = x % tree_size;
+                        sent_at[sent] = now;
+                        out.push_back({ (uint32_t)sent, index_of[sent] });
+                        sent++;
+                    }
+                    if (!write_all(out.data(), out.size() * sizeof(proof_wire::Request))) break;
+                }
+
+                if (!read_exact(&h, sizeof(h)) || h.id >= requests_per_conn || h.count > sib.size() ||
+                    !read_exact(sib.data(), h.count * 32)) break;
+                latencies[t].push_back(chrono::duration<double, micro>(Clock::now() - sent_at[h.id]).count());
+                received++;
+
+                bool ok = h.status == proof_wire::OK;
+                if (ok && leaves) {
+                    view.clear();
+                    for (size_t d = 0; d < h.count; d++) view.push_back(&sib[d]);
+                    ok = MerkleTree::verify((*leaves)[index_of[h.id]], root, index_of[h.id], tree_size, view);
+                }
+                if (!ok) failures[t]++;
+            }
+            failures[t] += requests_per_conn - received;
+            close(fd);
+        });
+    }
+    for (auto& c : clients) c.join();
+    auto t1 = Clock::now();
+
+    ProofLoadResult res;
+    vector<double> all;
+    for (size_t t = 0; t < connections; t++) {
+        all.insert(all.end(), latencies[t].begin(), latencies[t].end());
+        res.failures += failures[t];
+    }
+    res.proofs = all.size();
+    res.seconds = chrono::duration<double>(t1 - t0).count();
+    if (!all.empty()) {
+        sort(all.begin(), all.end());
+        res.p50_us = all[all.size() / 2];
+        res.p99_us = all[min(all.size() - 1, all.size() * 99 / 100)];
+    }
+    return res;
+}
+#endif
+
+// ============================== 辅助函数 ==============================
 string hex_str(const vector<uint8_t>& data) {
     static const char* hex_digits = "0123456789abcdef";
     string result;
@@ -623,11 +4682,28 @@ string hex_str(const vector<uint8_t>& data) {
     return result;
 }
 
+string hex_str(const Hash256& data) {
+    return hex_str(vector<uint8_t>(data.begin(), data.end()));
+}
+
 vector<uint8_t> str_to_vec(const string& s) {
     return vector<uint8_t>(s.begin(), s.end());
 }
 
-// ============================== Ժ ==============================
+// 测试与基准共用的叶子："leaf0" .. "leaf{n-1}"
+vector<vector<uint8_t>> make_leaves(size_t n) {
+    vector<vector<uint8_t>> leaves(n);
+    for (size_t i = 0; i < n; i++) leaves[i] = str_to_vec("leaf" + to_string(i));
+    return leaves;
+}
+
+vector<uint8_t> hex_to_vec(const string& hex) {
+    vector<uint8_t> out(hex.size() / 2);
+    for (size_t i = 0; i < out.size(); i++) out[i] = (uint8_t)strtoul(hex.substr(i * 2, 2).c_str(), nullptr, 16);
+    return out;
+}
+
+// ============================== 测试函数 ==============================
 void test_sm3() {
     SM3 sm3;
     string test_str = "abc";
@@ -661,57 +4737,504 @@ void test_length_extension() {
     string original_msg = "data";
     string extension = "append";
 
-    // ԭʼϢĹϣ
-    OptimizedSM3 sm3;
-    sm3.update((const uint8_t*)secret.data(), secret.size());
-    sm3.update((const uint8_t*)original_msg.data(), original_msg.size());
-    auto original_hash = sm3.digest();
+    // 原始消息的哈希
+    OptimizedSM3 sm3;
+    sm3.update((const uint8_t*)secret.data(), secret.size());
+    sm3.update((const uint8_t*)original_msg.data(), original_msg.size());
+    auto original_hash = sm3.digest();
+
+    // 长度扩展攻击
+    size_t total_len = secret.size() + original_msg.size();
+    auto forged_hash = length_extension_attack(
+        original_hash,
+        total_len,
+        str_to_vec(extension)
+    );
+
+    // 验证攻击结果: SM3(secret || msg || 填充 || 扩展)
+    sm3.reset();
+    sm3.update((const uint8_t*)secret.data(), secret.size());
+
+    // 添加填充后附加扩展
+    vector<uint8_t> padded_msg = str_to_vec(original_msg);
+    size_t pad_len = (55 - (total_len % 64) + 64) % 64;
+    padded_msg.push_back(0x80);
+    padded_msg.insert(padded_msg.end(), pad_len, 0);
+    uint64_t bit_len = total_len * 8;
+    for (int i = 7; i >= 0; i--) {
+        padded_msg.push_back((bit_len >> (i * 8)) & 0xFF);
+    }
+    padded_msg.insert(padded_msg.end(), extension.begin(), extension.end());
+
+    sm3.update(padded_msg.data(), padded_msg.size());
+    auto real_hash = sm3.digest();
+
+    cout << "Length Extension Attack: "
+        << (forged_hash == real_hash ? "SUCCESS" : "FAILED")
+        << endl;
+}
+
+void test_length_extension_sweep() {
+    string secret = "unknown-secret-key";
+    vector<uint8_t> msg = str_to_vec("user=guest&role=reader");
+    OptimizedSM3 sm3;
+    sm3.update((const uint8_t*)secret.data(), secret.size());
+    sm3.update(msg.data(), msg.size());
+    auto mac = sm3.digest();
+
+    // 扩展长度覆盖 1 个、2 个尾块以及含整块的情况
+    bool ok = true, hit = true;
+    const size_t ext_lens[] = { 10, 60, 150 };
+    for (size_t el : ext_lens) {
+        vector<uint8_t> ext(el);
+        for (size_t i = 0; i < el; i++) ext[i] = (uint8_t)('a' + i % 26);
+        size_t seen = 0;
+        bool found = false;
+        length_extension_sweep(mac, msg.size(), 1, 300, ext,
+            [&](size_t s, const uint8_t* glue, size_t glue_len, const uint8_t* digest) {
+                auto single = length_extension_attack(mac, s + msg.size(), ext);
+                ok = ok && s == seen + 1 && memcmp(single.data(), digest, 32) == 0;
+                seen = s;
+                if (s != secret.size()) return;
+                OptimizedSM3 real;
+                real.update((const uint8_t*)secret.data(), secret.size());
+                real.update(msg.data(), msg.size());
+                real.update(glue, glue_len);
+                real.update(ext.data(), ext.size());
+                found = memcmp(real.digest().data(), digest, 32) == 0;
+            });
+        ok = ok && seen == 300;
+        hit = hit && found;
+    }
+
+    FILE* fp = tmpfile();
+    size_t rows = fp ? length_extension_sweep(mac, msg.size(), 5, 24, str_to_vec("&role=admin"), fp, SweepFormat::Csv) : 0;
+    size_t lines = 0;
+    if (fp) {
+        rewind(fp);
+        for (int c; (c = fgetc(fp)) != EOF;) lines += c == '\n';
+        fclose(fp);
+    }
+    ok = ok && rows == 20 && lines == 20;
+
+    // 二进制记录的长度字段只有 32 位
+    bool threw = false;
+    try { length_extension_sweep(mac, msg.size(), 1, (size_t)((uint64_t)1 << 32), str_to_vec("x"), stdout, SweepFormat::Binary); }
+    catch (const invalid_argument&) { threw = true; }
+    ok = ok && threw;
+
+    cout << "Length extension sweep (300 candidate lengths): " << (ok && hit ? "PASSED" : "FAILED") << endl;
+}
+
+void test_sm3_core() {
+    // 各种长度下快速核心与基础实现逐一比对，覆盖 1 块/2 块填充边界
+    vector<uint8_t> msg(300);
+    for (size_t i = 0; i < msg.size(); i++) msg[i] = (uint8_t)(i * 31 + 7);
+
+    bool ok = true;
+    for (size_t len = 0; len <= msg.size() && ok; len++) {
+        SM3 ref;
+        ref.update(msg.data(), len);
+        OptimizedSM3 opt;
+        opt.update(msg.data(), len);
+        ok = ref.digest() == opt.digest();
+    }
+
+    uint32_t v1[8], v2[8];
+    memcpy(v1, sm3_core::IV, sizeof(v1));
+    memcpy(v2, sm3_core::IV, sizeof(v2));
+    sm3_core::compress_blocks_scalar(v1, msg.data(), 4);
+#ifdef SM3_SIMD_EXPAND
+    sm3_core::compress_blocks_simd(v2, msg.data(), 4);
+#else
+    sm3_core::compress_blocks_scalar(v2, msg.data(), 4);
+#endif
+    ok = ok && memcmp(v1, v2, sizeof(v1)) == 0;
+
+    cout << "SM3 core (0..300 bytes, scalar/SIMD): " << (ok ? "PASSED" : "FAILED") << endl;
+}
+
+void test_sm3_64() {
+    // 定长 64 字节、批量、整层三种形式都与通用实现比对；n 不是通道数的整数倍
+    const size_t n = 37;
+    vector<uint8_t> children(n * 64), parents(n * 32), batch_out(n * 32);
+    for (size_t i = 0; i < children.size(); i++) children[i] = (uint8_t)(i * 131 + 17);
+
+    vector<const uint8_t*> lp(n), rp(n);
+    vector<uint8_t*> op(n);
+    for (size_t i = 0; i < n; i++) {
+        lp[i] = &children[i * 64];
+        rp[i] = &children[i * 64 + 32];
+        op[i] = &batch_out[i * 32];
+    }
+    sm3_64_batch(lp.data(), rp.data(), op.data(), n);
+    sm3_64_level(children.data(), parents.data(), n);
+
+    bool ok = true;
+    for (size_t i = 0; i < n; i++) {
+        OptimizedSM3 sm3;
+        sm3.update(&children[i * 64], 64);
+        auto ref = sm3.digest();
+        uint8_t single[32];
+        sm3_64(lp[i], rp[i], single);
+        ok = ok && memcmp(single, ref.data(), 32) == 0
+            && memcmp(&batch_out[i * 32], ref.data(), 32) == 0
+            && memcmp(&parents[i * 32], ref.data(), 32) == 0;
+    }
+    cout << "SM3-64 (single/batch/level, " << SM3_MB_LANES << " lanes): "
+        << (ok ? "PASSED" : "FAILED") << endl;
+}
+
+void test_sm3_midstate() {
+    // 前缀/后缀长度覆盖块边界与两个填充块的情况
+    const size_t lens[] = { 0, 1, 55, 56, 63, 64, 65, 119, 120, 200 };
+    vector<uint8_t> msg(400);
+    for (size_t i = 0; i < msg.size(); i++) msg[i] = (uint8_t)(i * 73 + 5);
+
+    bool ok = true;
+    SM3PrefixCache cache;
+    for (size_t p : lens) {
+        OptimizedSM3 prefix;
+        prefix.update(msg.data(), p);
+        SM3Midstate snap = prefix.checkpoint();
+        cache.add(p, msg.data(), p);
+        for (size_t s : lens) {
+            OptimizedSM3 full;
+            full.update(msg.data(), p + s);
+            auto ref = full.digest();
+
+            uint8_t out[32], cached[32];
+            SM3Midstate m = snap;
+            m.update(msg.data() + p, s);
+            m.digest(out);
+            cache.hash(p, msg.data() + p, s, cached);
+
+            OptimizedSM3 resumed;
+            resumed.restore(snap);
+            resumed.update(msg.data() + p, s);
+            ok = ok && memcmp(out, ref.data(), 32) == 0 && memcmp(cached, ref.data(), 32) == 0 &&
+                 resumed.digest() == ref;
+        }
+    }
+    bool threw = false;
+    try {
+        cache.get(12345);
+    }
+    catch (const out_of_range&) {
+        threw = true;
+    }
+    cout << "SM3 midstate checkpoint / prefix cache: " << (ok && threw ? "PASSED" : "FAILED") << endl;
+}
+
+void test_sm3_batch() {
+    // 37 条不同长度的消息（不是通道数的整数倍），一半从 128 字节前缀的中间状态继续
+    const size_t n = 37;
+    vector<uint8_t> msg(2000);
+    for (size_t i = 0; i < msg.size(); i++) msg[i] = (uint8_t)(i * 31 + 7);
+    vector<const uint8_t*> data(n);
+    vector<size_t> lens(n);
+    vector<array<uint8_t, 32>> out(n), out_from(n);
+    vector<uint8_t*> op(n), op_from(n);
+    SM3Midstate prefix;
+    prefix.update(msg.data(), 128);
+    vector<const SM3Midstate*> starts(n, &prefix);
+    for (size_t i = 0; i < n; i++) {
+        lens[i] = (i * 53) % 300;
+        data[i] = msg.data() + 128 + i;
+        op[i] = out[i].data();
+        op_from[i] = out_from[i].data();
+    }
+    sm3_batch(data.data(), lens.data(), op.data(), n);
+    sm3_batch_from(starts.data(), data.data(), lens.data(), op_from.data(), n);
+
+    bool ok = true;
+    for (size_t i = 0; i < n; i++) {
+        OptimizedSM3 a, b;
+        a.update(data[i], lens[i]);
+        b.update(msg.data(), 128);
+        b.update(data[i], lens[i]);
+        auto ra = a.digest(), rb = b.digest();
+        ok = ok && memcmp(out[i].data(), ra.data(), 32) == 0 && memcmp(out_from[i].data(), rb.data(), 32) == 0;
+    }
+    cout << "Multi-buffer SM3 batch: " << (ok ? "PASSED" : "FAILED") << endl;
+}
+
+// 按定义直接计算的 HMAC，作为参照
+static vector<uint8_t> hmac_sm3_reference(const vector<uint8_t>& key, const vector<uint8_t>& msg) {
+    vector<uint8_t> k = key;
+    if (k.size() > 64) {
+        OptimizedSM3 h;
+        h.update(k.data(), k.size());
+        k = h.digest();
+    }
+    k.resize(64, 0);
+    vector<uint8_t> ipad(64), opad(64);
+    for (int i = 0; i < 64; i++) {
+        ipad[i] = k[i] ^ 0x36;
+        opad[i] = k[i] ^ 0x5c;
+    }
+    OptimizedSM3 inner;
+    inner.update(ipad.data(), 64);
+    inner.update(msg.data(), msg.size());
+    auto ih = inner.digest();
+    OptimizedSM3 outer;
+    outer.update(opad.data(), 64);
+    outer.update(ih.data(), ih.size());
+    return outer.digest();
+}
+
+void test_hmac_sm3() {
+    const size_t key_lens[] = { 0, 16, 64, 65, 100 };
+    vector<HmacSM3> keys;
+    vector<vector<uint8_t>> raw_keys;
+    for (size_t kl : key_lens) {
+        vector<uint8_t> k(kl);
+        for (size_t i = 0; i < kl; i++) k[i] = (uint8_t)(i * 29 + kl);
+        raw_keys.push_back(k);
+        keys.emplace_back(k);
+    }
+
+    // 37 条长度不同的消息、混用 5 个密钥，覆盖一个与两个填充块以及不满一组的情况
+    const size_t n = 37;
+    vector<vector<uint8_t>> msgs(n);
+    vector<const HmacSM3*> kp(n);
+    vector<const uint8_t*> dp(n);
+    vector<size_t> lens(n);
+    vector<vector<uint8_t>> batch_out(n, vector<uint8_t>(32));
+    vector<uint8_t*> op(n);
+    for (size_t i = 0; i < n; i++) {
+        msgs[i].resize((i * 37) % 300);
+        for (size_t j = 0; j < msgs[i].size(); j++) msgs[i][j] = (uint8_t)(i + j * 7);
+        kp[i] = &keys[i % keys.size()];
+        dp[i] = msgs[i].data();
+        lens[i] = msgs[i].size();
+        op[i] = batch_out[i].data();
+    }
+    hmac_sm3_batch(kp.data(), dp.data(), lens.data(), op.data(), n);
+
+    bool ok = true;
+    for (size_t i = 0; i < n; i++) {
+        auto ref = hmac_sm3_reference(raw_keys[i % keys.size()], msgs[i]);
+        ok = ok && kp[i]->mac(msgs[i]) == ref && batch_out[i] == ref;
+    }
+
+    // 单密钥批量接口
+    keys[1].mac_batch(dp.data(), lens.data(), op.data(), n);
+    for (size_t i = 0; i < n; i++) ok = ok && batch_out[i] == hmac_sm3_reference(raw_keys[1], msgs[i]);
+
+    cout << "HMAC-SM3 (precomputed states, batch x" << SM3_MB_LANES << "): " << (ok ? "PASSED" : "FAILED") << endl;
+}
+
+// 多个线程并发提交，混合 SM3 / HMAC、单条与成批提交、轮询与回调两种完成方式
+static void job_done_counter(Sm3Job* job) {
+    static_cast<atomic<size_t>*>(job->user)->fetch_add(1);
+}
+
+void test_sm3_job_queue() {
+    const size_t producers = 4, per = 300;
+    vector<uint8_t> msg(1000);
+    for (size_t i = 0; i < msg.size(); i++) msg[i] = (uint8_t)(i * 13 + 1);
+    vector<uint8_t> raw_key(20, 0x0b);
+    HmacSM3 key(raw_key);
+
+    vector<vector<Sm3Job>> jobs(producers);
+    for (auto& v : jobs) v = vector<Sm3Job>(per);
+    atomic<size_t> callbacks(0);
+    {
+        Sm3JobQueue queue(3, chrono::microseconds(200));
+        vector<thread> threads;
+        for (size_t p = 0; p < producers; p++) {
+            threads.emplace_back([&, p] {
+                vector<Sm3Job*> pending;
+                for (size_t i = 0; i < per; i++) {
+                    Sm3Job& j = jobs[p][i];
+                    j.kind = (i + p) % 3 == 0 ? Sm3Job::Hmac : Sm3Job::Hash;
+                    j.key = &key;
+                    j.data = msg.data() + (i * 7) % 300;
+                    j.len = (i * 37 + p) % 600;
+                    if (i % 2) {
+                        j.callback = job_done_counter;
+                        j.user = &callbacks;
+                    }
+                    if (p % 2) queue.submit(&j);
+                    else pending.push_back(&j);
+                    if (pending.size() == 10) {
+                        queue.submit(pending.data(), pending.size());
+                        pending.clear();
+                    }
+                }
+                queue.submit(pending.data(), pending.size());
+                for (size_t i = 0; i < per; i += 2) {
+                    if (p < 2) jobs[p][i].wait();
+                    else queue.wait(&jobs[p][i]);   // 等待期间代为执行
+                }
+            });
+        }
+        for (auto& t : threads) t.join();
+        while (callbacks.load() < producers * per / 2) this_thread::yield();
+    }
+
+    bool ok = callbacks.load() == producers * per / 2;
+    for (size_t p = 0; p < producers; p++) {
+        for (size_t i = 0; i < per; i++) {
+            const Sm3Job& j = jobs[p][i];
+            vector<uint8_t> data(j.data, j.data + j.len), ref;
+            if (j.kind == Sm3Job::Hmac) {
+                ref = hmac_sm3_reference(raw_key, data);
+            }
+            else {
+                OptimizedSM3 h;
+                h.update(data.data(), data.size());
+                auto d = h.digest();
+                ref.assign(d.begin(), d.end());
+            }
+            ok = ok && memcmp(j.digest, ref.data(), 32) == 0;
+        }
+    }
+    cout << "Async SM3 job queue (" << producers << " producers, 3 workers): " << (ok ? "PASSED" : "FAILED") << endl;
+}
 
-    // չ
-    size_t total_len = secret.size() + original_msg.size();
-    auto forged_hash = length_extension_attack(
-        original_hash,
-        total_len,
-        str_to_vec(extension)
-    );
+void test_sm3_kdf() {
+    // Z 的长度使末尾块分别为 1 个或 2 个，60..63 与 124 时 ct 填满 Z 的残余块；输出长度覆盖截断与不满一组
+    const size_t zlens[] = { 1, 51, 52, 60, 61, 62, 63, 64, 100, 124 };
+    const size_t klens[] = { 0, 1, 32, 33, 1000 };
+    bool ok = true;
+    for (size_t zl : zlens) {
+        vector<uint8_t> z(zl);
+        for (size_t i = 0; i < zl; i++) z[i] = (uint8_t)(i * 7 + zl);
+        for (size_t kl : klens) {
+            vector<uint8_t> ref;
+            for (uint32_t ct = 1; ref.size() < kl; ct++) {
+                uint8_t c[4] = { (uint8_t)(ct >> 24), (uint8_t)(ct >> 16), (uint8_t)(ct >> 8), (uint8_t)ct };
+                OptimizedSM3 sm3;
+                sm3.update(z.data(), z.size());
+                sm3.update(c, 4);
+                auto h = sm3.digest();
+                ref.insert(ref.end(), h.begin(), h.end());
+            }
+            ref.resize(kl);
+            ok = ok && sm3_kdf(z, kl) == ref;
+        }
+    }
+    cout << "SM3 KDF (GB/T 32918, " << SM3_MB_LANES << " lanes): " << (ok ? "PASSED" : "FAILED") << endl;
+}
 
-    // ֤
-    sm3.reset();
-    sm3.update((const uint8_t*)secret.data(), secret.size());
-    sm3.update((const uint8_t*)original_msg.data(), original_msg.size());
+void test_sm2() {
+    // GB/T 32918 推荐曲线示例：ID = "1234567812345678"，M = "message digest"
+    auto d = hex_to_vec("3945208f7b2144b13f36e38ac6d39f95889393692860b51a42fb81ef4df7c5b8");
+    auto k = hex_to_vec("59276e27d506861a16680f3ad9c02dccef3cc1fa3cdbe4ce6d54b80deac1bc21");
+    const string msg = "message digest";
+    Sm2PrivateKey key(d.data());
+    vector<uint8_t> x(32), y(32), e(32);
+    key.public_key().x(x.data());
+    key.public_key().y(y.data());
+    bool ok = hex_str(x) == "09f9df311e5421a150dd7d161e4bc5c672179fad1833fc076bb08ff356f35020" &&
+              hex_str(y) == "ccea490ce26775a52dc6ea718cc1aa600aed05fbf35e084a6632f6072da9ad13";
+    key.public_key().digest((const uint8_t*)msg.data(), msg.size(), e.data());
+    Sm2Signature sig = key.sign_digest(e.data(), k.data());
+    ok = ok && hex_str(vector<uint8_t>(sig.r, sig.r + 32)) ==
+                   "f5a03b0648d2c4630eeac513e1bb81a15944da3827d5b74143ac7eaceee720b3" &&
+         hex_str(vector<uint8_t>(sig.s, sig.s + 32)) ==
+             "b1b6aa29df212fd8763182bc0d421ca1bb9038fd1f7f42d4840b69c485bbc1aa";
+    ok = ok && key.public_key().verify((const uint8_t*)msg.data(), msg.size(), sig);
+
+    // 随机密钥往返；篡改消息、签名或换用其他公钥 / ID 均应失败
+    for (int i = 0; i < 50 && ok; i++) {
+        Sm2PrivateKey kp = Sm2PrivateKey::generate();
+        vector<uint8_t> m(i * 13);
+        for (size_t j = 0; j < m.size(); j++) m[j] = (uint8_t)(j * 31 + i);
+        Sm2Signature s = kp.sign(m.data(), m.size());
+        ok = kp.public_key().verify(m.data(), m.size(), s) && !key.public_key().verify(m.data(), m.size(), s);
+        Sm2Signature bad = s;
+        bad.s[31 - i % 32] ^= (uint8_t)(1 << (i % 8));
+        ok = ok && !kp.public_key().verify(m.data(), m.size(), bad);
+        if (!m.empty()) {
+            m[i % m.size()] ^= 0x80;
+            ok = ok && !kp.public_key().verify(m.data(), m.size(), s);
+        }
+        kp.public_key().x(x.data());
+        kp.public_key().y(y.data());
+        Sm2PublicKey other_id(x.data(), y.data(), "ALICE123@YAHOO.COM");
+        ok = ok && !other_id.verify(m.data(), m.size(), s);
+    }
 
-    // 󸽼չ
-    vector<uint8_t> padded_msg = str_to_vec(original_msg);
-    size_t pad_len = (55 - (total_len % 64) + 64) % 64;
-    padded_msg.push_back(0x80);
-    padded_msg.insert(padded_msg.end(), pad_len, 0);
-    uint64_t bit_len = total_len * 8;
-    for (int i = 7; i >= 0; i--) {
-        padded_msg.push_back((bit_len >> (i * 8)) & 0xFF);
+    // r、s 越界（0 与 n）被拒绝
+    Sm2Signature zero = sig;
+    memset(zero.r, 0, 32);
+    ok = ok && !key.public_key().verify((const uint8_t*)msg.data(), msg.size(), zero);
+    Sm2Signature big = sig;
+    sm2::to_bytes(big.s, sm2::N);
+    ok = ok && !key.public_key().verify((const uint8_t*)msg.data(), msg.size(), big);
+
+    // 常量时间定长窗口、固定基查表与 wNAF 的 k·G 一致，覆盖奇偶、窗口边界与接近 n 的标量
+    const uint64_t small[] = { 1, 2, 3, 15, 16, 17, 31, 32, 33, 63, 64, 65, 0xFFFF };
+    vector<sm2::u256> scalars;
+    for (uint64_t v : small) {
+        scalars.push_back(sm2::u256{ { v, 0, 0, 0 } });
+        sm2::u256 t;
+        sm2::sub256(t, sm2::N, sm2::u256{ { v, 0, 0, 0 } });
+        scalars.push_back(t);
+    }
+    for (int i = 0; i < 10; i++) {
+        sm2::u256 t;
+        sm2::random_scalar(t);
+        scalars.push_back(t);
+    }
+    // 固定基表的例外情形：k = 2^256 - n 时最高位加法遇到相同点，偶数 k = n - (2^256 - n) 同理
+    sm2::u256 c, t;
+    sm2::sub256(c, sm2::u256{ { 0, 0, 0, 0 } }, sm2::N);
+    scalars.push_back(c);
+    sm2::sub256(t, sm2::N, c);
+    scalars.push_back(t);
+    const sm2::jpoint* gt = sm2::g_odd_multiples();
+    for (const sm2::u256& s : scalars) {
+        sm2::jpoint a, b, f;
+        sm2::apoint aa, ba, fa;
+        sm2::scalar_mult_ct(a, s, gt);
+        sm2::double_mult(b, s, sm2::u256{ { 0, 0, 0, 0 } }, gt);
+        sm2::scalar_mult_base(f, s);
+        sm2::to_affine(aa, a);
+        sm2::to_affine(ba, b);
+        sm2::to_affine(fa, f);
+        ok = ok && sm2::equal(aa.x, ba.x) && sm2::equal(aa.y, ba.y) && sm2::on_curve(aa);
+        ok = ok && sm2::equal(aa.x, fa.x) && sm2::equal(aa.y, fa.y);
     }
-    padded_msg.insert(padded_msg.end(), extension.begin(), extension.end());
 
-    sm3.update(padded_msg.data() + secret.size(), padded_msg.size() - secret.size());
-    auto real_hash = sm3.digest();
+    // sm2_gtable.h 与通用点运算重新算出的表一致
+    vector<sm2::apoint> table(sm2::G_WINDOWS * sm2::G_ENTRIES);
+    sm2::compute_g_table(table.data());
+    for (int i = 0; i < sm2::G_WINDOWS && ok; i++) {
+        for (int j = 0; j < sm2::G_ENTRIES; j++) {
+            const sm2::apoint& a = table[i * sm2::G_ENTRIES + j];
+            ok = ok && memcmp(a.x.v, SM2_G_TABLE[i][j], 32) == 0 && memcmp(a.y.v, SM2_G_TABLE[i][j] + 4, 32) == 0;
+        }
+    }
 
-    cout << "Length Extension Attack: "
-        << (forged_hash == real_hash ? "SUCCESS" : "FAILED")
-        << endl;
+    // 不在曲线上的公钥与越界私钥抛出异常
+    bool threw = false;
+    y[31] ^= 1;
+    try { Sm2PublicKey bad_pub(x.data(), y.data()); }
+    catch (const invalid_argument&) { threw = true; }
+    ok = ok && threw;
+    threw = false;
+    vector<uint8_t> zero_d(32, 0);
+    try { Sm2PrivateKey bad_key(zero_d.data()); }
+    catch (const invalid_argument&) { threw = true; }
+    ok = ok && threw;
+
+    cout << "SM2 sign/verify (GB/T 32918 example, 50 random keys): " << (ok ? "PASSED" : "FAILED") << endl;
 }
 
 void test_merkle_tree() {
-    // 10Ҷӽڵ
-    vector<vector<uint8_t>> leaves;
-    for (int i = 0; i < 100000; i++) {
-        leaves.push_back(str_to_vec("leaf" + to_string(i)));
-    }
+    // 生成10万叶子节点
+    vector<vector<uint8_t>> leaves = make_leaves(100000);
 
-    // Merkle
+    // 构建Merkle树
     MerkleTree tree(leaves);
     auto root = tree.root();
     cout << "Merkle Root: " << hex_str(root).substr(0, 16) << "..." << endl;
 
-    // ֤
+    // 存在性证明
     size_t index = 12345;
     auto proof = tree.proof(index);
     bool valid = MerkleTree::verify(
@@ -719,7 +5242,7 @@ void test_merkle_tree() {
     );
     cout << "Existence Proof: " << (valid ? "VALID" : "INVALID") << endl;
 
-    // ֤
+    // 不存在性证明
     try {
         size_t insert_pos;
         auto absence_proof = tree.absence_proof(str_to_vec("leaf12345"), insert_pos);
@@ -729,13 +5252,13 @@ void test_merkle_tree() {
         cout << "Absence Proof failed (as expected for existing node)" << endl;
     }
 
-    // ڵĽڵ
+    // 真正不存在的节点
     try {
         size_t insert_pos;
         auto absence_proof = tree.absence_proof(str_to_vec("non_existent_leaf"), insert_pos);
         cout << "Absence Proof generated at position: " << insert_pos << endl;
 
-        // ֤ǰ֤
+        // 验证前驱证明
         if (insert_pos > 0) {
             bool pred_valid = MerkleTree::verify(
                 leaves[insert_pos - 1],
@@ -747,7 +5270,7 @@ void test_merkle_tree() {
             cout << "Predecessor Proof: " << (pred_valid ? "VALID" : "INVALID") << endl;
         }
 
-        // ֤֤
+        // 验证后继证明
         if (insert_pos < leaves.size()) {
             bool succ_valid = MerkleTree::verify(
                 leaves[insert_pos],
@@ -764,19 +5287,1125 @@ void test_merkle_tree() {
     }
 }
 
-// ==============================  ==============================
-int main() {
+void test_merkle_parallel() {
+    vector<vector<uint8_t>> leaves = make_leaves(10007);
+    MerkleTree serial(leaves);
+    ThreadPool pool(4);
+    MerkleTree parallel(leaves, pool);
+    cout << "Parallel build (4 threads) root: "
+        << (serial.root() == parallel.root() ? "PASSED" : "FAILED") << endl;
+}
+
+// 按 RFC 6962 定义递归计算 MTH，作为对照
+static Hash256 rfc6962_mth(const vector<vector<uint8_t>>& d, size_t lo, size_t hi) {
+    Hash256 out;
+    if (hi - lo == 1) {
+        rfc6962_hash_leaf(d[lo].data(), d[lo].size(), out.data());
+        return out;
+    }
+    size_t k = 1;
+    while (k * 2 < hi - lo) k *= 2;
+    Hash256 l = rfc6962_mth(d, lo, lo + k), r = rfc6962_mth(d, lo + k, hi);
+    rfc6962_hash_children(l.data(), r.data(), out.data());
+    return out;
+}
+
+void test_rfc6962_tree() {
+    bool ok = true;
+    vector<vector<uint8_t>> leaves;
+    for (size_t n = 1; n <= 40 && ok; n++) {
+        leaves.push_back(str_to_vec("leaf" + to_string(n - 1)));
+        RFC6962Tree tree(leaves);
+        ok = tree.root() == rfc6962_mth(leaves, 0, n);
+        for (size_t i = 0; i < n && ok; i++) {
+            ok = RFC6962Tree::verify(leaves[i], tree.root(), i, n, tree.proof(i));
+            // 错误的下标必须验证失败
+            if (ok && n > 1) {
+                ok = !RFC6962Tree::verify(leaves[i], tree.root(), (i + 1) % n, n, tree.proof(i));
+            }
+        }
+    }
+    cout << "RFC 6962 root/proofs (1..40 leaves): " << (ok ? "PASSED" : "FAILED") << endl;
+
+    leaves = make_leaves(100000);
+    RFC6962Tree tree(leaves);
+    MerkleTree padded(leaves);
+    size_t index = 12345;
+    bool valid = RFC6962Tree::verify(leaves[index], tree.root(), index, leaves.size(), tree.proof(index));
+    cout << "RFC 6962 tree (100k leaves): " << tree.memory_bytes() << " bytes vs padded "
+        << padded.memory_bytes() << " bytes, proof " << (valid ? "VALID" : "INVALID") << endl;
+}
+
+void test_incremental_tree() {
+    bool ok = true;
+    IncrementalMerkleTree inc(true);
+    vector<vector<uint8_t>> leaves;
+    for (size_t n = 1; n <= 70 && ok; n++) {
+        leaves.push_back(str_to_vec("leaf" + to_string(n - 1)));
+        inc.append(leaves.back());
+        RFC6962Tree tree(leaves);
+        ok = inc.root() == tree.root();
+        for (size_t i = 0; i < n && ok; i++) {
+            ok = RFC6962Tree::verify(leaves[i], inc.root(), i, n, inc.proof(i));
+        }
+    }
+    cout << "Incremental tree vs RFC 6962 (1..70 leaves): " << (ok ? "PASSED" : "FAILED") << endl;
+
+    // 不保留节点的流式求根，内存只有 O(log n)
+    IncrementalMerkleTree stream;
+    vector<vector<uint8_t>> batch;
+    for (int i = 0; i < 100000; i++) {
+        string leaf = "leaf" + to_string(i);
+        stream.append((const uint8_t*)leaf.data(), leaf.size());
+        batch.push_back(str_to_vec(leaf));
+    }
+    cout << "Streaming root (100k leaves, " << stream.memory_bytes() << " bytes): "
+        << (stream.root() == RFC6962Tree(batch).root() ? "PASSED" : "FAILED") << endl;
+}
+
+void test_consistency_proof() {
+    bool ok = true;
+    vector<vector<uint8_t>> leaves;
+    vector<Hash256> roots;
+    for (size_t n = 1; n <= 40; n++) {
+        leaves.push_back(str_to_vec("leaf" + to_string(n - 1)));
+        roots.push_back(RFC6962Tree(leaves).root());
+    }
+    IncrementalMerkleTree inc(true);
+    for (size_t n = 1; n <= 40 && ok; n++) {
+        inc.append(leaves[n - 1]);
+        RFC6962Tree tree(vector<vector<uint8_t>>(leaves.begin(), leaves.begin() + n));
+        for (size_t m = 1; m <= n && ok; m++) {
+            auto proof = rfc6962_consistency_proof(tree, m);
+            ok = proof == rfc6962_consistency_proof(inc, m)
+                && rfc6962_verify_consistency(m, n, roots[m - 1], roots[n - 1], proof);
+            // 用错误的旧根必须验证失败
+            if (ok && m < n) {
+                ok = !rfc6962_verify_consistency(m, n, roots[n - 1], roots[n - 1], proof);
+            }
+        }
+    }
+    cout << "Consistency proofs (1..40 leaves): " << (ok ? "PASSED" : "FAILED") << endl;
+}
+
+void test_multiproof() {
+    vector<vector<uint8_t>> leaves = make_leaves(100000);
+    MerkleTree tree(leaves);
+
+    // 1000 个伪随机下标（含重复）
+    vector<size_t> indices;
+    uint64_t x = 88172645463325252ull;
+    for (int i = 0; i < 1000; i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        indices.push_back((size_t)(x % leaves.size()));
+    }
+    MultiProof mp = tree.multiproof(indices);
+    vector<vector<uint8_t>> proven;
+    size_t single_total = 0;
+    for (size_t i : mp.indices) {
+        proven.push_back(leaves[i]);
+        single_total += tree.proof(i).size();
+    }
+
+    bool ok = MerkleTree::verify_multi(mp.indices, proven, tree.root(), leaves.size(), mp.siblings);
+    // 篡改任一叶子必须验证失败
+    proven[mp.indices.size() / 2].push_back('x');
+    ok = ok && !MerkleTree::verify_multi(mp.indices, proven, tree.root(), leaves.size(), mp.siblings);
+
+    cout << "Multiproof (" << mp.indices.size() << " leaves): " << mp.siblings.size()
+        << " siblings vs " << single_total << " in single proofs, " << (ok ? "PASSED" : "FAILED") << endl;
+}
+
+void test_batch_verify() {
+    vector<vector<uint8_t>> leaves = make_leaves(10000);
+    MerkleTree tree(leaves);
+
+    vector<ProofView> proofs;
+    vector<vector<uint8_t>> bad_leaf(1, str_to_vec("bad"));
+    for (size_t i = 0; i < 3000; i++) proofs.push_back(tree.proof((i * 7) % leaves.size()));
+
+    vector<BatchItem> items;
+    for (size_t i = 0; i < proofs.size(); i++) {
+        // 每 10 个中放一个错误叶子或错误下标
+        const vector<uint8_t>* leaf = i % 10 == 3 ? &bad_leaf[0] : &leaves[(i * 7) % leaves.size()];
+        size_t index = i % 10 == 7 ? (i * 7 + 1) % leaves.size() : (i * 7) % leaves.size();
+        items.push_back({ leaf, index, &proofs[i] });
+    }
+
+    MerkleBatchVerifier verifier(tree.root(), leaves.size());
+    bool ok = true;
+    for (int pass = 0; pass < 2 && ok; pass++) {
+        auto result = verifier.verify(items);
+        for (size_t i = 0; i < items.size() && ok; i++) {
+            bool expect = MerkleTree::verify(*items[i].leaf, tree.root(), items[i].index,
+                                             leaves.size(), *items[i].proof);
+            ok = (result[i] == 1) == expect;
+        }
+    }
+    // 单批算出的节点远多于容量时缓存仍不超过 max_cached
+    MerkleBatchVerifier small(tree.root(), leaves.size(), 100);
+    for (int pass = 0; pass < 2 && ok; pass++) {
+        auto result = small.verify(items);
+        for (size_t i = 0; i < items.size() && ok; i++) {
+            bool expect = MerkleTree::verify(*items[i].leaf, tree.root(), items[i].index,
+                                             leaves.size(), *items[i].proof);
+            ok = (result[i] == 1) == expect;
+        }
+        ok = ok && small.cached_nodes() <= 100;
+    }
+    cout << "Batch verify (3000 proofs, cold + cached): " << (ok ? "PASSED" : "FAILED") << endl;
+}
+
+void test_mapped_tree() {
+    vector<vector<uint8_t>> leaves = make_leaves(10007);
+    MerkleTree tree(leaves);
+    const string path = "merkle_test.bin";
+    tree.save(path);
+
+    bool ok = true;
+    {
+        MappedMerkleTree mapped(path);
+        ok = mapped.size() == leaves.size() && mapped.root() == tree.root() && mapped.check();
+        for (size_t i = 0; i < leaves.size() && ok; i += 97) {
+            ok = MerkleTree::verify(leaves[i], mapped.root(), i, mapped.size(), mapped.proof(i));
+        }
+    }
+
+    // 损坏文件头后必须拒绝打开
+    FILE* fp = fopen(path.c_str(), "r+b");
+    if (fp) {
+        fseek(fp, 16, SEEK_SET);
+        fputc(0xFF, fp);
+        fclose(fp);
+    }
+    try {
+        MappedMerkleTree broken(path);
+        ok = false;
+    }
+    catch (const runtime_error&) {
+    }
+    remove(path.c_str());
+
+    cout << "Mapped Merkle file (10007 leaves): " << (ok ? "PASSED" : "FAILED") << endl;
+}
+
+void test_merkle_file_build() {
+    vector<vector<uint8_t>> leaves = make_leaves(10007);
+    MerkleTree tree(leaves);
+
+    FILE* lines = fopen("leaves_test.txt", "wb");
+    FILE* lp = fopen("leaves_test.lp", "wb");
+    if (!lines || !lp) {
+        cout << "Out-of-core build: FAILED (cannot create leaf files)" << endl;
+        return;
+    }
+    for (const auto& leaf : leaves) {
+        fwrite(leaf.data(), 1, leaf.size(), lines);
+        fputc('\n', lines);
+        uint8_t len[4] = { (uint8_t)leaf.size(), 0, 0, 0 };
+        fwrite(len, 1, 4, lp);
+        fwrite(leaf.data(), 1, leaf.size(), lp);
+    }
+    fclose(lines);
+    fclose(lp);
+
+    // 块很小，覆盖跨块的记录与层
+    ThreadPool pool(2);
+    Hash256 r1 = build_merkle_file("leaves_test.txt", LeafFormat::Lines, "merkle_ooc.bin", 1000, &pool);
+    bool ok = r1 == tree.root();
+    {
+        MappedMerkleTree mapped("merkle_ooc.bin");
+        ok = ok && mapped.root() == tree.root() && mapped.size() == leaves.size() && mapped.check();
+        ok = ok && MerkleTree::verify(leaves[4321], mapped.root(), 4321, mapped.size(), mapped.proof(4321));
+    }
+    Hash256 r2 = build_merkle_file("leaves_test.lp", LeafFormat::LengthPrefixed, "merkle_ooc.bin", 1 << 12);
+    ok = ok && r2 == tree.root();
+
+    remove("leaves_test.txt");
+    remove("leaves_test.lp");
+    remove("merkle_ooc.bin");
+    cout << "Out-of-core build (lines / length-prefixed): " << (ok ? "PASSED" : "FAILED") << endl;
+}
+
+void test_merkle_update() {
+    vector<vector<uint8_t>> leaves = make_leaves(10007);
+    MerkleTree tree(leaves);
+
+    tree.update(17, str_to_vec("changed17"));
+    leaves[17] = str_to_vec("changed17");
+    bool ok = tree.root() == MerkleTree(leaves).root();
+
+    vector<pair<size_t, vector<uint8_t>>> updates;
+    for (size_t i = 0; i < 300; i++) {
+        size_t index = (i * 7919) % leaves.size();
+        updates.push_back({ index, str_to_vec("upd" + to_string(i)) });
+        leaves[index] = updates.back().second;
+    }
+    ThreadPool pool(2);
+    tree.update_batch(updates, &pool);
+    ok = ok && tree.root() == MerkleTree(leaves).root();
+    ok = ok && MerkleTree::verify(leaves[17], tree.root(), 17, leaves.size(), tree.proof(17));
+
+    cout << "Leaf update / batch update: " << (ok ? "PASSED" : "FAILED") << endl;
+}
+
+void test_sparse_merkle() {
+    SparseMerkleTree tree;
+    Hash256 empty_root = tree.root();
+    vector<vector<uint8_t>> keys, values;
+    for (int i = 0; i < 1000; i++) {
+        keys.push_back(str_to_vec("key" + to_string(i)));
+        values.push_back(str_to_vec("value" + to_string(i)));
+        tree.update(keys.back(), values.back());
+    }
+    Hash256 root = tree.root();
+
+    bool inclusion = tree.size() == keys.size();
+    for (size_t i = 0; i < keys.size(); i++) {
+        inclusion = inclusion && SparseMerkleTree::verify(root, keys[i], &values[i], tree.prove(keys[i]));
+    }
+
+    bool exclusion = true;
+    for (int i = 0; i < 200; i++) {
+        auto key = str_to_vec("absent" + to_string(i));
+        exclusion = exclusion && SparseMerkleTree::verify(root, key, nullptr, tree.prove(key));
+    }
+
+    // 篡改值、对存在的键声称缺失、对不存在的键声称存在都必须失败
+    auto wrong = str_to_vec("wrong");
+    auto absent = str_to_vec("absent0");
+    bool forged = SparseMerkleTree::verify(root, keys[5], &wrong, tree.prove(keys[5])) ||
+                  SparseMerkleTree::verify(root, keys[5], nullptr, tree.prove(keys[5])) ||
+                  SparseMerkleTree::verify(root, absent, &wrong, tree.prove(absent));
+    SparseProof bad = tree.prove(keys[7]);
+    bad.leaf_value[0] ^= 1;
+    forged = forged || SparseMerkleTree::verify(root, keys[7], &values[7], bad);
+
+    // 根与插入顺序无关，删除后与从未插入一致
+    SparseMerkleTree reversed;
+    for (size_t i = keys.size(); i-- > 0;) reversed.update(keys[i], values[i]);
+    bool order = reversed.root() == root;
+
+    SparseMerkleTree partial;
+    for (size_t i = 0; i < keys.size(); i += 2) partial.update(keys[i], values[i]);
+    for (size_t i = 1; i < keys.size(); i += 2) reversed.erase(keys[i]);
+    bool erased = reversed.root() == partial.root() && reversed.size() == partial.size() &&
+                  !reversed.erase(keys[1]);
+    erased = erased && SparseMerkleTree::verify(reversed.root(), keys[1], nullptr, reversed.prove(keys[1]));
+    for (size_t i = 0; i < keys.size(); i += 2) reversed.erase(keys[i]);
+    erased = erased && reversed.root() == empty_root && reversed.size() == 0;
+
+    cout << "Sparse Merkle inclusion: " << (inclusion ? "PASSED" : "FAILED") << endl;
+    cout << "Sparse Merkle exclusion: " << (exclusion ? "PASSED" : "FAILED") << endl;
+    cout << "Sparse Merkle forged proofs rejected: " << (!forged ? "PASSED" : "FAILED") << endl;
+    cout << "Sparse Merkle order independence / erase: " << (order && erased ? "PASSED" : "FAILED") << endl;
+}
+
+// 不同哈希策略实例化的树应得到相同的根与证明
+void test_merkle_policies() {
+    vector<vector<uint8_t>> leaves = make_leaves(1000);
+    BasicMerkleTree<Sm3ScalarPolicy> scalar(leaves);
+    BasicMerkleTree<Sm3Fixed64Policy> fixed64(leaves);
+    MerkleTree multi(leaves);
+
+    bool ok = scalar.root() == multi.root() && fixed64.root() == multi.root();
+    ok = ok && BasicMerkleTree<Sm3ScalarPolicy>::verify(leaves[321], scalar.root(), 321, leaves.size(),
+                                                          scalar.proof(321));
+    ok = ok && BasicMerkleTree<Sm3Fixed64Policy>::verify(leaves[999], fixed64.root(), 999, leaves.size(),
+                                                           fixed64.proof(999));
+
+    vector<size_t> indices = { 3, 4, 5, 500, 998 };
+    auto mp = fixed64.multiproof(indices);
+    vector<vector<uint8_t>> proven;
+    for (size_t i : mp.indices) proven.push_back(leaves[i]);
+    ok = ok && BasicMerkleTree<Sm3Fixed64Policy>::verify_multi(mp.indices, proven, fixed64.root(),
+                                                                 leaves.size(), mp.siblings);
+
+    vector<pair<size_t, vector<uint8_t>>> updates = { { 7, str_to_vec("x") }, { 640, str_to_vec("y") } };
+    scalar.update_batch(updates);
+    multi.update_batch(updates);
+    ok = ok && scalar.root() == multi.root();
+
+    cout << "Merkle hash policies (scalar / fixed-64 / multi-buffer): " << (ok ? "PASSED" : "FAILED") << endl;
+}
+
+void test_file_hash() {
+    const string path = "sm3_file_test.dat";
+    const size_t chunk = 4096;
+    vector<uint8_t> data(40 * chunk + 1234);
+    for (size_t i = 0; i < data.size(); i++) data[i] = (uint8_t)(i * 2654435761u >> 13);
+
+    bool ok = true;
+    // 第二轮写空文件
+    for (int round = 0; round < 2; round++) {
+        if (round == 1) data.clear();
+        FILE* fp = fopen(path.c_str(), "wb");
+        if (!fp) {
+            ok = false;
+            break;
+        }
+        if (!data.empty()) fwrite(data.data(), 1, data.size(), fp);
+        fclose(fp);
+
+        OptimizedSM3 sm3;
+        sm3.update(data.data(), data.size());
+        auto ref = sm3.digest();
+        ok = ok && equal(ref.begin(), ref.end(), sm3_file(path, FileHashIO::Mapped).begin());
+        ok = ok && equal(ref.begin(), ref.end(), sm3_file(path, FileHashIO::Streamed).begin());
+
+        IncrementalMerkleTree tree;
+        for (size_t off = 0; off < data.size(); off += chunk) {
+            tree.append(data.data() + off, min(chunk, data.size() - off));
+        }
+        ThreadPool pool(2);
+        ok = ok && sm3_file_tree(path, nullptr, chunk) == tree.root();
+        ok = ok && sm3_file_tree(path, &pool, chunk) == tree.root();
+    }
+    remove(path.c_str());
+    cout << "Large-file SM3 (mapped / streamed / chunked tree): " << (ok ? "PASSED" : "FAILED") << endl;
+}
+
+#if defined(__linux__)
+void test_proof_server() {
+    vector<vector<uint8_t>> leaves = make_leaves(5000);
+    MerkleTree tree(leaves);
+    ThreadPool pool(2);
+    const string path = "merkle_proofs.sock";
+    MerkleProofServer server(tree, path, &pool);
+    thread loop([&] { server.run(); });
+
+    ProofLoadResult res = proof_load(path, 4, 500, 16, &leaves);
+    bool ok = res.proofs == 2000 && res.failures == 0;
+
+    // 越界下标返回错误状态且不带哈希
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr = proof_wire::address(path);
+    if (fd >= 0 && connect(fd, (sockaddr*)&addr, sizeof(addr)) == 0) {
+        proof_wire::Request req = { 7, leaves.size() };
+        proof_wire::ResponseHeader h;
+        ok = ok && write(fd, &req, sizeof(req)) == (ssize_t)sizeof(req) &&
+             recv(fd, &h, sizeof(h), MSG_WAITALL) == (ssize_t)sizeof(h) &&
+             h.id == 7 && h.status == proof_wire::OUT_OF_RANGE && h.count == 0;
+    }
+    else {
+        ok = false;
+    }
+    if (fd >= 0) close(fd);
+
+    server.stop();
+    loop.join();
+    cout << "Proof server (4 clients x 500 proofs over Unix socket): " << (ok ? "PASSED" : "FAILED") << endl;
+}
+#endif
+
+// ============================== 性能测试 ==============================
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#include <chrono>
+#include "../bench/bench_harness.h"
+
+static inline uint64_t cycles_now() {
+    return __rdtsc();
+}
+
+// 对 fn 重复 rounds 次，返回最好一次的 cycles/byte 与 GB/s
+template <typename Fn>
+static void bench_run(const char* name, size_t bytes, int rounds, Fn fn) {
+    double best_cpb = 1e30, best_gbps = 0.0;
+    for (int r = 0; r < rounds; r++) {
+        auto t0 = chrono::steady_clock::now();
+        uint64_t c0 = cycles_now();
+        fn();
+        uint64_t c1 = cycles_now();
+        auto t1 = chrono::steady_clock::now();
+        double secs = chrono::duration<double>(t1 - t0).count();
+        best_cpb = min(best_cpb, (double)(c1 - c0) / bytes);
+        best_gbps = max(best_gbps, bytes / secs / 1e9);
+    }
+    printf("%-28s %8.2f cycles/byte  %6.3f GB/s\n", name, best_cpb, best_gbps);
+}
+
+void bench_sm3(size_t bytes) {
+    vector<uint8_t> msg(bytes);
+    for (size_t i = 0; i < bytes; i++) msg[i] = (uint8_t)i;
+    const int rounds = 5;
+    volatile uint8_t sink = 0;
+
+    bench_run("SM3 (reference)", bytes, rounds, [&] {
+        SM3 sm3;
+        sm3.update(msg.data(), msg.size());
+        sink ^= sm3.digest()[0];
+    });
+    bench_run("OptimizedSM3", bytes, rounds, [&] {
+        OptimizedSM3 sm3;
+        sm3.update(msg.data(), msg.size());
+        sink ^= sm3.digest()[0];
+    });
+    bench_run("core: 16-word window", bytes, rounds, [&] {
+        uint32_t v[8];
+        memcpy(v, sm3_core::IV, sizeof(v));
+        sm3_core::compress_blocks_scalar(v, msg.data(), bytes / 64);
+        sink ^= (uint8_t)v[0];
+    });
+#ifdef SM3_SIMD_EXPAND
+    bench_run("core: SSE 3-word expand", bytes, rounds, [&] {
+        uint32_t v[8];
+        memcpy(v, sm3_core::IV, sizeof(v));
+        sm3_core::compress_blocks_simd(v, msg.data(), bytes / 64);
+        sink ^= (uint8_t)v[0];
+    });
+#endif
+    (void)sink;
+}
+
+void bench_sm3_64(size_t n) {
+    vector<uint8_t> children(n * 64), parents(n * 32);
+    for (size_t i = 0; i < children.size(); i++) children[i] = (uint8_t)i;
+    const int rounds = 5;
+
+    bench_run("OptimizedSM3 (64B)", n * 64, rounds, [&] {
+        for (size_t i = 0; i < n; i++) {
+            OptimizedSM3 sm3;
+            sm3.update(&children[i * 64], 64);
+            auto d = sm3.digest();
+            memcpy(&parents[i * 32], d.data(), 32);
+        }
+    });
+    bench_run("sm3_64", n * 64, rounds, [&] {
+        for (size_t i = 0; i < n; i++) {
+            sm3_64(&children[i * 64], &children[i * 64 + 32], &parents[i * 32]);
+        }
+    });
+    bench_run("sm3_64_level", n * 64, rounds, [&] {
+        sm3_64_level(children.data(), parents.data(), n);
+    });
+}
+
+// 共享 1 KiB 前缀、64 字节后缀：每次重算前缀与从缓存的中间状态继续
+void bench_sm3_prefix(size_t n) {
+    vector<uint8_t> prefix(1024), suffix(64);
+    for (size_t i = 0; i < prefix.size(); i++) prefix[i] = (uint8_t)i;
+    SM3PrefixCache cache;
+    cache.add(1, prefix);
+    uint8_t out[32];
+    volatile uint8_t sink = 0;
+    const int rounds = 5;
+
+    bench_run("prefix re-hashed", n * 64, rounds, [&] {
+        for (size_t i = 0; i < n; i++) {
+            suffix[0] = (uint8_t)i;
+            OptimizedSM3 sm3;
+            sm3.update(prefix.data(), prefix.size());
+            sm3.update(suffix.data(), suffix.size());
+            sink ^= sm3.digest()[0];
+        }
+    });
+    bench_run("prefix from cache", n * 64, rounds, [&] {
+        for (size_t i = 0; i < n; i++) {
+            suffix[0] = (uint8_t)i;
+            cache.hash(1, suffix.data(), suffix.size(), out);
+            sink ^= out[0];
+        }
+    });
+}
+
+void bench_hmac(size_t n, size_t msg_len) {
+    vector<uint8_t> key(32, 0x0b), msgs(n * msg_len);
+    for (size_t i = 0; i < msgs.size(); i++) msgs[i] = (uint8_t)i;
+    HmacSM3 hmac(key);
+    vector<uint8_t> macs(n * 32);
+    vector<const uint8_t*> dp(n);
+    vector<size_t> lens(n, msg_len);
+    vector<uint8_t*> op(n);
+    for (size_t i = 0; i < n; i++) {
+        dp[i] = &msgs[i * msg_len];
+        op[i] = &macs[i * 32];
+    }
+    const int rounds = 5;
+    char name[64];
+
+    snprintf(name, sizeof(name), "HMAC naive (%zuB)", msg_len);
+    bench_run(name, n * msg_len, rounds, [&] {
+        uint8_t ipad[64], opad[64];
+        for (size_t i = 0; i < n; i++) {
+            for (int j = 0; j < 64; j++) {
+                ipad[j] = (j < 32 ? key[j] : 0) ^ 0x36;
+                opad[j] = (j < 32 ? key[j] : 0) ^ 0x5c;
+            }
+            OptimizedSM3 inner;
+            inner.update(ipad, 64);
+            inner.update(dp[i], msg_len);
+            auto ih = inner.digest();
+            OptimizedSM3 outer;
+            outer.update(opad, 64);
+            outer.update(ih.data(), 32);
+            memcpy(op[i], outer.digest().data(), 32);
+        }
+    });
+    snprintf(name, sizeof(name), "HmacSM3::mac (%zuB)", msg_len);
+    bench_run(name, n * msg_len, rounds, [&] {
+        for (size_t i = 0; i < n; i++) hmac.mac(dp[i], msg_len, op[i]);
+    });
+    snprintf(name, sizeof(name), "HmacSM3::mac_batch (%zuB)", msg_len);
+    bench_run(name, n * msg_len, rounds, [&] {
+        hmac.mac_batch(dp.data(), lens.data(), op.data(), n);
+    });
+}
+
+// producers 个线程各哈希 per 条 msg_len 字节的消息：各线程同步计算，与逐条提交到异步队列
+// （每个线程保持至多 window 条未完成）对比
+void bench_job_queue(size_t producers, size_t per, size_t msg_len, size_t window) {
+    vector<uint8_t> msgs(per * msg_len);
+    for (size_t i = 0; i < msgs.size(); i++) msgs[i] = (uint8_t)i;
+    auto run = [&](const char* name, function<void(size_t)> body) {
+        auto t0 = chrono::steady_clock::now();
+        vector<thread> threads;
+        for (size_t p = 0; p < producers; p++) threads.emplace_back(body, p);
+        for (auto& t : threads) t.join();
+        double secs = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+        printf("%-28s %10.0f jobs/s  %6.3f GB/s\n", name, producers * per / secs,
+               producers * per * msg_len / secs / 1e9);
+    };
+    printf("%zu producers x %zu jobs of %zu bytes\n", producers, per, msg_len);
+
+    run("synchronous SM3", [&](size_t) {
+        uint8_t out[32];
+        for (size_t i = 0; i < per; i++) {
+            SM3Midstate m;
+            m.update(&msgs[i * msg_len], msg_len);
+            m.digest(out);
+        }
+    });
+
+    Sm3JobQueue queue;
+    char name[64];
+    snprintf(name, sizeof(name), "Sm3JobQueue (%zu workers)", queue.size());
+    run(name, [&](size_t) {
+        vector<Sm3Job> jobs(window);
+        for (size_t i = 0; i < per; i += window) {
+            size_t m = min(window, per - i);
+            for (size_t k = 0; k < m; k++) {
+                jobs[k].data = &msgs[(i + k) * msg_len];
+                jobs[k].len = msg_len;
+                queue.submit(&jobs[k]);
+            }
+            for (size_t k = 0; k < m; k++) queue.wait(&jobs[k]);
+        }
+    });
+}
+
+// 单线程签名 / 验签吞吐（消息 32 字节，含 e = SM3(Z_A || M)）
+void bench_sm2(double seconds) {
+    Sm2PrivateKey key = Sm2PrivateKey::generate();
+    const Sm2PublicKey& pub = key.public_key();
+    uint8_t msg[32];
+    for (int i = 0; i < 32; i++) msg[i] = (uint8_t)i;
+    vector<Sm2Signature> sigs;
+    auto run = [&](const char* name, function<void()> body) {
+        size_t ops = 0;
+        auto t0 = chrono::steady_clock::now();
+        double secs = 0;
+        do {
+            for (int i = 0; i < 16; i++) body();
+            ops += 16;
+            secs = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+        } while (secs < seconds);
+        printf("%-28s %10.0f ops/s  %8.1f us/op\n", name, ops / secs, secs * 1e6 / ops);
+    };
+    // k·G 单独计时：通用定长窗口（4 位一窗，倍点 + 加法）与固定基查表（只有混合加法）
+    sm2::u256 k;
+    sm2::random_scalar(k);
+    sm2::jpoint kg;
+    run("SM2 k*G generic window", [&] {
+        sm2::scalar_mult_ct(kg, k, sm2::g_odd_multiples());
+        k.v[0] ^= kg.X.v[0] & 2;
+    });
+    run("SM2 k*G fixed-base table", [&] {
+        sm2::scalar_mult_base(kg, k);
+        k.v[0] ^= kg.X.v[0] & 2;
+    });
+    run("SM2 sign", [&] { sigs.push_back(key.sign(msg, sizeof(msg))); });
+    size_t i = 0, bad = 0;
+    run("SM2 verify", [&] { bad += !pub.verify(msg, sizeof(msg), sigs[i++ % sigs.size()]); });
+    if (bad) printf("  %zu verification failures!\n", bad);
+    run("SM2 key generation", [&] {
+        Sm2PrivateKey k = Sm2PrivateKey::generate();
+        msg[1] ^= k.public_key().za()[0];
+    });
+}
+
+// Z 取 64 字节（如 SM2 加密中的 x2 || y2）
+void bench_sm3_kdf(size_t total) {
+    vector<uint8_t> z(64, 0x42);
+    const size_t klens[] = { 32, 1024, 64 * 1024, 1024 * 1024 };
+    const int rounds = 5;
+    volatile uint8_t sink = 0;
+    for (size_t kl : klens) {
+        size_t reps = max<size_t>(1, total / kl);
+        vector<uint8_t> out(kl);
+        char name[64];
+        snprintf(name, sizeof(name), "KDF naive (%zu B)", kl);
+        bench_run(name, reps * kl, rounds, [&] {
+            for (size_t r = 0; r < reps; r++) {
+                for (uint32_t ct = 1; (size_t)(ct - 1) * 32 < kl; ct++) {
+                    uint8_t c[4] = { (uint8_t)(ct >> 24), (uint8_t)(ct >> 16), (uint8_t)(ct >> 8), (uint8_t)ct };
+                    OptimizedSM3 sm3;
+                    sm3.update(z.data(), z.size());
+                    sm3.update(c, 4);
+                    auto h = sm3.digest();
+                    memcpy(out.data() + (ct - 1) * 32, h.data(), min<size_t>(32, kl - (ct - 1) * 32));
+                }
+                sink ^= out[0];
+            }
+        });
+        snprintf(name, sizeof(name), "sm3_kdf (%zu B)", kl);
+        bench_run(name, reps * kl, rounds, [&] {
+            for (size_t r = 0; r < reps; r++) {
+                sm3_kdf(z.data(), z.size(), out.data(), kl);
+                sink ^= out[0];
+            }
+        });
+    }
+}
+
+// 文件已在页缓存中，反映的是压缩而不是磁盘吞吐
+void bench_file_hash(size_t bytes) {
+    const string path = "sm3_bench.dat";
+    {
+        vector<uint8_t> buf(1 << 20);
+        for (size_t i = 0; i < buf.size(); i++) buf[i] = (uint8_t)(i * 31);
+        FILE* fp = fopen(path.c_str(), "wb");
+        if (!fp) return;
+        for (size_t done = 0; done < bytes; done += buf.size()) {
+            fwrite(buf.data(), 1, min(buf.size(), bytes - done), fp);
+        }
+        fclose(fp);
+    }
+    ThreadPool pool;
+    const int rounds = 3;
+    bench_run("sm3_file (mmap)", bytes, rounds, [&] { sm3_file(path, FileHashIO::Mapped); });
+    bench_run("sm3_file (read-ahead)", bytes, rounds, [&] { sm3_file(path, FileHashIO::Streamed); });
+    bench_run("sm3_file_tree (1 thread)", bytes, rounds, [&] { sm3_file_tree(path); });
+    char name[64];
+    snprintf(name, sizeof(name), "sm3_file_tree (%zu threads)", pool.size());
+    bench_run(name, bytes, rounds, [&] { sm3_file_tree(path, &pool); });
+    remove(path.c_str());
+}
+
+// 逐个调用 length_extension_attack 与一次扫描全部候选长度
+void bench_length_extension_sweep(size_t candidates) {
+    vector<uint8_t> mac(32, 0x5a), ext = str_to_vec("&role=admin&expires=never");
+    const size_t msg_len = 100;
+    volatile uint8_t sink = 0;
+
+    auto t0 = chrono::steady_clock::now();
+    for (size_t s = 1; s <= candidates; s++) {
+        sink ^= length_extension_attack(mac, s + msg_len, ext)[0];
+    }
+    auto t1 = chrono::steady_clock::now();
+    length_extension_sweep(mac, msg_len, 1, candidates, ext,
+        [&](size_t, const uint8_t*, size_t, const uint8_t* digest) { sink ^= digest[0]; });
+    auto t2 = chrono::steady_clock::now();
+
+    double loop = chrono::duration<double>(t1 - t0).count(), sweep = chrono::duration<double>(t2 - t1).count();
+    printf("%-28s %10.0f candidates/s\n", "length_extension_attack", candidates / loop);
+    printf("%-28s %10.0f candidates/s\n", "length_extension_sweep", candidates / sweep);
+}
+
+// 1e5 起每次 ×10 直到 max_leaves，线程数 1, 2, 4, ... max_threads
+void bench_merkle_build(size_t max_leaves, size_t max_threads) {
+    for (size_t n = 100000; n <= max_leaves; n *= 10) {
+        vector<vector<uint8_t>> leaves = make_leaves(n);
+
+        double base = 0.0;
+        for (size_t t = 1; ; t = min(t * 2, max_threads)) {
+            ThreadPool pool(t);
+            auto t0 = chrono::steady_clock::now();
+            MerkleTree tree(leaves, pool);
+            auto t1 = chrono::steady_clock::now();
+            double secs = chrono::duration<double>(t1 - t0).count();
+            if (t == 1) base = secs;
+            printf("leaves=%-10zu threads=%-3zu %8.3f s  speedup %.2fx\n", n, t, secs, base / secs);
+            if (t == max_threads) break;
+        }
+    }
+}
+
+void bench_batch_verify(size_t n_leaves, size_t n_proofs) {
+    vector<vector<uint8_t>> leaves = make_leaves(n_leaves);
+    MerkleTree tree(leaves);
+
+    vector<ProofView> proofs(n_proofs);
+    vector<BatchItem> items(n_proofs);
+    uint64_t x = 88172645463325252ull;
+    for (size_t i = 0; i < n_proofs; i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        size_t index = (size_t)(x % n_leaves);
+        proofs[i] = tree.proof(index);
+        items[i] = { &leaves[index], index, &proofs[i] };
+    }
+
+    auto report = [&](const char* name, double secs) {
+        printf("%-28s %10.0f proofs/s\n", name, n_proofs / secs);
+    };
+    auto t0 = chrono::steady_clock::now();
+    size_t valid = 0;
+    for (const auto& it : items) {
+        valid += MerkleTree::verify(*it.leaf, tree.root(), it.index, n_leaves, *it.proof);
+    }
+    auto t1 = chrono::steady_clock::now();
+    report("MerkleTree::verify", chrono::duration<double>(t1 - t0).count());
+
+    MerkleBatchVerifier verifier(tree.root(), n_leaves);
+    for (int pass = 0; pass < 2; pass++) {
+        t0 = chrono::steady_clock::now();
+        auto result = verifier.verify(items);
+        t1 = chrono::steady_clock::now();
+        for (uint8_t r : result) valid += r;
+        report(pass == 0 ? "MerkleBatchVerifier (cold)" : "MerkleBatchVerifier (cached)",
+               chrono::duration<double>(t1 - t0).count());
+    }
+    if (valid != 3 * n_proofs) printf("verification mismatch!\n");
+}
+
+// 1% 叶子变化时批量更新与整树重建的对比
+void bench_merkle_update(size_t n) {
+    vector<vector<uint8_t>> leaves = make_leaves(n);
+
+    auto t0 = chrono::steady_clock::now();
+    MerkleTree tree(leaves);
+    auto t1 = chrono::steady_clock::now();
+    double rebuild = chrono::duration<double>(t1 - t0).count();
+
+    vector<pair<size_t, vector<uint8_t>>> updates;
+    uint64_t x = 88172645463325252ull;
+    for (size_t i = 0; i < n / 100; i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        updates.push_back({ (size_t)(x % n), str_to_vec("upd" + to_string(i)) });
+    }
+    t0 = chrono::steady_clock::now();
+    tree.update_batch(updates);
+    t1 = chrono::steady_clock::now();
+    double batch = chrono::duration<double>(t1 - t0).count();
+
+    printf("full rebuild %.3f s, 1%% update_batch %.3f s (%.1fx)\n", rebuild, batch, rebuild / batch);
+}
+
+template <typename Policy>
+static void bench_merkle_policy(const char* name, const vector<vector<uint8_t>>& leaves) {
+    double best = 1e30;
+    for (int r = 0; r < 3; r++) {
+        auto t0 = chrono::steady_clock::now();
+        BasicMerkleTree<Policy> tree(leaves);
+        auto t1 = chrono::steady_clock::now();
+        best = min(best, chrono::duration<double>(t1 - t0).count());
+    }
+    printf("%-28s %8.3f s  %8.2f M leaves/s\n", name, best, leaves.size() / best / 1e6);
+}
+
+void bench_merkle_policies(size_t n) {
+    vector<vector<uint8_t>> leaves = make_leaves(n);
+    bench_merkle_policy<Sm3ScalarPolicy>("Sm3ScalarPolicy", leaves);
+    bench_merkle_policy<Sm3Fixed64Policy>("Sm3Fixed64Policy", leaves);
+    bench_merkle_policy<Sm3MultiBufferPolicy>("Sm3MultiBufferPolicy", leaves);
+}
+
+#if defined(__linux__)
+void bench_proof_server(size_t n_leaves, size_t connections, size_t requests, size_t pipeline) {
+    vector<vector<uint8_t>> leaves = make_leaves(n_leaves);
+    MerkleTree tree(leaves);
+    ThreadPool pool;
+    const string path = "merkle_bench.sock";
+    MerkleProofServer server(tree, path, &pool);
+    thread loop([&] { server.run(); });
+
+    ProofLoadResult res = proof_load(path, connections, requests, pipeline);
+    server.stop();
+    loop.join();
+    printf("%zu clients, pipeline %zu: %10.0f proofs/s  p50 %.1f us  p99 %.1f us  (%zu failed)\n",
+           connections, pipeline, res.proofs / res.seconds, res.p50_us, res.p99_us, res.failures);
+}
+#endif
+
+// ============================== JSON 基准测试 ==============================
+// 由 bench/bench_harness.h 计时与统计，结果以 JSON 输出到 stdout，便于跟踪回归：
+// 单流 SM3 与多缓冲 SM3 的消息长度从 16 B 起每次乘 4 直到 max_bytes；
+// Merkle 构建 / 证明生成 / 证明验证的叶子数从 16 起每次乘 16，不超过 2^20 与 max_bytes / 32
+
+template <typename Fn>
+static void bench_json_case(bench_report* r, const char* op, const char* backend, size_t bytes, size_t items,
+                            Fn fn) {
+    bench_case(r, op, backend, bytes, items, [](void* c) { (*static_cast<Fn*>(c))(); }, &fn);
+}
+
+void bench_json(size_t max_bytes) {
+    static const size_t REFERENCE_MAX = 1 << 20;   // 基础实现逐字节处理，只测到 1 MiB
+    static const size_t PROOFS = 1024;
+    vector<uint8_t> msg(max_bytes);
+    for (size_t i = 0; i < msg.size(); i++) msg[i] = (uint8_t)i;
+    volatile uint8_t sink = 0;
+
+    bench_report r;
+#if SM3_MB_LANES == 16
+    bench_begin(&r, stdout, "sm3", "avx512");
+#elif SM3_MB_LANES == 8
+    bench_begin(&r, stdout, "sm3", "avx2");
+#else
+    bench_begin(&r, stdout, "sm3", "scalar");
+#endif
+
+    for (size_t len = 16; len <= min(max_bytes, REFERENCE_MAX); len = bench_next_size(len)) {
+        bench_json_case(&r, "sm3", "reference", len, 1, [&] {
+            SM3 h;
+            h.update(msg.data(), len);
+            sink ^= h.digest()[0];
+        });
+    }
+    for (size_t len = 16; len <= max_bytes; len = bench_next_size(len)) {
+        bench_json_case(&r, "sm3", "core", len, 1, [&] {
+            SM3Midstate m;
+            uint8_t out[32];
+            m.update(msg.data(), len);
+            m.digest(out);
+            sink ^= out[0];
+        });
+    }
+    // 每次 SM3_MB_LANES 条等长消息（共用同一缓冲区）
+    {
+        const size_t L = SM3_MB_LANES;
+        vector<const uint8_t*> data(L, msg.data());
+        vector<size_t> lens(L);
+        vector<array<uint8_t, 32>> out(L);
+        vector<uint8_t*> op(L);
+        for (size_t l = 0; l < L; l++) op[l] = out[l].data();
+        for (size_t len = 16; len <= max_bytes; len = bench_next_size(len)) {
+            fill(lens.begin(), lens.end(), len);
+            bench_json_case(&r, "sm3", "multi_buffer", len, L, [&] {
+                sm3_batch(data.data(), lens.data(), op.data(), L);
+                sink ^= out[0][0];
+            });
+        }
+    }
+    {
+        const size_t nodes = 4096;
+        vector<uint8_t> children(nodes * 64), parents(nodes * 32);
+        for (size_t i = 0; i < children.size(); i++) children[i] = (uint8_t)i;
+        bench_json_case(&r, "sm3_64", "sm3_64", 64, nodes, [&] {
+            for (size_t i = 0; i < nodes; i++) {
+                sm3_64(&children[i * 64], &children[i * 64 + 32], &parents[i * 32]);
+            }
+        });
+        bench_json_case(&r, "sm3_64", "sm3_64_level", 64, nodes, [&] {
+            sm3_64_level(children.data(), parents.data(), nodes);
+        });
+    }
+
+    for (size_t n = 16; n <= min<size_t>(max_bytes / 32, 1 << 20); n *= 16) {
+        vector<vector<uint8_t>> leaves(n, vector<uint8_t>(32));
+        for (size_t i = 0; i < n; i++) memcpy(leaves[i].data(), &msg[(i * 32) % (max_bytes - 31)], 32);
+        bench_json_case(&r, "merkle_build", "multi_buffer", 32, n, [&] {
+            MerkleTree t(leaves);
+            sink ^= t.root()[0];
+        });
+
+        MerkleTree tree(leaves);
+        vector<size_t> index(PROOFS);
+        uint64_t x = 88172645463325252ull;
+        for (size_t i = 0; i < PROOFS; i++) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            index[i] = (size_t)(x % n);
+        }
+        bench_json_case(&r, "merkle_proof", "multi_buffer", 0, PROOFS, [&] {
+            for (size_t i : index) sink ^= (uint8_t)tree.proof(i).size();
+        });
+        vector<decltype(tree.proof(0))> proofs;
+        for (size_t i : index) proofs.push_back(tree.proof(i));
+        bench_json_case(&r, "merkle_verify", "multi_buffer", 0, PROOFS, [&] {
+            for (size_t i = 0; i < PROOFS; i++) {
+                sink ^= (uint8_t)MerkleTree::verify(leaves[index[i]], tree.root(), index[i], n, proofs[i]);
+            }
+        });
+    }
+    bench_end(&r);
+    (void)sink;
+}
+
+// ============================== 主函数 ==============================
+int main(int argc, char** argv) {
+    if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+        size_t bytes = 64 * 1024 * 1024;
+        if (argc >= 3) bytes = (size_t)(atof(argv[2]) * 1024.0 * 1024.0);
+        bytes -= bytes % 64;
+        printf("Benchmarking SM3 on %zu bytes...\n", bytes);
+        bench_sm3(bytes);
+        printf("\nSM3 over 64-byte Merkle nodes (%zu nodes)...\n", bytes / 64);
+        bench_sm3_64(bytes / 64);
+        printf("\nShared 1 KiB prefix + 64-byte suffix (%zu messages, suffix bytes counted)...\n", bytes / 1024);
+        bench_sm3_prefix(bytes / 1024);
+        printf("\nHMAC-SM3...\n");
+        bench_hmac(bytes / 1024, 64);
+        bench_hmac(bytes / 4096, 1024);
+        printf("\nAsync job queue vs synchronous SM3 under many-thread load...\n");
+        bench_job_queue(16, 20000, 64, 64);
+        bench_job_queue(16, 10000, 256, 64);
+        printf("\nSM3 KDF (64-byte Z)...\n");
+        bench_sm3_kdf(bytes / 4);
+        printf("\nSM2 sign / verify (single thread)...\n");
+        bench_sm2(1.0);
+        printf("\nLarge-file SM3 (%zu bytes, page-cached)...\n", bytes);
+        bench_file_hash(bytes);
+        printf("\nLength extension sweep (1M candidate secret lengths)...\n");
+        bench_length_extension_sweep(1000000);
+        printf("\nBatch proof verification (1M leaves, 200k proofs)...\n");
+        bench_batch_verify(1000000, 200000);
+        printf("\nMerkle update, 1%% dirty leaves (1M leaves)...\n");
+        bench_merkle_update(1000000);
+        printf("\nMerkle build per hash policy (1M leaves)...\n");
+        bench_merkle_policies(1000000);
+#if defined(__linux__)
+        printf("\nProof server over Unix socket (1M leaves)...\n");
+        bench_proof_server(1000000, 4, 50000, 1);
+        bench_proof_server(1000000, 4, 50000, 32);
+#endif
+#if defined(CRYPTO_INSTRUMENT)
+        printf("\nInstrumented primitives (whole run)...\n");
+        instr_dump(stdout);
+#endif
+        return 0;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "bench-json") == 0) {
+        bench_json(argc >= 3 ? bench_parse_size(argv[2]) : 64 << 20);
+        return 0;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "bench-jobs") == 0) {
+        int producers = argc >= 3 ? atoi(argv[2]) : 16;
+        int msg_len = argc >= 4 ? atoi(argv[3]) : 64;
+        bench_job_queue((size_t)max(producers, 1), 20000, (size_t)max(msg_len, 1), 64);
+        return 0;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "bench-sm2") == 0) {
+        bench_sm2(argc >= 3 ? atof(argv[2]) : 2.0);
+        return 0;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "gen-sm2-table") == 0) {
+        sm2::write_g_table(stdout);
+        return 0;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "bench-merkle") == 0) {
+        size_t leaves = argc >= 3 ? (size_t)atof(argv[2]) : 1000000;
+        size_t threads = argc >= 4 ? (size_t)atoi(argv[3]) : thread::hardware_concurrency();
+        if (threads == 0) threads = 1;
+        printf("Benchmarking parallel Merkle build up to %zu leaves, %zu threads...\n", leaves, threads);
+        bench_merkle_build(leaves, threads);
+        return 0;
+    }
+
+#if defined(__linux__)
+    if (argc >= 4 && strcmp(argv[1], "serve-proofs") == 0) {
+        size_t n = (size_t)atof(argv[2]);
+        vector<vector<uint8_t>> leaves = make_leaves(n);
+        MerkleTree tree(leaves);
+        ThreadPool pool;
+        MerkleProofServer server(tree, argv[3], &pool);
+        printf("Serving %zu leaves on %s, root %s\n", n, argv[3], hex_str(tree.root()).c_str());
+        server.run();
+        return 0;
+    }
+
+    if (argc >= 3 && strcmp(argv[1], "proof-load") == 0) {
+        size_t conns = argc >= 4 ? (size_t)atoi(argv[3]) : 4;
+        size_t requests = argc >= 5 ? (size_t)atof(argv[4]) : 100000;
+        size_t pipeline = argc >= 6 ? (size_t)atoi(argv[5]) : 32;
+        ProofLoadResult res = proof_load(argv[2], conns, requests, pipeline);
+        printf("%zu proofs in %.3f s: %.0f proofs/s  p50 %.1f us  p99 %.1f us  (%zu failed)\n", res.proofs,
+               res.seconds, res.proofs / res.seconds, res.p50_us, res.p99_us, res.failures);
+        return 0;
+    }
+#endif
+
+    if (argc >= 3 && strcmp(argv[1], "hash-file") == 0) {
+        string mode = argc >= 4 ? argv[3] : "mmap";
+        ThreadPool pool(argc >= 5 ? (size_t)atoi(argv[4]) : thread::hardware_concurrency());
+        auto t0 = chrono::steady_clock::now();
+        Hash256 h = mode == "tree" ? sm3_file_tree(argv[2], &pool)
+                  : sm3_file(argv[2], mode == "read" ? FileHashIO::Streamed : FileHashIO::Mapped);
+        auto t1 = chrono::steady_clock::now();
+        double secs = chrono::duration<double>(t1 - t0).count();
+        size_t size = MappedFile(argv[2], MappedFile::Sequential).size();
+        printf("%s  %s (%s, %.3f s, %.3f GB/s)\n", hex_str(h).c_str(), argv[2], mode.c_str(), secs,
+               size / secs / 1e9);
+        return 0;
+    }
+
+    if (argc >= 7 && strcmp(argv[1], "le-sweep") == 0) {
+        string hex = argv[2];
+        if (hex.size() != 64) {
+            fprintf(stderr, "hash must be 64 hex digits\n");
+            return 1;
+        }
+        vector<uint8_t> mac(32);
+        for (size_t i = 0; i < 32; i++) mac[i] = (uint8_t)strtoul(hex.substr(i * 2, 2).c_str(), nullptr, 16);
+        SweepFormat fmt = argc >= 8 && strcmp(argv[7], "bin") == 0 ? SweepFormat::Binary : SweepFormat::Csv;
+        length_extension_sweep(mac, (size_t)atoll(argv[3]), (size_t)atoll(argv[4]), (size_t)atoll(argv[5]),
+                               str_to_vec(argv[6]), stdout, fmt);
+        return 0;
+    }
+
+    if (argc >= 4 && strcmp(argv[1], "build-file") == 0) {
+        LeafFormat fmt = argc >= 5 && strcmp(argv[4], "lp") == 0 ? LeafFormat::LengthPrefixed : LeafFormat::Lines;
+        ThreadPool pool;
+        auto t0 = chrono::steady_clock::now();
+        Hash256 root = build_merkle_file(argv[2], fmt, argv[3], 1 << 16, &pool);
+        auto t1 = chrono::steady_clock::now();
+        printf("Merkle root: %s (%.3f s)\n", hex_str(root).c_str(), chrono::duration<double>(t1 - t0).count());
+        return 0;
+    }
+
     cout << "===== Basic SM3 Test =====" << endl;
     test_sm3();
 
     cout << "\n===== Optimized SM3 Test =====" << endl;
     test_optimized_sm3();
+    test_sm3_core();
+    test_sm3_64();
+    test_sm3_midstate();
+    test_sm3_batch();
+    test_hmac_sm3();
+    test_sm3_job_queue();
+    test_sm3_kdf();
+
+    cout << "\n===== SM2 Signature Test =====" << endl;
+    test_sm2();
 
     cout << "\n===== Length Extension Attack Test =====" << endl;
     test_length_extension();
+    test_length_extension_sweep();
 
     cout << "\n===== Merkle Tree Test (10k leaves) =====" << endl;
     test_merkle_tree();
+    test_merkle_parallel();
+    test_rfc6962_tree();
+    test_incremental_tree();
+    test_consistency_proof();
+    test_multiproof();
+    test_batch_verify();
+    test_mapped_tree();
+    test_merkle_file_build();
+    test_merkle_update();
+    test_sparse_merkle();
+    test_merkle_policies();
+    test_file_hash();
+#if defined(__linux__)
+    test_proof_server();
+#endif
 
     return 0;
-}
+}
\ No newline at end of file
@@ -0,0 +1,947 @@
+// 由 `SM3 gen-sm2-table > sm2_gtable.h` 生成，请勿手工修改。
+// SM2_G_TABLE[i][j] = (2j+1)·2^(5i)·G 的仿射坐标 x、y，各为 4 个 64 位小端字
+#ifndef SM2_GTABLE_H
+#define SM2_GTABLE_H
+
+#include <stdint.h>
+
+alignas(64) static const uint64_t SM2_G_TABLE[52][16][8] = {
+    {   // 2^0·G
+        { 0x715A4589334C74C7, 0x8FE30BBFF2660BE1, 0x5F9904466A39C994, 0x32C4AE2C1F198119, 0x02DF32E52139F0A0, 0xD0A9877CC62A4740, 0x59BDCEE36B692153, 0xBC3736A2F4F6779C },
+        { 0xE26918F1D0509EBF, 0xA13F6BD945302244, 0xBE2DAA8CDB41E24C, 0xA97F7CD4B3C993B4, 0xAAACDD037458F6E6, 0x7C400EE5CD045292, 0xCCC5CEC08A72150F, 0x530B5DD88C688EF5 },
+        { 0xA575DA57CC372A9E, 0x344A417B7FCE19DB, 0x040E008FDD5EB77A, 0xC749061668652E26, 0xA6976EFF5FBE6480, 0x5006206EB579FF7D, 0x4504C622B51CF38F, 0xF2DF5DB2D144E945 },
+        { 0xCD27E384D9FCAF15, 0xA80198337744EE78, 0xFDBE86A75C139906, 0xDDF092555409C19D, 0x223B949657E52BC1, 0x037937707D6A49A2, 0x5CD6B6E9C12D2922, 0x847D18FFB38E8706 },
+        { 0x173472A58CCA247E, 0xFE8D59CB43619E4F, 0x0B4A2444A46A74C5, 0xA27233F3A5959508, 0x85227940922C02E9, 0xC3A8433140D1EBCA, 0x768F7689B210F45F, 0x379E72F63722C924 },
+        { 0x668C74D78CE20ACE, 0x125DCDD589C2FF82, 0x7C1AAB770F67F543, 0x04B3CB10C9C6D8E2, 0x739A8FD805174A4B, 0x0C94816E63C4BC72, 0x4918E5C02E2B0B93, 0x63516355287E39FE },
+        { 0x2B834F1D509B9CD0, 0x7BEA65C6421E189E, 0xFA804513275F58AA, 0x952072D6FF9C65BD, 0x03891E105E009B00, 0x58D1434AE934BA75, 0x1A473F8D9748F238, 0xE6BB9804458BB70F },
+        { 0x461B1BBCB80F829C, 0x3B424F35F0ECCE4C, 0x3291676C38D39324, 0xF73B839F13912C1A, 0x4C3533771DB0955E, 0xDC2E788FB170AA14, 0x5EE9FAB985C12455, 0x32EC7722695DC7CF },
+        { 0x36969F8B77125E6A, 0xBF5113AB85B5ED44, 0x1C993F01115C57F7, 0xDD18AA4AEC26EAC4, 0xE0180D54D4AE2221, 0x6CCE6001D7C0B853, 0x3361493F76FAC50F, 0x161E5851969DA822 },
+        { 0x1323F252E493952A, 0xF7C96C55940A4726, 0xE2E0586BB5DC9419, 0xA68B2EC49D1921D0, 0xFD4520A63F5CC585, 0xB95F2DE69200269E, 0x933EF442FCA7A734, 0x96F361A23B3DEB99 },
+        { 0xE1DE5F100950C8AB, 0x5B551C86A8976933, 0x137CBF4E8AA50535, 0x6407BE639BC5B738, 0xF945321148E90344, 0x60FCFD988FFF6DEC, 0x12A9423FD80DEA54, 0x141CAEE612E7AB07 },
+        { 0x4DBB2FCD069D45DB, 0xBB570A9F430EA7F6, 0x15C07A8C04226FE3, 0xAC8DF677299E8288, 0x7BD8B7C847718CE5, 0x0E9B9643D766DA33, 0x30C43BE69B23CC14, 0xAEF82CF361DB1C71 },
+        { 0x0263B20D539E4139, 0x7E8581FBBCF5DE01, 0xCE1564C3DF7D67EA, 0x178D1F6BD584AFCC, 0x9B499A7DA7820BF9, 0x7021AAFC29AC8E86, 0x53DA45CEC1CAADA1, 0xF575F34E5F6C63C6 },
+        { 0xCE37E84FC9541B4B, 0x02A85A7410754529, 0xD7A1F169475B4DDF, 0xEC6F34CEACAA73A0, 0x73306A0FF0485872, 0xE607F33BE20135EA, 0x6F251C63FBBD2927, 0x3C85CF62A744817E },
+        { 0x9DD4EF421635B9DC, 0xC9816BE068BE66DB, 0x625773CAE69BBE05, 0x28221C36398C4C3A, 0x2995225E66B162BA, 0x64C77A81858D4CA1, 0xAB2012C41627CD81, 0x3B4D172D6963510B },
+        { 0xAC995C5066BDAAA5, 0x27D053C0F150FE10, 0xD6B48259B69E8530, 0x08DAAE840B2A43EB, 0x2458B9E3C73BF657, 0xF7DC310560BBE83A, 0xC1B8E58150DA662D, 0x80CC0A980495AF87 },
+    },
+    {   // 2^5·G
+        { 0xA32641E56024666C, 0x791734CD03E5565C, 0xA6D5C2B5817F2329, 0x25D3DEBD0950D180, 0xD39E100303FA10A2, 0x0458895120E208B4, 0xB938C406DD5CB0E1, 0x92D99A70679D61EF },
+        { 0xCFDC959047B20F62, 0x6839796B357D0BE1, 0x2C431E27F83005B7, 0x0569F1C4A75037CA, 0x709460772E4C876A, 0xEAA568FD7C9F7DD9, 0x4EAE8CE3C8DD9B61, 0x8847A12643E7A6F3 },
+        { 0x7963CF963518F155, 0xC21B75F27E48406F, 0x8F2F2BB31DB2A418, 0x467A4CE355531ACB, 0xD45BFCE4DB6AD410, 0x116A3D9DBD9162DB, 0x26B549E62D30C113, 0xB4799B40DAEB1CA5 },
+        { 0x9CFCE1CF38A28A84, 0x49E24FD3EEB4444F, 0xC55BA9775274A5D1, 0x4039064D18391462, 0x49BAD4DBA89B74F5, 0x87A4287D22A51523, 0x08007C717CDBD135, 0xFDE0AD0C0DC31B17 },
+        { 0xE805FCEA668F0D6A, 0xBAA692B590343007, 0xA309168585B24F93, 0xD46B369F1A19FE4E, 0x681F31F531DF6224, 0x80FB1AC995DB130A, 0x690B3D40BBCF1585, 0xE8781FAECF63589B },
+        { 0x337959045AC3FDA8, 0x646500CA1517ED4F, 0x1D24270245A2C771, 0xD1105C0B2B29E2D9, 0x884D5D9F429EA6D5, 0xE84ECA9B1BF0D1D0, 0x9219EB0AC9BD1E5A, 0x6D4A3911F1CAA417 },
+        { 0x490E9204CB4D8F10, 0xFE11FA14B765E1FF, 0x4CE0E1579A02D883, 0x265390CFBF41EB3F, 0x0E7DD2B65AA22CA7, 0x77422FF851CC6069, 0x6859C1C885FBA37C, 0xF4268CCEF6BD80FA },
+        { 0xC041A64A83089BC2, 0xAF0D1BF4CBFDD44F, 0xE7D8ED60A27E1CC2, 0x68F8DD0031AA5529, 0x4A45A30D9E219BA3, 0x71F2CAC7C132B4CC, 0x40811FC2303666AD, 0x56BB89D77A5FD323 },
+        { 0x47FD81298D7F72C2, 0x4F759E8AF6FF2DA0, 0xD83CBFF6F7B2F353, 0xC969BF2BCD40E1BE, 0xF682C28883FE24E4, 0x6139336E2A8DDAB4, 0x69D06759D88E5166, 0x0052E2EBF564ACDB },
+        { 0x47133BF787D69BEF, 0x9405CCC594EF5CBC, 0x5E67DA6867C1EEA2, 0x6A9C2D65586BA24B, 0xEF69CFBAF8301B1D, 0x9D2F74DEE980721C, 0x7B8118DC530CFB48, 0x0F88E1FE0AD9DDD9 },
+        { 0x693DDD3BD1903ED0, 0xDA91040298CA121D, 0x5EC4FA4A9129A36D, 0x0169BB316AA1D9AB, 0xF27F20DB79AE0589, 0x9D269A0483A47C57, 0x885C31CDF5D4C5B1, 0x3900FC46BEC8299F },
+        { 0x313E55BCA2A85D17, 0xC6261108B6F92AB6, 0x7D03BD4BB9CB8A3B, 0x7448DE6B3385F3AD, 0x1BCD398B459E282C, 0x35540CB4636CEB38, 0xD2BBA953381BD91F, 0x134C92EFDF0D2443 },
+        { 0x82CEBE9A7D7F14B8, 0xF017C97332BD8858, 0x109F9D04A97AA564, 0x9C80461C52FA1C9B, 0x0BDBBC39CFD2A438, 0x9110B4DBDDFF142D, 0xF8009061B3176140, 0x54AD62E340AAE038 },
+        { 0xA861D5AA5368E5E8, 0xF2B714723153EFB9, 0x5BD83D3F4FBC7129, 0x8A23E4493AFB523F, 0x8CE5B5D9AA8A94A5, 0x854399880CE9488D, 0xAE6171837B55F164, 0x465FE71BC8A8A6E9 },
+        { 0x06AB3CB0BAF95CDC, 0xE092A97655C619A3, 0x51D791030DAF09C5, 0xA233659EF85BA6EF, 0x64BF05D04302D0E2, 0x90C71950C6C76385, 0x6450EBEC2F91ED5E, 0x7A436DE02DFEA18B },
+        { 0x54CC81D9A94F808C, 0x3E64965B8687338E, 0x8054598CC4E9DC83, 0x63945344A2FD0C4C, 0xDDC15BA089A4FE2B, 0x8A0B3ED020033ECC, 0x5FB99E8CACC69D1A, 0xAF7C638DE0A310CC },
+    },
+    {   // 2^10·G
+        { 0xD1952984A42C160F, 0x76E1E9656957F8B1, 0x61C022AA2B712591, 0x33FCAA4055C87AEB, 0xF2F3F62C4902C505, 0x2E04362A29622184, 0xF9A8906E4CE8D974, 0x67A92A7C276D6C81 },
+        { 0x5663A0C61D9A4AB1, 0x29F2CE0A4970DA65, 0x3437B0EE967E6486, 0xCC33FD7763B4C8FF, 0x4C88C518FBA76872, 0xD3BC1ADD7A67898D, 0x25F2C0438F15C0B7, 0x09E3614E693F9607 },
+        { 0x0499E866DA526590, 0xD8CEC600D216861F, 0x969FE2788866AE79, 0x4E7DE95ABBFF7B21, 0xAB967470419117B1, 0x2A4E69C1EFB6E380, 0x2B30525B18F750E6, 0x145D53C14819D8C0 },
+        { 0x358D5C7E649055E3, 0xB6D566C2E5A72813, 0x3751781F16CEF998, 0x10820CDDA14076A3, 0x3244654A70004F7C, 0xDAC80E58C4A1EE30, 0x39987EB1363CADE4, 0xA1A250C689823CC4 },
+        { 0x5DEDFC82529EE997, 0x8EE63D6A9E1F97F2, 0x2481EA70AEC7978D, 0x1E9F21F31414A9DC, 0x2FDA35696DD6AC60, 0xD4069EDDC09B6D7A, 0x6FA6D79E8C61BAD5, 0xE9124037DEBE0315 },
+        { 0x1730272BFD21ABAC, 0xC63AB0C6B68D10BC, 0x2E83D0952EF00657, 0x133BECE3DF9C86D1, 0x3A3BFBB20CC11064, 0x3F71CD6FDF036725, 0xF14B04848C890F44, 0xF08282B4DD96BDC7 },
+        { 0x193FB99A8AFF3BDC, 0x44E06F020052FE20, 0x047499FD10C250AD, 0xB6867C613CB94540, 0x36A583541A5E6DD4, 0x022FE6942417E0C1, 0x557CA9A79A2005FD, 0x23AB3219F130DED3 },
+        { 0x088BE87FA8D71291, 0x65960D4D2A0568D0, 0x60C9C6E644CD577C, 0x85972DB8164DCF7F, 0x5EA8A6C7C3D81E99, 0x6D183A1B547D4790, 0xD276B9B33785056D, 0x443B854CD2E6672D },
+        { 0xFE1264E759B15B5F, 0xC90C6D42F891D08F, 0x50D5C463773C15FF, 0x18FA2A8638055787, 0x3AA1148F3AE55D80, 0x5345F5058B5B3017, 0x36A05171C9BE1EB7, 0x28F8A6383658C5C4 },
+        { 0x423B8E0B9BB47FEF, 0x202A3278D522C149, 0x286BA25E3AF87E2E, 0x604DC3F56947BE29, 0x98B284ACACBF5F5E, 0xC3EEDDD591232F46, 0x0DC95FE8E31D6CC3, 0x58A478931641ABD2 },
+        { 0x04432B31776FB69A, 0xF06F937911A0C85A, 0xA9B1A7FF5D2427AA, 0xC2857BB49EA2B24B, 0x370E72E71B0B2DDD, 0xDB2E0E456C00285A, 0x16B20F48BF1F1B7F, 0x6AC9F5E466D30B06 },
+        { 0x5788CF013DE85217, 0x726EE59B3A7C2BD3, 0xA7B3F5E24715C959, 0xC8748945BCEC97CD, 0xD65881223FEE88F0, 0xA775FC34D29D243F, 0xC2222C04196A6BAD, 0xC3B1411A427E140A },
+        { 0x9F1024297803752A, 0x56D6C5B90E737B77, 0xFC9C5D74AC9E4CD0, 0x1BE479F113DF8ED0, 0xC085038CB762C45A, 0xAC5C34EEFF1C97B6, 0xCCD051A558AFA7D5, 0x456A3D85F945B88C },
+        { 0xCB9AABE58BDE2EF1, 0x4006D33C1942184A, 0xA5DC60B5D1F0BCA2, 0x6916FA84AE5FFA7D, 0xBFB074F9AE3B72CD, 0x8D056BFE84EBC669, 0x064D8640CA0C3517, 0x3DC9CF6B51665764 },
+        { 0x1B483A68320B3B73, 0x5523544C2283006C, 0x37707CD1D1F8220F, 0x2E79FAEC83D19B25, 0x48BDC14A2E52F984, 0x92F8DE0C70CD069B, 0x5EFCDC28EDD6A4DC, 0x43D3190E41362848 },
+        { 0xA292C13A36061421, 0x057EBC08577913C5, 0x0C8471DF91468267, 0x6B38A78D6861A13B, 0xCE75CD1E0CF35EE0, 0x344B8615F7EA78D4, 0x6A18BBDDF52BAABB, 0x7AC85E6E9E88D446 },
+    },
+    {   // 2^15·G
+        { 0xA4AB5E0B2A35430C, 0xBDEC579C5E68D45F, 0x5AC4BCFDDAF74D4E, 0x60A9A380525DD890, 0xB6CC29B6591628E4, 0x55D2E0A1AC916355, 0x16665A96B6B5974D, 0xD66000FAC9CED98E },
+        { 0xE54E757446937189, 0x23CB91ABAA1D4063, 0xE094E3B626A66DD6, 0x32B59B98649A9D10, 0xDEB047572D0FAE41, 0xC657E46327BBE2BF, 0x2912704221A464F4, 0xE1D50D8361CF824B },
+        { 0xE6D98F684C7ADBA7, 0xCE9E43C6A9D4B33E, 0x0C0DD8765B5E6D36, 0x1AA4F47E4C3D1AF4, 0x1BB7DBCB11EB9166, 0x5BE7C8458DE1D19E, 0xF78A3397E94C80AB, 0x026C105D7C9BAE08 },
+        { 0xF5D57C3AB32F6811, 0xDC668B44255F9E26, 0x91DE8E55F83A0EEC, 0x4F1B2512CBEB79BA, 0xD777FA41F0AA44E6, 0xF1015E03E9D7EC03, 0x45099C27C8A09D35, 0x8C7B64B6ECA67036 },
+        { 0x34C9EAE5CFD146A2, 0x19C1BFDB3BEC6014, 0xBBA6DD6AA7F0E595, 0x344AE3EBA16A867B, 0x7626EBC125ED960A, 0x747186075D9A95A0, 0x3C4410FF5386320A, 0xD8B72C23C606A448 },
+        { 0x3B27359D79AD1B87, 0x25DA11D9C054D033, 0x1D2E8FCF32CABCC9, 0x52C6EEC1DD890902, 0xD3583132F75F9012, 0x19F0F6EFEB89F798, 0x0B170968EB421367, 0x861CD8848D752463 },
+        { 0x48F9C20C8D177772, 0xA5DE0FF275EDA7F4, 0x2AA36E6AAC08A142, 0x146646E3EFDB8054, 0x3979D6364DC88C0D, 0x21A88611D6E108DB, 0xA817377814A14DE6, 0xC106EE58FE3B266A },
+        { 0x76863C1526AC0B25, 0x89EA4483A53F5F7E, 0xBCC12699B0A9563B, 0x2AC00C3CD0F7B8ED, 0x7D096FD02FD5EC9C, 0xC2F907E7D5E5958D, 0x71B037763EBD390B, 0x0499C94EF419FAD8 },
+        { 0x4AD1F7BDC112892A, 0xF4B6E375FCBB6AC3, 0xA13FA223CD024D5D, 0x31C01319444633F2, 0xCF075DFD9743E219, 0x077AEB0CA7B8909E, 0xF3F3968A27D70195, 0xAB43E8FC5492155D },
+        { 0x04E0B68C24A7CE37, 0x61D0BF11B5E4CA08, 0xB2ED3E8D056809A7, 0x7581D8DCC8126C4F, 0x180F1BFDD9ABE997, 0x181D17756E4E5079, 0x9C85FA89616363F2, 0xE1D695EFDB33E8CB },
+        { 0x763E70DB616F77EC, 0x07555E37821C3950, 0x3D642589CF139C1D, 0xC8D6C2FD9F7CC716, 0x128D9F764C5E7B22, 0x97F48A4475EB6464, 0xBD452B899B1B0C96, 0xB2992B3C7A6A7723 },
+        { 0xC5EA8A2C9B858F95, 0xD9BA2AAC94552591, 0x06B5596205C6E3A9, 0xB2DE4A17E419960F, 0x846DD7FA7AF0DCFF, 0x43D680571F381A43, 0x363E54304BD217E0, 0xB98E4106BAB93840 },
+        { 0x7D2C0B7EEFED9333, 0x7A2174BF226E7113, 0x868552C229A26C30, 0x98B9E84B280F3F49, 0x5E44CE169998933A, 0x7BFAF93FFD23606C, 0xACEEA4EB4680F0F3, 0x497A07A74F4DE8FA },
+        { 0x15B69B8E347D7846, 0x2DAE8EB3D2AB4F6A, 0x8F349AF3487E2F84, 0xE310246E84A71C66, 0xB0542AB0C63EC242, 0xCEF5A1B615CDD7B6, 0x09ECF659FF049604, 0x120CE933E47A1501 },
+        { 0xAEA16BE0E6FE870E, 0xE29DB3BF2EF78885, 0x97AD15477A66C9C6, 0xA1F60A648D5B1A64, 0x32E4B06B7BE42E05, 0xE4A2C6033FEFB9A3, 0x7FFE9EE70EE6CE5B, 0x2497C595D6C1E433 },
+        { 0x4FCA8479C4308988, 0x0BBD1D2E85150025, 0xC4EB00FC958E9A5C, 0xDFA04DCC2F65460E, 0x9B49D580520922A1, 0xC738FA821EEE4E52, 0x9ECFE623818D4D34, 0x39F658DD86CE4871 },
+    },
+    {   // 2^20·G
+        { 0x06F4B5B644608D09, 0x1DF17698E506EA02, 0xB8E581555197280B, 0x528D42BDD74AF9CC, 0x05589F0BCB5B0E7E, 0x245926ACC4732ACA, 0x56D6AB0B0D751EEF, 0x22DC58C3CF902884 },
+        { 0x7EDFAF73D1EBF423, 0x493DB7C3C21C8AE9, 0xB6CC327FC8FCA50C, 0x100D33C71621CB00, 0xB14E75A7F402BD3E, 0x7F0FD112998E6AA7, 0xFB971B7DF0CF0305, 0xCCE6FAD26A7146B4 },
+        { 0xE0B25F40F8A95229, 0x614D19E395026404, 0xEC773DC21DAEDC04, 0xBA48556BAAE16388, 0xB0CE57FE2CB3AE70, 0x0C8CD6C46311B484, 0xF025BE0FA84E32B2, 0x414956B10D5E09EF },
+        { 0xE5E89B51B00CF9CB, 0x2C751E818855BD7F, 0x0F89E2C826828DC3, 0x7E891FC8E17D9C8A, 0x3628BC962DDF6430, 0xDB45C304F8DA75F3, 0xF7741893D30AE47A, 0xB291FC7DDE5F1EC6 },
+        { 0x44152DB6E842CCE6, 0x15F0BFD53B68E078, 0x788C4704F9AE91E2, 0xA434CA03F8F80E34, 0xA8513CE54077B73B, 0x64C986673B9F6DEF, 0x3599D1F40408508D, 0x830B26B446B88EDC },
+        { 0xF115D2E091B5A157, 0xA79621534581BAAB, 0xAC4F1C4A7DD3CC5B, 0x5DE3EBA570A70F97, 0xDA34CE7A78FB6C6C, 0x319DD6C86EB679D6, 0xD944E4E7F16A0980, 0x066B9BCD51B4AD58 },
+        { 0x232BB32D97595076, 0x90BF58B35D1ABFC0, 0x72D0B2907AF66B91, 0xC7FA661133F2A951, 0x6CF30EF3657E7042, 0x508AD0F6160B767F, 0xB19CB4D4E6ABFD12, 0x07E9CDC0317565F5 },
+        { 0x2B23472C86F3D42C, 0xDFB752C6E70DF66B, 0x440C53749C109FFD, 0x51EB1D3E92FFBA77, 0x7ABF2311203C8C7F, 0xF5C9A9906D15869A, 0x328D57D8B3AC203E, 0xC23D4E465C428841 },
+        { 0xB8396F99F3E8EAD6, 0xBA3AC5A099780CDD, 0x7CE0B05F33211F64, 0x7AC48B0CC9293CE5, 0x2DEDCCDF7240044A, 0x5B408212A98C8566, 0x04587822DE26DE2B, 0xF46DD87844B0025B },
+        { 0xC19F0A41B5C7E0F7, 0xEE99EA809A316503, 0xFB1E8C75075E4A11, 0xE4840E0DC7A9A254, 0x2B1FA3154B53DD36, 0x6E3FA25840290CA6, 0xC8789119F6ED6572, 0xA7060AACCAD1B88C },
+        { 0xD8362DBB4094FFD4, 0x8E78ABDC414BE4B9, 0xA43E1415DDDD026D, 0x8897DFE8385EB28F, 0xBD52C1195CCDB3EE, 0x201F0D707B069479, 0x816E813DAD84E92F, 0xEBE91C14DE215788 },
+        { 0xD1218144718EA14D, 0x708EDDE812A22ED3, 0x6631EA8F5631C66C, 0xB6160B462AD2474E, 0xC93AE38C06E6F5AF, 0x22E48BC16EDFBA7D, 0x44EE946FA2596BC3, 0xD4C1E3E0D1D695B5 },
+        { 0xD5393A93359E17D9, 0x81C47E5C5017FE24, 0xB69B0236433B014C, 0xA4F0FDF7AC90EAF5, 0xB917A45E67144BE3, 0xBEAB0AC0CB7B0A46, 0x4E06CDB79A7233C8, 0x16A0E4A533AD4D6B },
+        { 0x7291DC007536A615, 0xD693219914F3F3C1, 0xF115C1C248A210B3, 0xCFC3384B761969B7, 0x172B3369BE2CE7DF, 0x0F4ECF687CF94B7F, 0xBE062B9D9540A6E3, 0xA46D8A4BD9F0DDA5 },
+        { 0x43C53E58734C90C8, 0x79AE54291939DD93, 0x37DA12DC73832B51, 0x38DF8B64C61B16D4, 0x6AC6C5F6ABE22049, 0x04DF9D57E6016580, 0x655FEB49182AF081, 0x3A4D785A49142EBE },
+        { 0x0019E2088E71014C, 0x37CDA7F13DF10BE8, 0xAAACA17EA5DBE0ED, 0x60466F2A87F72A09, 0xE327336A685F8E92, 0x8EC56B864B4A241A, 0x1B94905D5D43A04D, 0x99C6D27C444B54D0 },
+    },
+    {   // 2^25·G
+        { 0x42ED9AED861543B3, 0xA6DAC9052BCD9FEE, 0x9BB46DC7849882B8, 0x802725F4F3ED580B, 0xB0315CBA690F2EEB, 0x7F4CF904FC0F2E5E, 0xDA1E50B7D2BF3BB2, 0xF334DDDFFEB4112C },
+        { 0x0D7A333AD43CBC07, 0x62DB1EE2C5BAF4F2, 0x6398D7179C719E66, 0x319999822C32948E, 0x5E0872E6E16001EC, 0x8F72D00606AEB35F, 0x74773EF9C19E9966, 0x155391F8465506F6 },
+        { 0x0805988C101B0880, 0xF928C2D3B1296A21, 0x619642865FB1DFEC, 0xA3D2A2AD25746021, 0x0FA48081CCE10077, 0xC6470087A128E9A7, 0xFB66E18200B5E018, 0x129C58D559F07A83 },
+        { 0x992B51C1D6F3BE34, 0x9DC3655A10C468B7, 0xDBD6911903AFD7C5, 0xE100670C46823E24, 0x945942EFA102AEB3, 0x57060B5B80A4FDFB, 0xFF442806E7F43B6D, 0x1EE46A9CE512BEC9 },
+        { 0x6E95A63AE594F1E1, 0x424F13CA3592EFC7, 0xCABAF8B84E6852C2, 0x5CFB09A4B596CD35, 0x1B9C0EFA08E7B3F7, 0x15C2F594554D0D55, 0x2B728DDE0084A829, 0x4894E21D9E3145F2 },
+        { 0x97801059FEA55530, 0x40E2524699294634, 0x13CD9C5E049AC8AC, 0x942E2D839D75B9A3, 0x51CE2F7D85FDC9AC, 0xFE7DB2CCF18EE4F1, 0x213C7BAC8526962D, 0x457459EFE7B25AF0 },
+        { 0x4C2AA77B5F774278, 0xECC84D80E7232C84, 0x235E9E55A8A79993, 0x996FC08D120187F3, 0xCE3E6DAB771FBFF6, 0x564CF64D225CC775, 0x082481B092FACE1D, 0x5C5D45972357B379 },
+        { 0xC8C407E04C8E31FD, 0xC1BA041EC488FF38, 0xDCD35790882F7F61, 0xA832EB985FE10D1F, 0xCF13CFF698FBA59A, 0x0AC55194A57F8D9B, 0x6785563015BFB864, 0xAE279E9F50CA2EE4 },
+        { 0xE1E913C9BCA57815, 0x705F5866E9813CB3, 0x0A6245B603A2DBE0, 0x8873F33EBC50B0E1, 0xB85B10860AF17B26, 0x0B0C4F3F26A09CC8, 0xA0F03154E647EF18, 0xF39FD72C3FDDDD61 },
+        { 0x982C1988F436F67A, 0xB6D8C62E6FB6E884, 0xAD15CE3734C73DA1, 0x8B12C7FD557DDAA1, 0x0260352E9A3E574B, 0x1D419CE76A2C9888, 0xF4F29CB804F96DBB, 0x0A18C43FD40E293C },
+        { 0xCB27D16AF5A79249, 0x518C43DB4972589E, 0xBA0E01F1AAF10C52, 0x3BE086B45378BDC6, 0x446515092324314C, 0x1EFC5DD78C46F5DA, 0x1086A856F5F5FFCA, 0x7802B5C71CC8BB97 },
+        { 0x5E6C240BFAE79050, 0x93EF52936D8E8ECF, 0xC1DC8C960104544A, 0x1315846C38A28F28, 0xE58B3B8E234218E6, 0xCE8A06EA6F869B34, 0x89E015F4A4563BB5, 0x60B59181364AA5D8 },
+        { 0xD674C5334FB996B4, 0x7A7A51F9C2E07EA6, 0x66EE9DB53EA67989, 0xE9D9E4D14F5093D7, 0x18BF3DCF04D532A9, 0x4042826AD81FD635, 0x71D80C0E3790ABA7, 0x9B2B525966C111F9 },
+        { 0x2CC476B8CBFAD6B6, 0x8624394338DEC52E, 0x88AC69953A09849C, 0xE97DC171637C5546, 0xF99A4086FEF67BC3, 0x3A350ABEB59BC215, 0xFF18EA4AE3663F69, 0xFA75F329654FE2AC },
+        { 0xCA2988916E23112D, 0x81EC0732A4FA7F94, 0xA33B11BCE96C81CD, 0xE2745C04857E8F2F, 0xF600A8B2AC798498, 0x778D7E145974C51E, 0x609BB5DA371925F5, 0xC5452B018EC72AE7 },
+        { 0xCA540FCE28A63BA3, 0x40F8BF14964C6294, 0xA8AF392B73954BEB, 0x3FE7099B06334F6E, 0x804511335A403430, 0xC73EF3705AD6872A, 0x9E71B7137325C13F, 0x5019E321DCB51420 },
+    },
+    {   // 2^30·G
+        { 0xB455B45DFF711A97, 0xC6CDEE12F4A73224, 0xC5AC0179D6A5743F, 0x204643BBAE0B27D5, 0xCBE67EDC6F15F8AD, 0xF777A811A9D93E24, 0xA6B4C2867D4FDE9E, 0x50023795AD369E5F },
+        { 0xED1C5C03C896D90C, 0x81D451C79BF48502, 0xCC97A274280D67D9, 0xEC0EAF51D75B35CF, 0x1EB6FCAD5CE66F0F, 0xFDAEFD72DB579B86, 0x8E5AAE3324A5E959, 0x3233195E19D91ECF },
+        { 0x736F1C796918CC1C, 0x9B5C5D922265E740, 0xDA53BCE6E1318FE7, 0x767D7DF2238709BB, 0x6F3ED4BB76650225, 0x182EA7725F0938A2, 0xB4B93003BEE4871B, 0x40067812E87E0906 },
+        { 0xC89022DDB3142EA2, 0x3FF51AE8A931FF35, 0x50AAC491DE173A7F, 0xA28EBE994F74ED27, 0xE0502501FEECC476, 0x9DE8244124FF7B56, 0x69F1ADBE548EA98E, 0x9CAE21A765E485A0 },
+        { 0x04AFC43D45EC4189, 0x184CF264DF913F36, 0xA5E70CFDC223ADB5, 0x30B9F72AC7D57009, 0xC2E5D573C6E2B0C8, 0x731F4E97DC1C849A, 0x66E5D1FF52F8EA8B, 0x3A402C4680D3C9F9 },
+        { 0x38CE9E0F64C9AC4E, 0xABC785D54D0B1B80, 0x2CDA9698FDA1E7E7, 0xDCE7F1E5642D68D9, 0xA25B15E3C9C0645E, 0x34E7D4A54416CF40, 0x3A2E86453485C56C, 0x1EA0DC9B42B37243 },
+        { 0x91D6553AC7AA725A, 0x8C148105ADA5011D, 0xAFD954C33D384617, 0x45CCE989620B0EE9, 0xB5F6BD92E38A3614, 0xF9806E610F491815, 0xA7EA44AA3B443EFD, 0xABDCA9581565D5DE },
+        { 0xA028AC7B96B31269, 0x5E4FC1C8FB84BEE4, 0x5AC653D3F0389E56, 0x531D59B3F909A3AE, 0xC4C3F2FA4F7F4A67, 0xD0E82AF5F69C007D, 0x7ABF28AFA1A1091A, 0x82710BEA61F6D5EB },
+        { 0xD6D83EF126C92B88, 0x02FE4F4D372BCE57, 0xED624A4C1D718FDF, 0x6A3DA96AFDFC3843, 0x5C96BE0CB548A732, 0xC2212EE6E3804104, 0xA9D9A8A105F3C56A, 0x9D47731341E4A05F },
+        { 0xED39B46B1295366C, 0x210FC40CBFB345DB, 0x0DD261FB4BF8D93C, 0x510B7999901D68CA, 0xB53ACFE51BE9398A, 0xA8FA56FF71A878AB, 0x5BD19251828145A0, 0xFBD2C71D0A15305B },
+        { 0x1B245352092F6D42, 0xC5BA498DE2E9D487, 0xD6FAF3A98C8CECCB, 0x3A22DE9EB4748556, 0xD36A96AA48858FA7, 0x9FAA6B5148E2E4BF, 0x3BBF74DFD3698C10, 0x497824648A9426F1 },
+        { 0x637A93C49E8E2548, 0x647383961C00AF1A, 0xD8BC5F6C9A3B7389, 0xC64F05FC95E41AAA, 0x2409676274947344, 0x376E8B3954761009, 0xD43E142DF6F5C246, 0xB6C73BAC13AC087B },
+        { 0x8DD04CAD4252F0AF, 0xC9362B77EBBAA118, 0x6E4FCA6B9FDDD652, 0xCCF83B5856865343, 0xC46AEC4AC01961ED, 0x6091E53517C5EA30, 0xCBB3D401B43255AD, 0xBA68D3F4325EAD4E },
+        { 0xC6948D228F4CFEA7, 0x811CCD7909B38282, 0x1898339C1AA5E5F7, 0xC12CD12F329F417A, 0x3A8ED4E74548E725, 0xF410E4D281C5BB42, 0xC23CE41AD9DF5A31, 0xEEDE6663845820CA },
+        { 0xCB56218902874CD4, 0x2D673D5CF7E1A2B2, 0x69B2B93D9885E589, 0xDC7EDB3E96617304, 0xB204B537D8EF6942, 0x661DCA69C9F6089F, 0x0B3E76DFA693CE9A, 0xB8572F064EADC969 },
+        { 0x2AE652C858B6B306, 0x6525E6621D409DFF, 0x92624B1195C34BF6, 0x81FDEDB821FB611B, 0xC40B993B8B16B230, 0xF5D133D420202917, 0x302084923C5D9D57, 0x434E5F5F1C79D042 },
+    },
+    {   // 2^35·G
+        { 0x559B2EF1191938C2, 0x0904120044E6619D, 0x9B412237D49E8C08, 0xA9C7B33ECB50D796, 0xCE71BEAF6D1A2066, 0x05982D236E3699D4, 0x7EF041F65BDD5DFD, 0x92F71DF57E10E1DF },
+        { 0xEDC22969D1C97ABB, 0xE96361618325E027, 0x0C72B206CC0738F6, 0x3329AAA4346397A1, 0x8541C9611D60E115, 0xC9C80CBFB4EF3C7C, 0xE9000B60A281AB77, 0x2DA579151532C076 },
+        { 0x3725B51F0AC33C85, 0xC5261224CF7040C6, 0x2D8D2BD90EA31036, 0x6600BED1EE3ED81F, 0xDAFD1254F4AD0B9B, 0x4547D4BB47FF955B, 0x92923D77DD27F3CB, 0x3FD86BFD2E6D5D54 },
+        { 0x1C1A08BCD43F1973, 0x88732D942367AB21, 0x01E6F6FA5F065F47, 0xEE45EACE122D031D, 0x9C017C86B13F1199, 0xABBA94829FAB9987, 0x6905DB2612D71133, 0xFBC7990AE35B5EBD },
+        { 0x9CF2623C1A97E865, 0x0FBA96C5F7D4475E, 0x8D963B9BAA6BD223, 0xD8A882157909CFB6, 0x97A217A4714D5FCC, 0xE7CEDEDC7CBBE7D8, 0x539E4F876A685FE2, 0x5BF162FE44C20D78 },
+        { 0x6BDCFCF084966D3F, 0x8F4BC9D05B08737F, 0x4C073BDDAAAFD5E9, 0xB8C7D0E3FFF78405, 0x263D4C6AB8F48525, 0x5C1A61E91536984D, 0xAE6C615039505ADC, 0x1466872A983A7714 },
+        { 0x2C9840987FEA1DBD, 0x21C87B8C474A53FF, 0x92AD540D46C589E5, 0x5AACD3D96D98883F, 0xE58926AC3065C818, 0x65FCD82B582C6F77, 0xC828A1BC6ABA4EA6, 0xB5937C157934E50A },
+        { 0x82DD9FF981B5D96F, 0x4D91221E227D5795, 0x507155E1D597C644, 0x6CD826044733EE90, 0x2BAF2543A4B383DB, 0xD5744195291C7203, 0x137A52ABA94E7EFE, 0x55EF259F455E95FA },
+        { 0x2AD1EA25E9150244, 0xB41954E82E3CE893, 0xD7EDA3A2925D4AF0, 0x85283C40DC88CF5D, 0x8AEF1F337F7E747C, 0x2996F94DBE63A81D, 0x7433B18E9494E5E1, 0x6E5263C3D1AA4244 },
+        { 0x7324331E708C6E02, 0x88CB30B6CA3C5D56, 0xD2EAEB728A4183F0, 0xF8ED98253559AAE7, 0xFBF90AE24FE2EE1E, 0xA0F4F24F25304EB2, 0xC0E532CCA01CDAC8, 0xF2689535F1BB5AF7 },
+        { 0x717ED1CB8A31EB57, 0x0719978575E02008, 0x5DC0099E12028718, 0xFEC4E48E30FCE0C3, 0xD8598DF282864A50, 0xE6917D204A61CAC2, 0x6EE04744EFC0A109, 0xB9C568997EC2E7AC },
+        { 0x6413CECAEB6FE2BB, 0x1D50605BE07E5C88, 0xB02ADEDC33EB691D, 0x816660E2DFC1950E, 0x07524DBC2F583BBC, 0x85F4258C2CC4E3B4, 0xFF58FED6377F0A65, 0xBA3B588DCF68B1E9 },
+        { 0x528B4353A3F3FBFE, 0xB63A21C9B5C62352, 0x576C2756DEC31A1C, 0x15FB8C48EADA71D8, 0x2CD3C983A7758377, 0xF8D031F609CAC75A, 0xC339942415F1FC30, 0xA259D61BE67A62DC },
+        { 0x367DAE0C4E1B3E30, 0x12852FEBB3DB40EC, 0x804D2A105A164FF9, 0x5F3B454F997C8D7F, 0x551D578594EFD18E, 0xDAC4354132123894, 0x37E9E741CA764308, 0x7FC96E6BC728BD1F },
+        { 0x98AD15F5DE78478F, 0xD17FE6265171C974, 0x834606EFDCD46FAC, 0xCE272D63E9779091, 0xF59FB74BBF312A64, 0xA35DAC88C54A7F94, 0x7C506804B6C8DDEF, 0x9F4299F83166FD4B },
+        { 0xE4397B826F4F4E34, 0x30CA997526BB4425, 0x9D063A689D2FBDFB, 0xD67B2677045D794A, 0x9A24DAEE119DDF12, 0x3A81CCB1EE967087, 0x3A5C63064098F1F8, 0x056FC8FBFFE74350 },
+    },
+    {   // 2^40·G
+        { 0x5A8F38D7C83969D3, 0x802E5F11F1FE9D22, 0x971E2233B3706DE1, 0x76B6337D587E2BD4, 0xA06D4DAB9D9AC34C, 0xFDD1886EBD1F51EF, 0x753F34E2259078F7, 0x8A15315B0CACF396 },
+        { 0x6C89AF1A010BBF7A, 0x67AC01E0658D9387, 0x9B6E6D1E14B0454A, 0x97805FCB273874A4, 0xA01F1CD26887A47F, 0xFD1FCFA70AB32902, 0xA7042E601D1E1A9B, 0xAD0EA9E01017A3EB },
+        { 0xB3986530D209CAB9, 0xEC6EB9239E6294CB, 0x6E85CFCA53843B58, 0xA67675F0086BD6AB, 0x10B68155186A319A, 0x05F8A1E9A94B3051, 0x0D9C996C6E481FB2, 0xA24D73B257F7D639 },
+        { 0x8E84A76F246504D9, 0xA0C3A71DF353DD88, 0xA19FFA2870180346, 0x656A24E87545AE36, 0x413DA8429EF9893F, 0x05F3AB116DB164C3, 0x344896CE075EA7F1, 0xA411C893772AED68 },
+        { 0xEF308EED0C6B0F53, 0xF405B8138250575E, 0x69D0AB18297BD846, 0xB08AEB90D77F4C09, 0xB8DEF247C2D31CD7, 0x905EA96433337D25, 0x57F541D40DDCF9F7, 0x4D5F02A52CE2C2E5 },
+        { 0x45103933F83E3FF4, 0x6333B523211F9884, 0x8ECB3B2EAEC7DF08, 0x16576AC0E468B71B, 0xC8BAED988A5DF212, 0xB2CDDAEC863A445F, 0xAA5F8565CA886E80, 0xF0F4A4FF78AC86E7 },
+        { 0xA0EF242BE7370743, 0x14649F37FD36321F, 0xC579CE78F526EAFA, 0x4B9E803195FD047F, 0x329712A3DEA2E5F2, 0xE28FCC37F828C360, 0xF77109E010F722BF, 0xFEA9211C86989B96 },
+        { 0x2FF3559F66BF2644, 0x111F0DA19555F56D, 0xF5952BF6C13C7920, 0xCB90C0292F38776B, 0x44527E4F7BDADCCA, 0xE349D06EC5435A0B, 0x7A8C54BB993B4773, 0xDDEB22A41DA24827 },
+        { 0xA9D39167F9B775D3, 0xB6BBCE0669F760F1, 0x007B924931DB01C8, 0xE5591A4E0A73BA60, 0x20B60C96C6CA5770, 0xC412FBA9BF8B54FC, 0xBB45AB8AE41C5932, 0x9F9D9F0FA06A6C9C },
+        { 0xCAAA99271D59A2FD, 0xF2B45757725718AB, 0x28B3BB2C718AC7FB, 0xB6ABE034E1C0730A, 0xC0361DD1D3CA1047, 0x3332A34CCFFF9AB3, 0x5C3164A35800A6DC, 0xCE50182D7221B1A5 },
+        { 0x8189BD8D2E388B3C, 0x67D550F7976BDBF3, 0x17DD654E05F1BCC8, 0x26549BC51624762F, 0xB5659F35D4019B26, 0xE752652BAA8022BC, 0xC18717CAE8F7E4F4, 0xF9C226875C1AD55F },
+        { 0x2053F2FB4542B014, 0x6CA82C87D680552E, 0xE001CCCA4A9061F3, 0xD87CBEA55540C14E, 0x83E3A248E1273CF5, 0xAD48E51131DDBA12, 0xFEFE9A67AA385551, 0x623F96EF8E63F1FC },
+        { 0x454B1FEB93B91386, 0xD88C37B51DA79BF3, 0x95055EF4F1EC57C3, 0x25690F62C0A106C2, 0xD9E1E9B8353E77F7, 0xBDF62B686CFCCC17, 0x6BB4600B5DAFE3F4, 0x645B4429C72316A4 },
+        { 0x3303A1BE5D9D5A3F, 0x42769B6234557C28, 0x4F12CA2BB28C3B15, 0x515743C347F0255C, 0x0A16D1BA01C8A420, 0x906D648490444C29, 0xC76F05738039F31B, 0x36DCB048C5E59C4E },
+        { 0xEE7435D9FAC186B2, 0x2391FEFEE84317E0, 0xDF3CEE7F9F3483D1, 0xE0E36622DAE692EA, 0x2DBC3CCFE6874D28, 0x969B6B2B4F859F06, 0x12527C1CF0E1B0B5, 0xF3E5D5B7413151C1 },
+        { 0x2316E647FD34D4A8, 0x936988BF50CB343F, 0x43A65ED5FC0E0E63, 0x1F660B2F34F216A4, 0xC846E84F339FF9C0, 0xB0A0F58BDB8B3255, 0x58A3D6F0A05181EC, 0x6D850361E04EC675 },
+    },
+    {   // 2^45·G
+        { 0xBE072DB0FD188206, 0x45AF81AE1097CE4B, 0x762443E60BA0A6EC, 0x3B81EE490E49AFCC, 0x77B5743E2483A147, 0x0E8AD1158C4DDC8F, 0x842E45257BD9324D, 0x8A092A5D4CD7B6B7 },
+        { 0x952359AE716680E9, 0xAE90FC1E6548CD2E, 0xAFAC577B0390E48A, 0x89BBC1DA1365E680, 0xAC581017531D487D, 0x529DE57E8531636B, 0xAA319C7C0F14EBBA, 0xE85977E3E82A1E7E },
+        { 0xAF2D628356B3942B, 0xA65165691FA22BC6, 0x670F5D1D2EB8EC0E, 0x61A5B9E0DD0B9ABD, 0xD1A2FD4132E082F1, 0x7F13D496FD6D49BD, 0x79FEF238C5AC037F, 0x559DC1C23A70F87B },
+        { 0xB139B12BD23E98F9, 0x5C7566DE20E925BE, 0x9B697910BDA9C5BD, 0x462503EB9FFA92D8, 0xDDFFAA79064A2511, 0x7481C720773B648C, 0xDC9D99FAFB1CE957, 0xB4A25AD1553AF1AD },
+        { 0x98719B34EB549205, 0x6C86605BE05A1DB0, 0x1E9EB60AFF77E322, 0xBFDDA6F6CA6A2B73, 0xD13B2EE09D418740, 0xD85046B1303F7CA3, 0x8031DDDB0D78895D, 0x73A6FBBCDCE94544 },
+        { 0x4601712BF04AA4F8, 0x1648A0390F86839C, 0x4D2FADDA537C6F77, 0x71200A475BA959DC, 0x5F27E4ABAAA9D68B, 0x0519A586D27F4C2B, 0x3650722F37F0271A, 0xD10E9F6C0E4A7441 },
+        { 0xE8550DA58130BB28, 0x6C00A23840D1BB1E, 0x93153DC97E12438F, 0xAE0F170E101F9637, 0x7B70A1ED653E4F1F, 0x914DDCBF39A2422D, 0x701BB3A60A4A9E5F, 0x88E1B735673C7408 },
+        { 0x2F00DFA9176BB6A2, 0xDEA07BB3654944F8, 0x758F43648738C52A, 0x5C95F002937DF7D8, 0xA53748A01D8FFEFF, 0x644A57CDD1EDC761, 0x16DFC789757BCAA1, 0xD5EA3A20AE91834E },
+        { 0x68C8EED6EB12D346, 0xA3D74BD373A25C7A, 0x6884E2AD9A4F4848, 0xF653DEC87F2CD256, 0x5F7E3F3CD39E156D, 0xE394E48AE7EF7E0A, 0x1E62DD80AF90A77C, 0x31490B334D2BDE9E },
+        { 0x20A1ADDFDBED2904, 0x17097A64C98B5B04, 0xFE0CE9BB74B772CC, 0xF260356BA9586A43, 0x7060A313D946E8DD, 0x25AEC45665B31B8B, 0x991FC091DF29CB7A, 0xC46F282B3B533945 },
+        { 0x29EAB3335A8F09C9, 0xD0E72EE15CAC32FA, 0x6409A50015B1C037, 0x2FA98B2CEDF7823C, 0x366F499BED7E4334, 0x78D2F5B5C3320BD5, 0xFEA3A49382361C57, 0xBABFDDB0438EEF9D },
+        { 0x8E2290A34A8FF0EA, 0x34BB1DC0E2A215F1, 0x34FC73B14E4D9F9F, 0x9CD7B88C583859FA, 0xF23C9A35AEC93C22, 0x7F6D327681924BC0, 0x609CC256E6FE7FD6, 0xCEBB603735267890 },
+        { 0xC07D8BF2D7A90DDD, 0xD87F67E74387935A, 0x8941935534FC129E, 0x6727297DBB4165EB, 0x248E570BD652CB9B, 0x0C6FAE969A35CC42, 0x642A2A8EA93A9E72, 0xE06D64801E047C17 },
+        { 0xDD2B4D4BA06D57B3, 0xA6070593B278D3D6, 0x5D3FD03107A5A3F2, 0x488B510BAB4B7D35, 0x8162C8F53531A1E7, 0xCE9E5ED3D0342D04, 0x7D43C7AB121BDC7B, 0x0604EBDF869F6A03 },
+        { 0x2B026A9B6697BF46, 0x5ECE3D1D11B7EF1D, 0xC9E07CA73B220A61, 0x1923578B352265BB, 0xE4CF319C84BDDFF2, 0xAFBFA8461F25B78D, 0x2F5732250561E29B, 0xFEEB04EDCF695575 },
+        { 0xEA0388A2711455E8, 0x7CE5B8BEB4F104CF, 0x8BC0FA72B674F584, 0x84F0988868A4CE1C, 0x1C689F4DC7E4AC63, 0xFE6727BAD68DC00F, 0xF463586A9D26E46E, 0x78FB907400D54E6F },
+    },
+    {   // 2^50·G
+        { 0xC75F6D924F570B6A, 0x6CD1F24D53508AE9, 0x4B970293ECB82A51, 0xB5D008691E149E00, 0x8EE79DB918181531, 0x32736F1148A9DD71, 0x2978C080CC482D2B, 0xE8802FC47A504644 },
+        { 0x93110A39E2311358, 0xD225FF1E7AD96881, 0xA5C6172432D398D6, 0xCC19E6943E762E0F, 0xD8A506C8C9C8C076, 0x48EF0A60F27AD126, 0xCC555CCCB80B8CFF, 0x385165DF597F9FA2 },
+        { 0x03C9AC5BB579B8F2, 0x7895638B272259D3, 0x7FC98EE6005C542B, 0x4AE8C4714C58C9BB, 0xCE7CF4094653226D, 0x39E95DBB5A00F1FA, 0x1EE2464C5FE5536B, 0xD3F81973DCAFECE1 },
+        { 0x36641EEDDAF11C9B, 0xC1FDAE299545207F, 0x9A30BED713A90EC7, 0x8285D1B852B1CE53, 0x5855E062AFAB5372, 0xC00664841530731D, 0xA377E5B2E31C0C81, 0x51627C9B2C9C24FC },
+        { 0xEDC208F4979A87AD, 0xC9B0839A79A68CDC, 0x6E63CDADA241DFA8, 0x1B981FC6A7F7E88B, 0x175BD19230EB6554, 0x920A7F6E350B8814, 0x159505FFFAF65B38, 0x8AF774B97B3181EB },
+        { 0x595A581A8A4A0E6F, 0x826389BAE9C4F7AE, 0xD722754411CCA53F, 0x204F7613DE14B56E, 0x9144E9329087C5B8, 0x7AE84F41AD680918, 0xAE1A159AADB31D10, 0xD1D015F2EC84DAE9 },
+        { 0x97F704BF2D5B5284, 0x816E07FE582FCC98, 0xF0C9842726C1770E, 0x6ED7BDFBA20E46F8, 0xD550F54C300CC109, 0xAFA09A889FB2FC63, 0x7E7A623EDD3B7138, 0x404ADAEB5CDCC21F },
+        { 0x182FD38FAF3F7668, 0x8A82B82AA4DD5908, 0x0F8FD6771CC9F529, 0x13082C51CF2A9777, 0x0280A97A4B62EACD, 0x161A8683478421CE, 0xFA3C321DCD4E9E8F, 0xDED11A646D98E267 },
+        { 0x4FA365C9AF6CB475, 0xF5C346C5AC3DBA0F, 0xB7A3CB3B99144C32, 0x8DE54CB7E74DD513, 0xDDB1AA169B3C4690, 0xDF789AB57E2FD368, 0x085B8088EBC8BEDF, 0x3018C1B373D64E9C },
+        { 0xE615F92B5FD3EAAF, 0x2CB8B7B97FA5DF0F, 0x3CD44DCF1CD642E8, 0xA2BC70CC3BE24E2D, 0x1D506E9EF8BFB016, 0x562BFB0506200284, 0x0320D6189D372EC4, 0xC084244470D15127 },
+        { 0x87B0292EF4F26699, 0x5D621EC7F145D82D, 0xC4D44572389C1F33, 0x695AECEE4E0477FA, 0x2699FEBEB996BC05, 0xF5FC994B0A8C533F, 0x48D3C074F3A880B1, 0x01EACE10ADAE1893 },
+        { 0x4936FD6B911491FC, 0x7AA867DCF3F4DDC1, 0x465189F73171DAC4, 0x601DCC3AF287EB1B, 0x2420EA0FDC9D074C, 0x8DCFDE5A530EDBF4, 0x06F43F025D2E6A39, 0x60733C1A72D5B55F },
+        { 0xC012C11D372707E6, 0xA3E735527BFA82E2, 0x8E0F248474D44FE0, 0x21B3C85DF9F222C1, 0xAA8135CA99EC4FE6, 0xC4AB4A98A9C18770, 0x6FDB152D7F3DA26B, 0x644E478A690C6652 },
+        { 0x012FA7D4A4553DAF, 0x9A8E819A42653E9E, 0xAEC6852564F7C1A5, 0x14910E6DDE51AD8A, 0x963B1397F8771718, 0x34A9C7D91283E0C1, 0x68FBF6D9B7107AEB, 0xC9FA3124D0942C48 },
+        { 0x109CACE70C8ED815, 0x00F4EB2C721AADA7, 0x7F0A28EF6D1B26B3, 0xC2655EE52F5B677D, 0x3E620E3AAB7256E3, 0xB0FB61983C4128EB, 0x7B90539B606256A5, 0xD6B924598BE38C09 },
+        { 0xBB4771A4C205A0FD, 0x7D8EF6034410C09B, 0x737838E8C97611D2, 0x0BDD9FCBAB2E19BD, 0xC6353E3FECB963BF, 0x20433D5DEF7EBD2B, 0x13056025D6A024E3, 0xE327A1F6BCE4443E },
+    },
+    {   // 2^55·G
+        { 0xD53DA44BB9220B59, 0x59BF6FDDE0715921, 0xF73710E0FF3946EC, 0x6AE04ED37C52F71B, 0x4A05073FA1FAF0B9, 0xC3D9DF90A36BF1E1, 0xEE87E93687107BA1, 0xFC4BD84785DC4393 },
+        { 0xE9131640949F2A0B, 0x888AD5CE54B9EE94, 0xACA2DEE5CDA1C57D, 0x6981FF5B0F834D6B, 0xD3F698417D433432, 0x7D970767F5062B95, 0x08ED0C4ACDC8629F, 0xFAE1D9C0AFDE2292 },
+        { 0xC74D0EA6F52D1919, 0x6853A8E9A1040D4C, 0x56C347CEF09591D6, 0xDFAB173DA08A2F04, 0xB7318C997DBACC75, 0x31A7BAA7EB749080, 0xB7E4212CB50A3197, 0xACD5CE7C9C7E9403 },
+        { 0x9B5777FD27CA787B, 0x82C540B43DB71708, 0xB8766806B8BE4744, 0x1868DE6956D82DA4, 0x6541E157544601F5, 0xD8408495808A3D65, 0xC7E4A9F969C9A0C8, 0x16EF4A61CDD6A93A },
+        { 0x552FE2FDD94B5C42, 0x30BF6FBD28DFF06C, 0xC1D17C3B2B70603A, 0xC0C71D2BF3DBAEAC, 0x4BEFFA5BEC4BCD28, 0xAED77F1DB3662360, 0xF27B861276CCC2AF, 0x60A4C8982BF9B7C3 },
+        { 0x72796EA1A93BA496, 0xB38A2F2C1F0926D8, 0x9038B3D5262D0DA5, 0x8AA07F3F63FDBE4D, 0x044BCEDCEA74D4B2, 0xB93EFE12EB1C6BCA, 0xA7CB4629329F10F8, 0x501AF699FE145346 },
+        { 0x3AB321E03E77658D, 0x9C020737DADEDBD4, 0x9E0E3EEA4D06B7C8, 0xD0B01458E32CBB03, 0x7551CF160BFDF1B9, 0xD0DE47CCF8A5FEBC, 0x91CF603816395EB3, 0xF70539133749F03C },
+        { 0x0798C5A376E79B01, 0xC2F747DBD5E50822, 0xC28BD19628DBB4E5, 0x76E24560D858BA0D, 0x2BE8E4972CF19EFC, 0x9412E23C011B0C63, 0x89A8A82F754CC66B, 0x6F34174BD34B914D },
+        { 0xB01ADEFC0F5A9C3B, 0x51397C2160EA829F, 0x482398256B41D763, 0x46355D95338E8225, 0xB6A05C33D9C0F14B, 0xA39A800DD04FD289, 0x5DA7691CD7A45789, 0x3C603E19A410273D },
+        { 0xEDBFB8569395AB67, 0x30ADF4FB77681F48, 0xD9596DCA63C21AB8, 0x22CEB793EE50DB35, 0x945DD53D4EC9ABEF, 0x97632E77BEA9A7F2, 0x31A41FA1B68C526A, 0xE485DDE66AF2CBFC },
+        { 0x2A42095627BEE354, 0xAD7401C69308376D, 0x5ED204B9C2392C73, 0xC6A02424F597956E, 0xBBDF24B4BCD8B6A7, 0x270ABBE9DA1934DA, 0xC59A46ED76C8389F, 0x8038197002CD156A },
+        { 0x9053B80D6A135309, 0xC782854A064724CC, 0x563D75EEB3BF5DA8, 0x7FC08B6F09C31693, 0x3D71D2166BFBC204, 0xAD72A4EE8D713DCD, 0xB1C8C56B6B1A20B8, 0x2F75CFAC50B9AC5F },
+        { 0x6D712CF2C41A7F9D, 0x26C0F00B7B5A3FFD, 0x3048C0FA4D2FA8AE, 0xBF1C846F05CAF397, 0x1B41A42573904C77, 0x7036017CADAF8EEA, 0xC63BC7C24A840CAC, 0x6FD68FE80B9A23D7 },
+        { 0x94C8C2DD21E3F475, 0xF49FB1AD252D6568, 0xF837036732A369B7, 0xF595473A5CDF760A, 0xBA7BEAF27C24B78B, 0x189FC3585B6C1C4C, 0x5C43CC21E01F77B2, 0x053DF421945EE739 },
+        { 0x294E7CBA03E808CA, 0x7A93A8CEE3B1DA1B, 0x5BA6BF1E5DDEE13F, 0xBD2663C7239686A6, 0x1AB329985BAD1014, 0x0699E6FA2D5B0B5F, 0x00498E60B79A451C, 0x1EEB80358CEBEC04 },
+        { 0xAF2D94FCD6C206D1, 0xCE5DA3485A2BBD5C, 0xA6890A1825118FA9, 0x3A757FC2311BB345, 0xA89C70562A257E82, 0x699D03C28563379A, 0x0985E27F2DDA953F, 0xEED63E1C6ACB4240 },
+    },
+    {   // 2^60·G
+        { 0x12FEE11C1F95D502, 0x51CCE12A68207A11, 0xBFAE824478469BDC, 0x08F49B31507F9715, 0x0A2144AEE2DA7430, 0x2F6DBB99029B5AA1, 0xF0AB1AF5B1A12FB7, 0x82EF423890FEFCB6 },
+        { 0x62F586805A6705E8, 0x82FC5C6DCAFC6CED, 0x808ED4B119CCD701, 0xEDD86F83CC44CCD6, 0xB598993FE5F73F0D, 0xA25DD22507C4CF32, 0xE7A3DC66EEAECE14, 0x60CEAFE8F0ED4176 },
+        { 0xDE7EAB69260D9382, 0x1C7A132DA2A310C4, 0x0BDD1252E68E07ED, 0xCDDCD4E9818A608D, 0xD74A85B2E44BACBE, 0xBB05CAFBB9407260, 0x7FF6EB74A15FAD81, 0x43C5BE114B667ABD },
+        { 0x09AB6BA404784ED3, 0xE0E81379427E0FAC, 0xB1ADBBDFCD29A6A2, 0x6B523991D5D3FD55, 0x849F890E01046F8B, 0xB76B64B6E4AABD8F, 0x3FBA0DF733410726, 0x93B30912B88F2DF7 },
+        { 0xDBD13C2BFBBC98E5, 0x7121042165396941, 0xCA010DE781BCA904, 0x8D1C40E9E07733BE, 0x3E474EAF98E189EE, 0xAF8AAA88BC62A718, 0x5DEB4E24DBEB7C4E, 0xDFE4B13C3D7DB078 },
+        { 0x31D5158EB2D1E902, 0xD5B8AEAFD4AC2335, 0x8836D90ACD1FEDD5, 0x771FF10DE417A6CF, 0x781B35BCDD77481C, 0x0E156F8B58D26E28, 0x2A73FBC632BD3CBF, 0x945562A4D6E61FB0 },
+        { 0x2D45BAA19F3D2BD7, 0x32825E286E55E33B, 0xE6C72DFBC44A9E39, 0xBD8E3D49F21884EA, 0x673106CFCB28A738, 0xCDF54E3966B95922, 0x432D0A8CB7850483, 0x373BC56D47437503 },
+        { 0x68256A4C071EB8BE, 0x617B29118CBE5B09, 0x8BB685A12BF7EF6C, 0x32760191DB9560F5, 0x42B8EE06813CC077, 0x1F75BF6A2A9C9AB9, 0xFB9D9261BE593BE7, 0x79E64FDA6930C3C0 },
+        { 0x66D95701ACD2DD95, 0x71752368E1ABD308, 0x0BB8DF36815B89BA, 0x4FD0576DD61369F6, 0xCFA8ACF5EE5F6C72, 0xC9731CE02B1BAD35, 0x02BBB30A00ADB0B6, 0x0579C3E0921E0F47 },
+        { 0x8CC79D8E7BE4B2B6, 0x2193EDBDAAF29C34, 0xF05A2ADA83571438, 0x8DC58D8161DCB9B6, 0x2F21DF9978024A38, 0x9E56CFEA3FDFCBDE, 0x6F14E01A24C176EA, 0xE275878CEB489BD2 },
+        { 0xCE7A410C4069DBAD, 0xA42AB874425D3DEA, 0x423A22FC54F389CC, 0xD9C039562627E91A, 0x1031EB9618207F17, 0x1D23DEFA16E780E9, 0x5C171071B9595AEC, 0x0E102F386B192EF6 },
+        { 0x2E1191579520055F, 0x9E390AE4F0845A81, 0x5D900A8F9A6C4AA6, 0x232AD9F547CF5F02, 0xE76BCFDB6BBD3A9A, 0xBF438C514D9EE8D1, 0x43FAB20EF0E456C3, 0xDA51F7824995CA58 },
+        { 0xFB48A7E5A3F46AE4, 0x002CE15EE83E5E4D, 0xB8E0E5DE85D64A56, 0xB50ABC9F6BF7247A, 0xE46EAF857CC84152, 0xC6F01D79214E1602, 0xB68452875885472C, 0x0A5CDC85816A1D00 },
+        { 0xC8D2A42BBC2508ED, 0xD09213B9BE2E7E91, 0xA1C254961262B6B6, 0xE508EB1AFC3AA15A, 0x1CAFDF2377424254, 0xE537B97C0CF3348F, 0xE111DA751F1E67CD, 0xA7075FD09743D386 },
+        { 0x7C476D6D82AB957F, 0xA40544CE464BEAEF, 0xDEC58816D5ACEB12, 0xDEE116E8A922E72C, 0x6AF9D0B89C881058, 0x28A5469BC8AD4E5A, 0x0C14E46AFF0D33AE, 0xDF9806A5470ED97E },
+        { 0x41D2731EADB68CF9, 0xBB49780FC8D68924, 0x81CC4A6F06F653C5, 0xF96EAC6E697F17C6, 0xF9C5AF13F6EFA136, 0x94D46CFFCE0E9CFD, 0x83B9D838473E6B0E, 0x6196621A06C841F1 },
+    },
+    {   // 2^65·G
+        { 0x152879E935811666, 0xAECD900D995F5AC8, 0x55534F24546A77E4, 0x867897622C279791, 0xBD0E28C622E2D858, 0x1FE1C1CAB00E501D, 0x5EBD909551CD9476, 0x2CD775EBBC39A143 },
+        { 0x15254C0A6C186B71, 0x472D1F63EB8C3A03, 0x56E1743BE626C3E7, 0x2F8BC30CF926A3E4, 0x4A18365A3000DC38, 0x8BCDC5CEF13FE024, 0x4051913BADC2C2CB, 0xD4F54C934AF1047F },
+        { 0x2F6524B7EDB163D1, 0x6098F7058032ADF5, 0x359F4D13D9D45A65, 0x23C7E15AADABF5D0, 0x50AF4A9B249B4B4B, 0x61040AC6C40117D8, 0xA89490C4EAD00279, 0xB0E4FB0C77688906 },
+        { 0xA02443C6F48EB833, 0x6733C4BDD1805A32, 0x4637B560FDA5A526, 0xFF900F95171ABDD9, 0xE3109D1082D34CDE, 0xFAA3C78AAEB009FD, 0x92A88E94F87EDD67, 0x963CDEB022D3A10C },
+        { 0xAFE7F1917A2B349D, 0x3B47767A3A59CD0D, 0xCE1C84D0D1DFF396, 0x0B947FDE7BBCF13B, 0x6C9910E54D82BC4D, 0x6B03CEB94B14B6D9, 0x8B8057E881A0B050, 0x4C70742606A8B4BC },
+        { 0xA87E46E6B00A6163, 0x1155B263B6615E5B, 0xBD01811D777CB68C, 0x664521C46D491D6B, 0x4CD3DD031A927CAD, 0xC0D4B0C30B476FCE, 0x4444153632D893E6, 0xA9E72BF573AFE5A3 },
+        { 0x88260134D443EDE4, 0x26EF5D26818A60DA, 0x7740340F76528012, 0x1594A4CEC116FBC7, 0x49461554665BE9A1, 0x82E9E49750569696, 0x92583728A3F943B6, 0xFD4E3526B222A136 },
+        { 0xEAF1373B4526F49D, 0x3D87E8C73108CA61, 0xD585E1960E074797, 0x3E94551D7FA5DA45, 0x69D95896130464F8, 0xD331598DA49D4785, 0x05D88753ABEE76B0, 0xF2F3E8CF85A165CA },
+        { 0x953B255B576C3AC4, 0x5389F935280F8070, 0xC09B873C7C3D36B9, 0x3D8A8F633FF746A5, 0x03CEED72145FC246, 0x86394B6581FA0C21, 0xCCB1A1BEDABEC619, 0xF04A08E84B8D2993 },
+        { 0x0BA754AC1FE3CF8A, 0xB4FC7AC7F2DAB617, 0x38F86FCEDEE681DF, 0xAEFEF1E8F04152D6, 0x251DB0D004E0E2D1, 0xC19F5F9E1CDDFE4A, 0xA204C7EE1DB9A0E7, 0xB093B6B4EE18F7FB },
+        { 0x2FFFCD6A1AD67448, 0x1218407966041197, 0x89D7D5AF7ED22B8B, 0x7E706B3EF8508CD8, 0x055896D0F0DEFF9E, 0x3126CDB92918C859, 0x1E38FCB1476A5D9C, 0xD1E3A0C92D4A6861 },
+        { 0x9EF2961799F45193, 0x0CAC99673D019541, 0x66EC5B58D4D13DD4, 0xDC4D253BC0C86357, 0x902AA34BF03DA786, 0x8D4A5BDB79E91154, 0x22289FCD13FB4ED4, 0xB54B84BE62E31ED6 },
+        { 0x5E287FE09BED2B2A, 0x420A2A8EDA43C034, 0xC960D172F92B0682, 0xC544BD340165599B, 0x436B6E509E76A3C7, 0xC0B34F2A44427E26, 0x9A6B7018DE666968, 0x97A3C534CCCC75F9 },
+        { 0xED248C09FC41DD3D, 0x6590A57965C4D144, 0x8BC04B979C4BEE3E, 0xF59E2E4DEE7AC97B, 0xE6779AA7C9BBD853, 0xF933266EBBACA6B9, 0x66F41467BCB9EBAA, 0xE3272F54BE5DE02B },
+        { 0x455D6DF5FA78EF6C, 0xE7CB917A55DBDF45, 0x6507EF8FDF02FE7B, 0x6E2A02ADF8C946E9, 0x805F31A19E4DC49B, 0x04B6B85EA8C558C5, 0xE31E6B1A9421D638, 0xB1F965F23A5F7D0B },
+        { 0x07A8E959F20461FA, 0x945565AA30B11D13, 0x46B0C3CA62D7FF7B, 0x291243400630F896, 0xCF83CBC56BF0B214, 0x3A760AAD877B9B06, 0xDB27BE97A848B363, 0x9585FE12C144A86E },
+    },
+    {   // 2^70·G
+        { 0x12E08A5D06918211, 0xA02D6FEBD9F2CF00, 0x3F27B7156337C216, 0x29367EFC31AC0DE1, 0x52FEF397AC540EEF, 0x008DD5184B8A16CE, 0x705D57FA7A7FAFF2, 0xE0848700BDBA073B },
+        { 0xBDF23A89B7F72DB1, 0x845F28F70E3DE092, 0xF82915656ECD3DDA, 0x2CB7C062E6B27321, 0xF9C9558BDFF701EC, 0x42457AC2E3E7E60B, 0xA63676263DBB8CA6, 0xE01A69D91DCDD1F8 },
+        { 0xBBD872232F377CAF, 0x9B52C5B8F185E675, 0xBACADD3E03F37133, 0xC9279D6B0D550DF3, 0x9EA7766343D1081B, 0x9CDB7EABB850B6D8, 0x57FF37F13BE87C10, 0xAFD46DB2C177C99C },
+        { 0xAA93E0DC3A4A8136, 0x56CEDBBCC946D7B1, 0x868718DDF274B63B, 0xE174215AA0A5BCFD, 0x6813381D1BEF46C9, 0x560620D76140F7F2, 0x754738FA192713ED, 0x6A7CF5CB24A68172 },
+        { 0xB1D863BBB6F376DD, 0x41062F1B940C1666, 0x679B93A9AA3048E4, 0x34775B2B5CFCC3E3, 0xABF7F68D4F6ED8E5, 0xE8AD8796BA19081D, 0xED71769A61D01CC7, 0xB3B211F4BA409202 },
+        { 0xC1AD7A95F3556928, 0xA15B066221E79328, 0x5231676BBE5A58C5, 0xD241B94BAE5F8FED, 0xBCF15AF82BEEEE4A, 0x786D595EB8986577, 0x52F07870B7253DCD, 0xE3B9E97E21C9347F },
+        { 0xC47F0338666302BE, 0xD184F5DB92792342, 0x2E5908904E39E84C, 0xE243FBED35EA065F, 0xB81ECB45F03812AB, 0x24D4936A85BCE032, 0x8137000723B5C74D, 0x21F37E1969DDB5FB },
+        { 0x1D5F5E253051FF0C, 0x80B9517A7BE5DC13, 0x7D6076A639132116, 0x0E4AF94C7487B637, 0xDD2FF11FF1A5B362, 0x5829A78151D7F920, 0x93CC67CAB1DF84E0, 0x8742396D15D42FFC },
+        { 0xECA930B2818F4BAA, 0x8C9E81A46D365C16, 0x5B3B8D0441E9B8CC, 0x5A010CD2AE089EEF, 0xB72A2B68BBB0D11A, 0x3FB10C91DA95A49C, 0xF3421A0087BACCA0, 0x78BA218467575E8B },
+        { 0x241F5D6955E2AC3A, 0x1C918F01C235E3D3, 0x7E350FBF9E903192, 0x3E18E8326C81B1C2, 0xFE8B1A4CA7D09946, 0x91A0BFB03FF34435, 0x86F62AC205965EFB, 0xBD6FCEB925044DB2 },
+        { 0x8184549DA3313613, 0x989B9EFCF9757340, 0xFD2C9402CF7CF325, 0x9C093736E3605E25, 0x97CABA0E0B4A28E6, 0xE5DA225C5C94378D, 0xEED90D1D45BF52B1, 0x334CE19F282FDFAA },
+        { 0xBA5BBB503330CD7A, 0xF39619A408BD38E0, 0xFDBAA5D1A232A970, 0xD9B91B7EDF8FEB3A, 0x071F958FC7AF7290, 0x3063879C7795C2F3, 0x8322736F9C222A3C, 0x91A6F7AA570F75D7 },
+        { 0x8DC57198AD01DD48, 0xC55C4D333D66AE13, 0xEC8ED3CDB2CF9136, 0xB92911D28C30B66E, 0x8997C4E577C4ED51, 0x411F5FC470A271B6, 0xE4E1CB8251C5A0DD, 0xEA65A4A7B6901AB7 },
+        { 0xF44F81F3C6E85786, 0x0E75AC002E5A2D24, 0xA0165911582E3FD8, 0x84B0C5528008C140, 0x9B273049FFD8C8D0, 0xDB2F690999F6B0BE, 0x566914ED1656F2BE, 0x44B47D96E4E27CE2 },
+        { 0x8688DB4DEF5F5605, 0x93D0FF9374EE4438, 0xC508EB86161DD155, 0x04FF84D81AB54F61, 0x2859B6FE3DE492AA, 0xCC49AF7302C488D7, 0x3D0794A1BDC3F702, 0x8C28DBB0A4527311 },
+        { 0xED5F7B163E6EF1E2, 0x1804571217C290A9, 0xE53B7D72B0A3173D, 0xD2AC020CD09620AE, 0x43BEDEEF793B20F2, 0x9D3B6066CEF4B7FE, 0xA66980C0F80328C9, 0x1B8E646C5BAC1D57 },
+    },
+    {   // 2^75·G
+        { 0x23CDDBF845A2813F, 0xE6D5B06F5A65211F, 0x4C73B3FC538E06ED, 0xC3373690B62A231C, 0x04110E90D454550C, 0xC0CD5BB5479E4032, 0xA5D05B8C0EBD2DB1, 0x956FD51A130CF00F },
+        { 0xAA2953A9A0DF767F, 0x1FC7D20AB046CD55, 0x5CE12921DA648770, 0xBEAED8E67D1B60FC, 0x8301D88886D910E7, 0xA56AD65789B2F0DE, 0xDD0A56762FA93464, 0xB5BEEAC158E8C6F9 },
+        { 0x145838FE97158F18, 0x0B476445D7C99FC7, 0x8AAE6516078C6B3F, 0x49D1202E75A47892, 0x19167ECBD5675BC0, 0x28C6D8BF7BE63064, 0x07C0876DD0E5D4C2, 0x9901D9BB0475FFA1 },
+        { 0x3DFFC0512A3B734F, 0xDCCDF959C9B09EDB, 0xD1C6DC1C01A0E87C, 0x610DAE53161E0812, 0x4D2D0EDC18DFFD1E, 0x70C1094C6D2668BE, 0x78228C7595E3408E, 0x830690CB001ECE34 },
+        { 0x71520CAD1DB65117, 0xBF9F981B47935256, 0xAABD3917DD7192C2, 0x2FC98F8310B3B1E6, 0x763ECF79485A7E7A, 0x2E9184D425436183, 0x798B15B456B24F10, 0xC50F0F553F211A38 },
+        { 0x74DFDB82146C69DA, 0x6751B673D3225D6F, 0xF2AC98801B51D515, 0x01BF64B441AD3CD9, 0x6F1A90518BE70BDD, 0x81937C5C9FBC78E4, 0x6B6B66A9C322C6D2, 0x5923D45D78F2B1F6 },
+        { 0x4A911D95A831B1CC, 0x1DCF408E1D04631D, 0x9AE718519067CF9C, 0x866DF4E1F5F2CCE7, 0xCEA33A3EB7F4D7BF, 0xD38EF1FEB64C1C46, 0x4F049175BF92B6B0, 0xCE102B429EBFD959 },
+        { 0x91E97EFAEF4EE77E, 0x339E3969D4DF25B3, 0x6541B68F14E67AAC, 0xAA576612D21C6235, 0x909602D9A39A63C5, 0x3970F6C236DF54F6, 0x7ED39295D15C858A, 0x8A36BFA9541078D4 },
+        { 0xF4CF334888EBED3A, 0x3AA42FC704339810, 0x3F9B1D479E7EA337, 0x8D0DD1CA03868CF9, 0xAF641E168602D056, 0xBF972C5A2D378AAD, 0x8C0A1664714FF859, 0x74F370E0A6185F27 },
+        { 0x97203BC1FED798A2, 0x2B71EA290942C128, 0x4002BB079034F2CE, 0x4829B3D8CE0091FD, 0x8FFA064BFFF0BB72, 0x80DD54EF9C1CBB92, 0xEF934C45B23CD0DB, 0xB3065F98FC7AA1A6 },
+        { 0x1EFA1DEF28C60D60, 0x5CACE05E0D74175C, 0x1FF7CF004A23D3A3, 0x8B0E6346E885CF86, 0x73C3841830B9D951, 0xA621ED616E0452E6, 0x96CFC73B8E22787F, 0xDB95BBB26003785C },
+        { 0xFB4C1D8D33B0F075, 0x3BAE4461C95EB9D7, 0x37E0748642F92D8B, 0xDDA9442A59743BA9, 0xA97A06D3E5F19267, 0xED6347F1FB581AD9, 0x0048E7EEBC224CB5, 0xFEC026E085A7E955 },
+        { 0xFD991A2A9ECBBA5B, 0x87BD5CB9CB50D5D8, 0x988359E2F322C826, 0xF4642B3CDD1D3156, 0xC95709A538AFEEFA, 0x33AA117EE04B21B3, 0x895A4AA2E1072AD3, 0x7163CA6F2B0661A5 },
+        { 0x30882BFEB38EA335, 0x01F1CF64FC4E2772, 0xD96A0AB184FD53B6, 0x7A2A8BB8BADAA8AF, 0x9C5E3B15E95F9A1B, 0x2D75BFA54FD95422, 0x4A08BA8CB2B436C2, 0xC628A7496BD18BEB },
+        { 0x72AF8CEF7600B8D6, 0xC6670E23CAC76768, 0x6AFBBC70A9BA9D2C, 0xF2C29AB4ECA28CE2, 0xFC7843FACF509DD4, 0x92BD2B64DD601CCD, 0x88954C3207B70848, 0x2CAF5438614466B0 },
+        { 0x9FDED2098580EF6B, 0xDF8BB1924B849F81, 0x0488BDB1DD6CA3DA, 0x6B200FCD1CE32BEF, 0x374AC3B50212B03A, 0xC12DE6E38364499D, 0xC16619CBD1088CBB, 0xB0CB13FD873BC392 },
+    },
+    {   // 2^80·G
+        { 0x92EC9FCBC11D186F, 0xA82ACF836455F395, 0x141A0D74BE00AF09, 0xEE6DFFB61A7255A2, 0x6EA0FFD5C784268C, 0x0D75990FB8F5DD63, 0xEBA0E4EEC5F89AA0, 0x98D85A17A1E82EA9 },
+        { 0x64E77DD8E7AB72A4, 0xCEEF1B141BD3FD7B, 0x163F1072ECF92040, 0x28C1ECF47E3A913E, 0xB47F7540DF359169, 0xD95DFC929B5ADE69, 0x5CE277D1EFC82867, 0xA6719A66FF85AA87 },
+        { 0x45B1478F270FD036, 0xC9C5C5AE101609CB, 0xDAB6CE72E2A1463B, 0x1D8A53F480EAFA70, 0x7698237781AC5CA7, 0xE2D4F1E4A7369EC5, 0xD60D5042966647B3, 0x75D663CFB5BB7EDF },
+        { 0xA8891A981B8FBE88, 0xB5A39FC41FACF310, 0xA0E72226A9FB2D53, 0x09F4796D6901F049, 0xEB700AF12F8AAA66, 0x56A53ACA18B432B0, 0xA95C6EBF55DF3E2E, 0x48B8746ECBBE7501 },
+        { 0xEED971B575113BCF, 0x17E7C5C733C60757, 0x0141018C2C9DFB2D, 0x78AA32652038BD05, 0x1B42E42F4E1A4BA1, 0xBCD8A43FC0833A19, 0x1721502546E543D3, 0xB04C540B0311BA20 },
+        { 0xA41BD5577F51A4B3, 0xC9EB4BD6B1406F90, 0x6DA11442C29C3481, 0x998E6E2DE585D096, 0x01AFC0BEC354FC46, 0x6BAE53FD46C17BCF, 0x45BDAD66264E16C4, 0x62B77DA2D2056C03 },
+        { 0x539B4E4D13A263EB, 0xDE2D8B519280BBA9, 0xDAB673B83F34A5A1, 0x39327E231361417B, 0x965E1C0B8CB2890F, 0x95E9780D421EB9F6, 0x5E401C98A0782EE2, 0x7459E3E2685539A6 },
+        { 0x373C6FE05CFA8D70, 0x57E018CAD4BF2300, 0x02A3FD645F150846, 0xA39BE7591F58E298, 0x7412260F04F5BBCA, 0x92592A3C645DB889, 0xB335FE62E2F13B40, 0x97C04761E5A16E08 },
+        { 0xB86722E6F6972142, 0x1A62CA6E4CD6618D, 0xF2EA685FFD442C2C, 0x1D1C38FE0BE2CA64, 0xF21E1E76FCE80610, 0xC9E759BFE4EB4214, 0x86BFB2BD4920C5AC, 0x4CDE595B9EBFA223 },
+        { 0x4FE7E0A4E4090405, 0x53D6BD169822CEF9, 0xD0AF15B873685F15, 0x74A33DF666ADA48B, 0x5406AD022B38F8A8, 0x669CBCD879909CF8, 0x7E41CF5A10EFD51D, 0x02DAD13EB2FD4D22 },
+        { 0xB92FB5594333ADC5, 0xE5F20B4E862ECC8A, 0x1A133AAFC60DCA50, 0xB2B8C814FFE03393, 0x57FD275C316525E7, 0xE5811F95D22FA6CA, 0x87F2E97594E2167F, 0x30E3873A4398AEAB },
+        { 0x8EEA573F2A73463F, 0xCE2356CEFB445F98, 0x12549EF755537867, 0x534FEC11267DD91B, 0xDA95B1B7F2BD83FB, 0x66439E3ACF812DFD, 0x5ABE4C448BF48A55, 0x32DC56F5A3DC1830 },
+        { 0xD51928FE8ADF6828, 0x55FDD0707E1D642F, 0xAA1DCC49FF8D2AE6, 0x076D85C09CB1DF2D, 0x74CF1F5572108216, 0x526CA26BE7DFCE18, 0xDD1D00B37FCF95DE, 0x31DF0F3094D89AD6 },
+        { 0x8AD1A9DB48550927, 0x06E3D3FB8213FCF1, 0xB4E71790CBD80A55, 0x8D6F782FD4CBD51E, 0x8E6419FF2FDED883, 0x3FC0F826B22602B1, 0x5DB983F83593E459, 0x2108CB2479A38498 },
+        { 0xA30589E84E86912C, 0xB2CA8FACD2538CC7, 0x0134BBC09474D1B2, 0xA61D5EE38F0C9CBD, 0x62926C33A90F3A63, 0xC15A4DAF7A1A3804, 0x322C3540B11102E7, 0x5FA0CE4B03F6B9C0 },
+        { 0x9C70DBB9D969AE17, 0x71FDAD4D9CA95C64, 0x975118228722E8AD, 0xCB148776982701BE, 0x6D5FFC93C6AC6C25, 0x97EC4BFCB3E29FD0, 0x16A6248BE081447A, 0xCA564EFDA3921EDD },
+    },
+    {   // 2^85·G
+        { 0x48BB2BC36F19ABCA, 0xA3D46A50BEC6147C, 0xCAFC107410D5D8E3, 0x541346C77632EFAD, 0x8DC5CFEE5D66948E, 0x41B69047B76466DD, 0x7B098A7BB5F9A93E, 0xCB365D004BD1C525 },
+        { 0x84C9FB0B13F759E1, 0x08E551E06BFAD8A9, 0x20B613BF659F7C37, 0xF881BEC7B4EBB44E, 0xFD30BA9F1741D72A, 0x21B7E350A9C25F0B, 0xC8254E1EF6038991, 0x286B669065B670EC },
+        { 0x7CBFBEFBB14F1593, 0x2D557952596605FB, 0x7A9DD18B7FD5C74C, 0xFC823FB54000F963, 0x378B1A68DCDA7786, 0xC97EA36CE340A4DF, 0x13976DB93457A7F5, 0x02DBE618E9C24F93 },
+        { 0xD312F0F39357D868, 0xDE11041766EB6F9E, 0xE3D102B1035ADBD5, 0xE3128EDED0BA04F1, 0x951000F1C9FBA7C9, 0x39C6ED7EDCFC35ED, 0xAEA312A98376A855, 0x7A6AA72A5103A212 },
+        { 0x933C1F4EE456BC36, 0x4B44E6E00C71B32D, 0x289A4A0143B46910, 0x4DE64EDE775F564B, 0x8BFBB165AE877D5A, 0x216878BEC4EFE2D9, 0xA6D78D58A623594B, 0x6DB8F44C2692245C },
+        { 0x85DA18E090FC21DE, 0xB8EDE8C79AAA4595, 0x5F44B8B825E65CD7, 0xB6159C49E26CC7F9, 0x367DF8CC22B32868, 0xA5F8E8591487A581, 0x79717BD8CF409949, 0xDD336AEC294AF3E5 },
+        { 0x729A36489175C4A9, 0x60FB59460806370A, 0xA88A7B97C451E617, 0x3C63BC942F422B18, 0x697B8AC7263F0965, 0xD6C1E9FC779AABF8, 0x3D5A4D1290354CEE, 0x319C65962A7543CC },
+        { 0x1585DC0C31D82EAD, 0xAA25F89F154B25A0, 0x948AF9408C9815A2, 0x96425F17EEFB1033, 0x9E1CC9EDFC13A016, 0xEB39B9FEF45F1F70, 0xD47439290007D6DD, 0x2881C129080BAF0C },
+        { 0x00AE3262401224DD, 0x21B81AFF764BCAA4, 0x306CE560AD8CB978, 0xC23AB9CF6E8599FD, 0xF23097A60C33A41F, 0xFEB41FAB66114CF7, 0xF5004CEA9EBFCFCA, 0xF673224FBF446B48 },
+        { 0x24FCF42974C7846E, 0x41FD95832285F247, 0xC403B793084B0BA9, 0x1EDCFDBD82B5DA5D, 0x1CA33EB131811C04, 0x8FE183C70C6340B6, 0x0C6DDD5FB29B25A0, 0xB1D2E26BAC1B07B3 },
+        { 0x841461BEE73A0C6F, 0x710C9C0D03066DA7, 0xBD03273E2AD043C6, 0x97B54E6E44CC10A2, 0x158F9A4A35B4A1F1, 0xB4A3246DFE8DF3AB, 0x5DF5FC6705E62D63, 0x4F0F13B6F81BF86A },
+        { 0x12931C0AB57F4E28, 0xACEF45202ECA1452, 0x36FFD79F06FD68B1, 0x830BA5ADAAB41269, 0x93C3EA605C061135, 0x47C4F278399600F4, 0xCE6EC7F953B199AD, 0xA7FFA27F01928F94 },
+        { 0x09385D5DBD056646, 0xC1A2DFF35E89C530, 0x84C21EB1EFF4CC58, 0x118434526448AE92, 0xFD2E68357E445807, 0x2D3D1BA1B65D714F, 0x772CA0673ACD55B8, 0x9E8CCE788E002FB6 },
+        { 0xBF0E5EF706919C2C, 0x35D5ED93A9C1F4BE, 0x5E219FDA225061B6, 0xB5F879CFB99F54EA, 0x167BA9FE3DE5B87D, 0xCEAE9291F09FBA36, 0xFED85D4DE161CD32, 0x925833885CC0AB52 },
+        { 0xBFD8A2B439F7A14F, 0xA9CEFC2BC2D9CFE8, 0xC62DC603D8600783, 0xE468CE621E457C88, 0x8A4A859D667BB670, 0x81AB3CE7AA617476, 0x7A1575238BD9A05E, 0x3DDE885F6A7B48B3 },
+        { 0x107B416B4A9A46DF, 0x4372C4E4D996027B, 0x031C05EAE55D0F93, 0x42ED3987798A82B8, 0xC1B68BC5070A5DA8, 0x4A25D1C6E939069E, 0xC0E9E7C04674C4BE, 0x1064CC37996D7BDA },
+    },
+    {   // 2^90·G
+        { 0x96613A86EB60F15B, 0x6DE318D4AD689E96, 0x89845897FD3ACFE9, 0xF2E7A57016A222F3, 0x90A6D777D2968FEC, 0xABABA0D2BCEC00A9, 0xA6E827F2CDE70F2B, 0x288FF0E0F4BBEA8C },
+        { 0x2CC4AACF32CC9E79, 0xF58D07461DE39059, 0xA6FE23FE175E98E3, 0x9A023F88079A1A53, 0xD886EE779EBD052A, 0x3E5B9A57ED495D9C, 0x1F3623CB56D3C78D, 0xE060005C487722FE },
+        { 0xC032A7F786ACEB7D, 0x4F98709B053A3091, 0x53E93F8427406CD4, 0x7235AB69FABE0947, 0xD0008CD9B53B8CB3, 0xDC8C3E533794D7BE, 0xC6E2BAACA5E9E49E, 0x2B5E8FECFFEDCFCF },
+        { 0xF54FA672F3713565, 0x068FE5A532E5309A, 0x6782A8DFBEC4D79E, 0xF55FB7C29A64195E, 0xE4CF927096686149, 0x4C0B85FCEAF31CAB, 0xD893F18D82BC5292, 0xBE7CB406246129D4 },
+        { 0x998D91A20BF33EA0, 0x58D5377DF803E54E, 0xD987C9E03176A770, 0xA736A18B9F91A55D, 0x845A26EC07A12116, 0xF8811C2541B100DB, 0xD99596F395F06CB8, 0x579FD8CB3B9C15B5 },
+        { 0x14617ABE1C20B2FC, 0xA2EED56BA262DFAE, 0x4D7443B749B793A1, 0xF9A49C97F03FF980, 0x81A52CEA6E8011D6, 0x52F0DEF20961DF7B, 0xA965F4024A72D675, 0x6D87063D3F808E03 },
+        { 0x1EE5C9A9E2B44B92, 0xD7BC9CDA779A5DF4, 0x78B2B38A17104C60, 0x824B41051EA46AAA, 0x0E1FD4FF44C69BB9, 0x00117A5A17B6C97C, 0xDFB8A6E612D458C3, 0xB286213354C0D4AD },
+        { 0xE45369E9934961C1, 0x8E4B29457C799729, 0x35C55E87361B3E41, 0x6CD1B014DD7FB686, 0xFE9FDA934EABFE5C, 0x7F57BBCA71ADF5AE, 0x72EC124B019F8089, 0xBEB2B9EE9B4D4AF8 },
+        { 0xE4320F849542343E, 0xA8E5AE1B12B37096, 0xDE6CC0CC5FEE0789, 0x1E8709AA68913788, 0xE188178375C63D48, 0xD29F3D0D125573E7, 0x8484EE99D4FD88AA, 0xE905E1CB0CE0849F },
+        { 0xC80F89A500763BBB, 0x28D98645F7DF9918, 0x0E155DA1D912051F, 0x176A3EBFE61B52FF, 0x6B8F5224A181419A, 0x4903A615CB4D2415, 0xB8806E41F2634145, 0xC934E8045B420074 },
+        { 0xEFAF6A62EA0B0977, 0x7E2585B9D8362644, 0x6849D743FD03CD3B, 0xCFE1BF1E97811C01, 0x507559E441A0CCFB, 0x319D14BD390216A1, 0x372A82222D9EE3B4, 0x8289DC0CD04A090D },
+        { 0x7331FD81BE2C6CC2, 0x49AB1E27EEA27211, 0xC68C58D60CB3A585, 0x8231E5193BDCDBF3, 0x08C4F8349D267C83, 0x3BA9E2A0B6B45664, 0x3F13FC1837145133, 0x83821BFD0072E721 },
+        { 0xD199876EA746F5BD, 0x49B14FE820107374, 0x99E407220D210681, 0x3A216A6E679793BB, 0x8BBA7FC95EE699FD, 0x48F7CF2B23CD3B9E, 0x1EC23384148E2681, 0x61E1D210F6441241 },
+        { 0x32E53E9F16484A2E, 0xFCEFB96EA6142F4A, 0x40F98D8D0BE5B82B, 0x0FF86B23BF6B8758, 0x7CC2E75280D0145D, 0xDD1FA456B29487E6, 0x510335EC7A7727A1, 0xBEBB2C7B31EE4CE2 },
+        { 0xB82E0DB42C1C9026, 0x47B1E1610D4D7FD1, 0x8A00F0DD1E089DCD, 0x4F9596C1CEB8E7B5, 0xA02996A478A38FEB, 0xFCE1793F32E96F5A, 0x5B3FCCA31DA4E596, 0x596A73F831C875EF },
+        { 0x3437F9479ED4C802, 0xDD3B84C4DA55D3A9, 0x27B9344A5BB14D45, 0x2E1C6BD73FEAEC76, 0xE8380F9B95A6C146, 0x4BF989AD70963CC0, 0x6FBA5498ED87D769, 0x5C24288C7AF84318 },
+    },
+    {   // 2^95·G
+        { 0x5CD1A736A1EBCEE6, 0xBBA9F2F3532FE3DC, 0xB535FD248F5F9BBD, 0xD65B2F39A2AAC0A7, 0xAD5BE0533DA27799, 0xB5C846F41E8C75EF, 0x4FC05FE4DA228245, 0xEAB41A97685A3530 },
+        { 0x562B41323F9735BB, 0x486B7CC7A7737B30, 0x8FD63D0975170A6F, 0x285067E43232020B, 0x6DD2D995B935E3F0, 0x9BD72D1BDB8AA769, 0x3ECF7802E412BA4B, 0x6F4232CAD48D7773 },
+        { 0xFFCFA95E155463AC, 0x1A7C8F63A2CD5F84, 0xF4931678214BE962, 0x05A53148621A12BC, 0x00D0A74EB8952562, 0xA1D404FFBB8FCF57, 0x51882E73BF89785C, 0xD94CC672AD7E140B },
+        { 0x9C93E15DCB24FAEE, 0x66E75EE636753151, 0x9BC6F1790F552CEA, 0x831EF7FC7F404F20, 0x85D868F891A8E031, 0x29D21306B4D6F58E, 0x3F9A5F140AA9182A, 0x259592A153F05454 },
+        { 0x0AC3BFA06E36E618, 0xCC6B8088640B2549, 0x5AB33DE7A1B3F95A, 0x36BF95DA0D96F68F, 0x44E8A4972EEFA920, 0xB7A9AFEE15B7B278, 0x8DFBFBF1787C5914, 0x5C78187AFEAAFF04 },
+        { 0x52ECEC3FF6036C7A, 0x2C5628D7043357DC, 0x1DE6B22443D3CB83, 0x3E435089302F2028, 0x1A14D8578FD13D58, 0x0E9F51CC23E1A5DC, 0x132B6601C13F5E92, 0x5C26236C7ED1C5C2 },
+        { 0xAB6CBB0A8E383348, 0x1BE48F60B69FD034, 0x5E6DADD2011BAC46, 0xFD7B467FDBE4A496, 0x2935D05B4933AFC7, 0x3D0ADE20187365E9, 0x10FF497EBA1FB278, 0xE3D0ACBA93888CB0 },
+        { 0x3EA58B229692C343, 0x3A2327177B0E23CD, 0x080A7965187F7D6D, 0xD2BBD4B0E99FC9D3, 0x9C7524233FDA0B31, 0xA7559D52CDBC4DB6, 0x2954B1691435897E, 0xB75F5BD5A1BCD336 },
+        { 0xD91F9546F80AF2D7, 0xFB1B4794B4A18A7C, 0x5AD01776BF157038, 0xE362422F1ECCD915, 0x190C09F7F09509B4, 0x6F084F4FFB67DF3A, 0xD572798F639CF6F8, 0x3311C9F3E7DF397F },
+        { 0x071E9330F86714D5, 0x8E2BCBC7D725D651, 0xF25F93B5B46921CB, 0x7EBA869F695A57F2, 0x0B68B8EA075B21CF, 0x5C59BF45550E3B06, 0xB3E5097CA8E97A7B, 0x46F09DC90390C8B8 },
+        { 0x0A172593F7E00D55, 0xF4D62F12F21B74D5, 0x1872A93520688901, 0xFC13D423C292714E, 0x8E909D2253BB0058, 0x233F831A03D12EA3, 0x53D1ACBE2F5E353D, 0x35505F93B2241820 },
+        { 0x74BE7E6BB39FDD3E, 0x083A3054E3F728D6, 0xCB1600CBE25966C3, 0x85E967A85345748C, 0x57F5586536800D62, 0x725EA3F2271C4B03, 0x0F19D7A8548C99B0, 0x281D5FA9793AC5BB },
+        { 0x8AC0FFAFF87F16F6, 0x1A90FB398DA9941B, 0x244960F9842E5C21, 0x2C2484ADB1298E0A, 0x1BF574C00A4613EA, 0x05B83B06C8FAC881, 0x3A8E784595D8E22B, 0xA5C5713350F3315B },
+        { 0xE6C3E1B192ADAC84, 0x458999D16849CF40, 0x0B40EADD2A1BF84D, 0x6946DC63FD0FA425, 0x59BA404BC67B5410, 0x17CEDB7711183749, 0x21C52B4684CAF00F, 0x677108DD2A4D5C45 },
+        { 0x01C90E14B9065843, 0x2AA21AD70F9C45DE, 0x1639ED243EC4A0FF, 0xBA4E651B3EF27F24, 0xCE754175007190E1, 0xFADE34C59CEE8394, 0xDF1199431753C634, 0xD00E5BF65D65D7FD },
+        { 0xB4D9DFBEA88BCEBD, 0x60EFE4BDC9CA5091, 0x794BEFFAB57BEDF1, 0x2878CED6B1C23212, 0xAE9896E6B5932724, 0xAEA3A0E6BF1271BC, 0x77E2A32410DBAFA8, 0x1C5D20A2A5EA421A },
+    },
+    {   // 2^100·G
+        { 0x60AC0D9044D11582, 0x4E70869ED02F01E5, 0xD06CD1BAEA488FC8, 0x0F9C80BEC6AF19B8, 0x1193AF79D861B588, 0x6B20B1A03EBE0AEB, 0x58204D8F5698176C, 0x490239BA4EA59823 },
+        { 0x6BC76D7B90DB7B08, 0x755AE85383DA07EA, 0x7D35C83C8E677068, 0xA998C5FD0746BC3E, 0xDCA7A223E6D31EA4, 0xFBFE36D124722355, 0xEE5AF95C7ECE7923, 0x338C1178FA5704BD },
+        { 0xA016CD97A98017E0, 0x58073AC817A9DED5, 0x978DB22B7424AFBE, 0x534BCE48E9DBEBE7, 0xF95605185351FE4E, 0x3C0C6805ACA0DA01, 0x4A20B5EFDBBCE17E, 0xBC8E87CCF43CC8D4 },
+        { 0x7F78634CDA266A60, 0x1BE77643A069608E, 0x93B6168EFC30B8DA, 0x12AA01A3C1187BBD, 0x8B1BC8CD7CF0B3E8, 0x34441EDDF6A4BD20, 0x83704C39B1FFC847, 0x7D4F596AC3876FCC },
+        { 0x9596EB7AB5690462, 0x6CD352A166F8741B, 0xF0C8A52BE85DBFE7, 0x41CE696FD14931E8, 0xDE7E88219DC73AA0, 0x3580481FCD5929F8, 0x93FF41374FCE0EB6, 0xBD532AB91DB0E533 },
+        { 0x60837EEE56F62150, 0xD6BCD6609F280FCD, 0x6DA80ABF4670377F, 0x97D02DBF9B5988C8, 0x0E12DCD7B0AE11DC, 0x7606BAAD49B96B2A, 0x1826BE922D480024, 0x09BAF41A70440458 },
+        { 0x3B18AB8B4C671C4D, 0x47E1E3589D47DAD4, 0xC2A3E3277C608506, 0x56DBDC58C8D56898, 0xA8357D850096288D, 0xCDBA049EF091AD4D, 0x1BC62190AAA1E0B9, 0xE5097F207A3E1AD5 },
+        { 0xB23554017C3D6B78, 0x39602CB82CB04C7E, 0xA3C5272478279B4F, 0x58BDBF706A74ADE5, 0x85EC70DA3633D1D9, 0x117DD59B79626827, 0xBE67EDE736A0B3D7, 0x9CF5B071C402C1A8 },
+        { 0xEEBC433DE07236F7, 0x0D93F8DC65F09BBA, 0x6E9FCABA66BAFD0D, 0x4CE90FDF8BCB58E1, 0xAE4BB0E812606735, 0xE5544CAD66DFFA5C, 0xC66CBC8B06003F6B, 0xCF24E1212E5A8397 },
+        { 0xC787701EAD25EA20, 0xC21304C896A3347E, 0xF71A42DA135BDBF9, 0xA7E7225DBE58B99D, 0xCAFB016389974EBD, 0xC953D72D78A1A56E, 0x3DCF02D7538DB073, 0xA6AB6DAAEC0C69F5 },
+        { 0x38E6BE902DC6A30C, 0x0167141FE80F4896, 0x863C03FFF526B72E, 0x3BAD21E4252F9E0F, 0x38F6CA3830BDAE19, 0xCBB9C81124826325, 0x562CD5001193A953, 0x485FF9710F9CA170 },
+        { 0x3EB12BC3DBD66375, 0x39B24DEA1E11915A, 0x8C4559D5E7E5A78C, 0x2D7F2FE1E1DFCC2E, 0x6264ABF4282DC9B5, 0x19AF9A3179448158, 0x641C584F085BDE28, 0xAE5DE8E9A8290297 },
+        { 0x5F3D2912831CC490, 0x1CA9E28506A82DAB, 0xB7C7A5B5D6EEB218, 0xD69D91CB52B7A224, 0xD5A780EE780A8626, 0x50AF6821D7B4BE9E, 0xFAFE39CF6AB304C5, 0xCD28EE9A5B4B3C76 },
+        { 0x09F4C1237EC1E429, 0xCBCAAE45B1BD53FC, 0xA91A6B0FAD5DD224, 0x95540852F9770FC4, 0x85EC415E03A9D446, 0xF0454486863F007A, 0x97127587B93245C2, 0xA4C78468B7A3BF36 },
+        { 0x8C00D76856B98E31, 0xC6ED7852D7B3F1E4, 0xF8033E2676ADC23B, 0x943646878284F3AB, 0x2DF6CA47319037F0, 0x82ACC953666A6837, 0xA834E72DB115145D, 0x099BC8C52391A1B6 },
+        { 0x14824D5E79BDCD75, 0xAC2D531BA53A650C, 0x8B1CCE21C67A9F75, 0x00F49EFE6A4B8FEF, 0xBD5AB2E5518B4AEB, 0x1C4F8A4B2A9AF59F, 0xAA0967B1143EBB35, 0xDDBB1F9B58C910DB },
+    },
+    {   // 2^105·G
+        { 0x2EA81495DC7E14BA, 0x4E693ECE3030A628, 0xF0DD79876EB1B895, 0x83758ECE660B60F0, 0xEC1D55458D59179E, 0x59365825E63FF5BE, 0xCA9A4796F743EB07, 0xE4ABE3091E998F38 },
+        { 0x8F30846E89F43C42, 0x7202A854DDD95D05, 0x0C18A89F5F5868A8, 0xFF42E0142A9BAF2F, 0xA7E29DC3F192E73B, 0x8D72F26266A19B04, 0x72E5AA54B7F6D00F, 0xE64B10DE6CACB419 },
+        { 0xEEDBEB7389F46CF3, 0xD0E669DC2BF62310, 0x805B4D45558478D8, 0x786E3686F6554732, 0xFF7ED48B460B496B, 0xD45F4D88F4483BF6, 0xE1E5B82DD4670FC8, 0x48CAE852971BCAD8 },
+        { 0x532B2A346ADADC83, 0x00A9045E4AA69554, 0x4735B6BF8B2C2335, 0xDFD4F47CD4DFE6C8, 0xB168F826D6D9C090, 0xAD1E41AE7179A8A1, 0x65899ABF5063E125, 0x5A3D2700E66471B9 },
+        { 0x0953D39A06833CC1, 0xB65C0691432845B7, 0xFAAE751A908ACFA1, 0xE68C92AB15E2F91B, 0xA324295921F5AACF, 0x69884066A075642F, 0x04EFBECC03725374, 0x6F8FD8DDB6347149 },
+        { 0x39C205209F258DF6, 0xED0E1BCF38C52A46, 0x7567F3B074F33CF4, 0x938DBF723DE1EB16, 0xE430E24BD8FBDF70, 0x47D7065294BF6467, 0xD792F73CA4868280, 0x3DECFA6F831010B6 },
+        { 0xF8BDD98CEE648C3C, 0x281D8364BC6467F1, 0xA8EA359CE68D0C86, 0xBF2BFA9EF8F7228E, 0xAC73B55F0A88BA57, 0x711ADBF806F2A375, 0x65EBEDE00EC0A445, 0x4445D19B1F3E8A49 },
+        { 0x14F057AF088B5B97, 0x831799F09602183D, 0x2036D3D151165DB8, 0x576FE9855865B246, 0x01E84D4822EA9D75, 0x2FBDAA6BEEF003D3, 0xB24BBAD76466139A, 0x872475FAF54D1F11 },
+        { 0xC0B817D15D7022FE, 0x1C76C0A649677BB7, 0xA54664D824B1F876, 0xAB005C8C1A48250E, 0xF3778760C5D91193, 0xE3E6A6B38465FBF2, 0xC12DFE9D31CEA2B6, 0x90312EC1063FA356 },
+        { 0x71112D36F72A5952, 0x9B650DAEA6289D5A, 0xFA8740AFF1DE9206, 0x2ADF02D058AD9200, 0x71F27D2EF6788D25, 0x35D6A4E2B2AB4247, 0x182DD5EC8C753449, 0x80B09C4DF1C9C4F1 },
+        { 0x3EA5AC0F49563BD7, 0x9FEF5BD4F7091F62, 0xDC5BEFE242FDAB17, 0x7EA1543168470DE6, 0x4D42AF84695E301D, 0x3C4A3323E19E5740, 0x3E30E46CDCC25347, 0x3C1B1218D5CFC084 },
+        { 0x8DE94ABC71A28DB1, 0x824BA00E8B16D119, 0xEF003E1D844D6927, 0x55530BEE2ED65047, 0x8FA949D85224D14F, 0x0C82CFAAE962185D, 0xB9121A587CBD8968, 0x7D6900F64FC472D4 },
+        { 0x25D224D534BCD2E7, 0xDF350385039BB872, 0x1E5330C5C9E6356E, 0x3BAAAB45A97DAC57, 0x73ACC59AD6B4A039, 0x81B72873922F1EC0, 0x86307E881F5DC965, 0x50AB9D93CE618FA7 },
+        { 0x0E6AC97A56C78042, 0x87FE29C9566B55E7, 0xC104F8981D0608B5, 0x103F626CFD68AC9F, 0x77E4FA487B6EB752, 0x5DBBF7ADF144E13B, 0xB644E466F7683B5A, 0x6343D5C78025B914 },
+        { 0xF0EBD6A1D0E774DE, 0x9A5811323349FBC5, 0xA775AD0C30374B51, 0x1BE49D5DAD4A121D, 0x3A054173FA304B44, 0x89924789E96B5481, 0x1799B2939875FCFB, 0xFFC3444C7D784008 },
+        { 0x10A701DA722B558F, 0x3EEA5C3074D89347, 0x2CC28B3AB611E713, 0x7B6DC4E5FB8808AA, 0xE7CEB58D34979139, 0x478B5986F8F1E520, 0xF5AF9C876728655B, 0xE3CA60AB855B905F },
+    },
+    {   // 2^110·G
+        { 0x325986C29A03B666, 0x54706ACEEAE151EB, 0x6A6E73BE7613F0DE, 0xBAA075CD5FC17C47, 0x6FFFCBC8ADD29BF2, 0xFAB07D54375D8C1A, 0x20D95B9AC58AF7B7, 0x6519F8201F4C7F39 },
+        { 0x3B95B0142A76964F, 0xD41D9FAA037771D2, 0x7386EBDAF7381652, 0x27676F6106C8D4EB, 0x78A0D107245604A4, 0x287FF513DAAA017C, 0x3D606C135FC984AC, 0x4554B122FA930F9A },
+        { 0x7FAEF6DEEADE23F2, 0x3313DB6B9AD89B17, 0xF9295486BB03C571, 0x795AB90D52F6E9B1, 0xB0FBDCE2867F9FD0, 0x7B00B0D0B077E418, 0x0D7EDBDADC5D4776, 0x7AE8AA58C804D85E },
+        { 0x7873824F5CA42F70, 0xEA56E66CFC41A833, 0x7EEA9F0D8395BFF9, 0x7D05D2BAF7F86C25, 0x0AA8501FA90993CE, 0x11B0F1F1A0038312, 0x0170726D88937E85, 0x5BE73564A85F7C09 },
+        { 0x0B502F7F19D98851, 0x70EA944FC7D9BD87, 0x57F4201849B7C698, 0x0C9A6DEEDE4EC1DD, 0x2AF4E4D976FDEAB3, 0xE26EDABBC41D486C, 0x65F6E55C1A555BCD, 0x716A697E5462C65F },
+        { 0x986085720B0E265B, 0xC1D78090C65AF9E9, 0xBB4A38250F265067, 0x1712937A36988242, 0x77DB62364767BCC5, 0x28A12238896DC302, 0x0BA92D27C2F2FD42, 0x053B6AAB5BF83FD0 },
+        { 0x3A9387C53B49FDC8, 0x2768F059B03DF454, 0x21261E2AC7B601B5, 0x787F789F8DCB4F0B, 0xF39A820CCE4ECA15, 0x10EF71475362F846, 0x5BA9F912457A7F8F, 0x504A8DF18AC82E1F },
+        { 0x3B2C895A3E9F076F, 0x941D5C6E58A394F8, 0xAD0A30BBA8592FEB, 0x9FFE6B6998EFFAC2, 0x0B6FFF4C923783FD, 0x79CB6210B86F1E4B, 0xB6124A58D8C857D3, 0x85252810BD13506D },
+        { 0x61AE2605AF27DADA, 0xACFA2DB1A550679B, 0x2A30E8649F2ECDAC, 0x7E3CA5E031DBA5CE, 0x63DD1959507A335C, 0x94DFEC5464896F20, 0xC7773704CFF5D033, 0x9C59BA6578069DF7 },
+        { 0xF8681A0A6DE5B0C6, 0x3AD39EC691047A4D, 0x3F9C0F59E26B8B50, 0x3234E3FF972F5A67, 0xED41F50909F6FABA, 0x7B467AD39BAC6C99, 0xA4125DF760481BE7, 0xD6D572CE763455D0 },
+        { 0xE90620AAE8794A45, 0x01463E6693A3103E, 0xBBB4B01ECDED3286, 0x549DD4EC1E5A1EAE, 0xF7D15A06C7C8B9C9, 0xD88CAA9FC600E14C, 0x467CABA320EFE431, 0xC17C3BC541141455 },
+        { 0xCC3D3AE3284703FC, 0xED265A17F67257F9, 0x73A6A819D07090C5, 0xFD0CB9EA7E502613, 0x1DEB928F60052586, 0xBAC81CD11D843DE5, 0x92C2713FA619AA17, 0x97858D0771C4330B },
+        { 0xAF669EB35C158CA3, 0xF6728E813CE7CB9A, 0xFEE2CB8FE910AF3C, 0x43C4632DA41F38AA, 0x29718D5752AA4BDE, 0xB6F0BB469284D337, 0x24CB46D5782439F1, 0xBF8754A63D1B8DFA },
+        { 0x711749A4E60755BA, 0x28162D470F2CD8BE, 0xBDEFE7B01112CEC4, 0x83703D53E8E6145D, 0x02A4D8B38AF434FD, 0xCE0285DB42D9BDD5, 0xF82B3159F617D765, 0xE92C484EAA3A233B },
+        { 0x083EF8252E50FFAC, 0x6A61FC0D924DD237, 0x279DBC8D50054F9C, 0x058793AF5DDA2CAE, 0x06DF705D858ED197, 0x6F14F75E3BAF4493, 0x01DE6D4107FCFF47, 0x6F550626498C8141 },
+        { 0x4AE364E2F74DD541, 0x7CBB1CBB35AC7579, 0x6BEE02C9B3C48C82, 0xC3306B2DC7AE79AD, 0x73574F8BB965A001, 0x0A6479A558783E70, 0x744621FC57F88C56, 0x01620F237679536F },
+    },
+    {   // 2^115·G
+        { 0xF9627435D3DE0466, 0x02B61DD62617E30A, 0xF9B733A022DD8D6F, 0x9B39925259549C34, 0x4E7E4707379080F5, 0xE5C7094057EC3F59, 0xDCB3D9A65C54A538, 0x565D0FC11D5942C4 },
+        { 0xE262BB76B2619930, 0x11B21AB1DA21A0CC, 0xFD3A0FEC6C179EC5, 0xCD64AFED80A33424, 0x561ECEDB948F3CA5, 0x66B684FB62265ED2, 0x9C440479D77E9863, 0x3E92ADB3C92EC938 },
+        { 0x8A462078FBE95166, 0xF18A710A6D547D97, 0xD897BF7165091C94, 0x381FE5024F737FDD, 0xA760EB333ECD9598, 0x3F1D5B1331164393, 0xF8C78942A35AE8DB, 0x70D95BDE0EC4C165 },
+        { 0xD4A45339BB1A70AC, 0x739878BEBD3AAFBA, 0x485584D02AC3C425, 0x88CABAE8109FC73E, 0xB305DD89D2B34B57, 0x1D4967992A8220BD, 0xCAA9DA90EE842684, 0x8A0AF57DFCE8DD0F },
+        { 0x0358076A3C262B22, 0x128A96BC2A9F8116, 0xB6E0F026EF4C89D1, 0x1BE88C2EE2D969AC, 0xA595F30B1822D76A, 0xBAEB4FD81008698C, 0xC83DCC656F957DBF, 0x69105D54572EE642 },
+        { 0xB9EF53F08E17B87F, 0x3C5AB22030D4766C, 0x00A6813D4D22AD0D, 0xB5A638C70218CFB0, 0xEA9FF995AB0ED45C, 0x3C8D21A64910EF69, 0x73AE3956BF101B66, 0xBEB299763572B968 },
+        { 0xEA15F8E3C1F021F9, 0x9B2F5651DA33886A, 0x9628DB308757C890, 0xD23DF148708570D8, 0x51E0E641E53704A7, 0xC84AD76247FB8471, 0xC3248960FDC52D7F, 0x4A6A7E2CBE1628E6 },
+        { 0x25355CFB6AC8EEF8, 0x41E89054BA149109, 0xAD709449F744A536, 0xEFFC0C31D6C1C3F0, 0x811B8D65E89689AF, 0xD3EF14243D457D63, 0xC17B089E086E905C, 0xB7B2D8DFDA59E6D7 },
+        { 0x48BF02528B31FB77, 0x10350538B8C4A6EC, 0xE44DA9159186884C, 0x5FBA2BB34DA050DB, 0x396ADC63D26A0DBF, 0x5360E439F959B314, 0xC14836CFA19E2490, 0x82F7ED6F01173EDF },
+        { 0x36C637858AB5EAE5, 0x305C532C1A79E6AB, 0x238457ECB01AFC37, 0x5478CF7737698637, 0xAF3257B917110270, 0xC8DA149B7E6F45A4, 0x30186F92727482B3, 0x081F403A4CE80C8C },
+        { 0x56B55C3F9CC84F4F, 0xE78CA292DFF31BCC, 0xED5246042DD588F5, 0x438968AEE1F139B0, 0x08365669EF102388, 0xE04C70E4916E802D, 0xA32C6E76673BEF96, 0xD3CAE06130E8C2EA },
+        { 0x50FDF5EC40E2B376, 0x4C77F025D92506E0, 0xA96F6F22CBCFE05D, 0x3C18DA2177C52C1A, 0x48A975BA65A2E1BF, 0x3BB086C0B07B6626, 0x0BC61A75CC2690A8, 0x3F5374633DEBCB37 },
+        { 0x8D2BDA807EBF6C21, 0xB8C1E6C894C26210, 0xCADE84233568FF55, 0xE56C96E63D5109B6, 0x2945B8751C0BA49D, 0x051F802F1FC88FE7, 0x8A75DD211340207E, 0xA8B92D8F2A8707CB },
+        { 0x3D00F92246666FCA, 0x3858BC5803E19CD1, 0x4476D8FE1D390E14, 0x0D062E1C57E7E670, 0x15702155EEED580A, 0xE91F5A8901624989, 0x1E7172EC72A681D9, 0x56B8F3E859603611 },
+        { 0x6044FF9D22D88560, 0x7D8BF7A6CD9A9D2B, 0x1BA6853EA2EA2F98, 0xE209AB75D012D925, 0xB9A915EFDA8A090A, 0xEAC7D5074C7ADEEC, 0xC5D31BCA566340DF, 0xBF77E4E09E458553 },
+        { 0xC73C191C0810A910, 0x9AEEA91BE26C912D, 0x53566C9F2E26508D, 0xBFC9795A52F24A43, 0x2A223429D28F207D, 0x10C75713C533C581, 0xD957DCF08527955C, 0xFDA8A222D361EAF2 },
+    },
+    {   // 2^120·G
+        { 0x07C355675C42FAB2, 0x415BC04C0BFFE00D, 0xF2F7B28BBA0E588C, 0xA78EAFEA783A3766, 0x7BA2DEFD1316E511, 0xCB726B9CEDA99EAE, 0x35ADAC35C3C8BAF7, 0x9A444260DE1E5C0C },
+        { 0xC650AB2105E8FF50, 0x0E39578EA735A125, 0x40FB887DB6CF0036, 0x996678697A2C908B, 0x6FA4F7D521BBF86F, 0x2BB7A675A06CE37C, 0x279B005EEE88862C, 0xE468EB075C2ADE64 },
+        { 0x4177BD7EF2E19C29, 0x850B0B3D28278698, 0x515ABA5CD0CA9CC4, 0x1B638370496E6FCF, 0xE7DDF6B5767C33F8, 0x9EBE1ED303F766BE, 0x3561DC72A9D2D615, 0x06300D506939C4ED },
+        { 0x3FC04D1823B876BC, 0x1B1EABD616F7E531, 0xC344AC3CC977E397, 0xFD2E2A4226DB234B, 0x5EFAC9A8F35FD1F5, 0xE4E2ADCACC5C23C2, 0x8F6BCC33172F3E8C, 0xE97D2C45DE43D2BF },
+        { 0x604CF274C0DABEE2, 0x06281CF056306D71, 0xEB25683416837013, 0x3EFDF365065781ED, 0x4C048B86EEBB7307, 0x22EBCE902C95CA77, 0x67FF2BEFF123389F, 0x8E00D97138303F49 },
+        { 0x95B5789D6CD3BE5E, 0xF26388CF4E58BDF5, 0xCBECBED37AE91A12, 0x15A71279C58642E9, 0x4EA9F6D4F035B778, 0xFDB71A80117F85CB, 0xA635E2109693E2DF, 0x73CC95E6727B8AA0 },
+        { 0xC8BA33A5434FBEC6, 0x70D05BEA9D943E3F, 0x41F3CD3A4E611642, 0x1BE5336513A31C5A, 0x587C988C859BD018, 0xAC8BE99C8816D54F, 0x0782F11BDFC8B61B, 0x43E37966F62FE707 },
+        { 0xDF7B7603F7C879DF, 0xEBA5957195A1BCE1, 0x2C84C1A809B35A3B, 0xEB743509C03E020E, 0x82CA882448BA3758, 0x1A701FD756B5BD49, 0x14EBC45F46E2C6DB, 0x5FA632B6C7D25918 },
+        { 0xBB9E533BB63410E0, 0xA9F50ED80534405F, 0xC22CCCF7CA434395, 0xA63AC45CFF253864, 0xE22FB5ECBB86BC4B, 0x6E8E1C3DEA533654, 0xED9AD8F832F74468, 0xE87489C372C1DBC4 },
+        { 0x833BA3B3D215C15D, 0x6DA9D57DD0BEB94D, 0x082D2ACD84F2987B, 0x1907967226330448, 0x9F272CCAABFC6431, 0xA88455770988B988, 0x407D6756FEA62D99, 0xE82402B6A1551A72 },
+        { 0x813B118050376D79, 0x7009EF7AF96C4278, 0x5E95553AA30072B6, 0x5A22CE9D81F0F0DA, 0xE77107911AFC19C2, 0xD895C84226884C85, 0x0B745D9E0D33A9C4, 0x52FD08CE7D29172C },
+        { 0xBABBFCA149408490, 0xF5AF3B29EC2C4866, 0x8AA6A38BD6D08567, 0x29978736D48E5A59, 0xC2E91E3517ABE42D, 0x864A2302B2014B97, 0x37ADB4B01E8B817B, 0xF05A507048D54105 },
+        { 0xDBA52E31E991A09A, 0x712534969197A3B0, 0x5E96017B6A1CBFF0, 0x17169280464D4319, 0x9E48649CDAD72F79, 0xC534DCC994D27BA4, 0x854220B067052144, 0x4DFED5000F59165C },
+        { 0xA1EC5DC3E03DC8A5, 0x6484DF47F8934BB2, 0xE81BAAE6FE3F74D0, 0x4D1227530181D2C9, 0xA856048776C54F39, 0x294025F08C6405B0, 0x02B4099F219E0D5A, 0x40F5655C31C1CDA9 },
+        { 0xD51F1644B1072C9C, 0xDA3B674A45728D9A, 0x89A0E380905E1D54, 0x860142B2CA1B057B, 0x20D308AF97B4A6C4, 0xB9599A5CCA0FA37E, 0xF5B304089D405A43, 0xFDBCFBB63667F524 },
+        { 0x7EFBE8AB3DE15E88, 0x65DB5222F09689EE, 0xCF2320B4C2EEB19A, 0x7B2BD444BE20A1E5, 0x360A2D43A7FA82FB, 0x88B70933B5C438A5, 0xF880E93ED7229A6F, 0xCA8578D2197753F8 },
+    },
+    {   // 2^125·G
+        { 0x4CAB1D53A14DFE2A, 0xCA10D5ABF29D5576, 0x169782B524220F9C, 0x36F84412C14D72C3, 0x1D7D56517CF7EFA3, 0x9643EE22E4EDFD1B, 0x10F770E4FF7973BE, 0x2A4501B56D1D597E },
+        { 0x51627650C042E2F7, 0x09C3A4345D399849, 0x7F7307F0C4E3B823, 0xA1F5A5E41A8F4AA1, 0xE8A3E536AAE3AF83, 0xDD789DDC1DF0325E, 0x1E3E6092A34F433E, 0xE8880BD3DBA2C85A },
+        { 0x0737CDB03D9C7939, 0xF1AB5064CC1B6CC5, 0x91FCD4E0D815928B, 0x96EFA390A5382976, 0xD68DBFA2596186F3, 0x8E2E3C035BEA839D, 0x2750F4F4A4EC9EA1, 0xA09F9B1A052E76F6 },
+        { 0x0F677310AA4CCF9F, 0xC5469182718D73CB, 0x89A839F82233B598, 0x35B3053A9220A71C, 0x60D881D5862FCC41, 0x980459F9503D88BC, 0x70E3976FCF6953B1, 0xFC05AE6B5594E694 },
+        { 0xE0C05FF4809954AA, 0xD06E66BC112E8414, 0x5CBF19D250628A5B, 0xECE9015BC911BDD6, 0xC7CD2A53ABE164B7, 0x96E89665A3F85195, 0xC71B1909FFA4EF40, 0xBE0F2669774A030F },
+        { 0x966D9079AA392DA6, 0x39DC71F2A9D46011, 0x3A96407742DFD59F, 0x964E1EDAA0FC0DF0, 0xFB30F422576677A1, 0x251F947166645329, 0xD0663FCB925EB8F2, 0xC176760DE8B2A11D },
+        { 0x0539C1FDD5A8ADB3, 0x9AC7BBE672580BA8, 0x0328950518DB4CDD, 0x819073832FA3CF97, 0x9802EE8425C3F9EA, 0x0797F9F48527DD5B, 0x1EF356457EE1FDF3, 0x1D0A09209C2C0775 },
+        { 0x56D53751B957856C, 0x63F5160FB4D872AE, 0x9A298FB320E57A3A, 0x60E259E9A1F3242A, 0xF3DB13224DFFE0C1, 0x49F21FE7BEFFE8BF, 0x5BB371F6E42330F8, 0xFAF55FE227DFD936 },
+        { 0x14CD358702C14ED6, 0x6BF16EFB415E71E1, 0xF1B7C864E0EBD77A, 0x7BBB554BCD3A6FE7, 0xDA19F49E1D6E6EAA, 0xF5733EEF3C085DC5, 0xADDB0EFE74A6C76F, 0xB3EC79EE6AA43D36 },
+        { 0xE27DFD79300A025B, 0x7F94483974B9C565, 0xBE31C78883D40E5C, 0xC5B56A4E4BD68952, 0xA30E2739C1DF4D35, 0x085B842754424FC2, 0xECDFB3DC646E9639, 0x5377F7D6CBFEB0EE },
+        { 0x6E16E57ABDD9196E, 0x832013912F8901C2, 0xBB479A43F1288C5D, 0xD4E1F6B1D8C946D0, 0xD269FC4EF2D32BDF, 0x90DCE1D8BB765E64, 0x38D33D5E72373E98, 0xDE0F38B148E088DC },
+        { 0xAB0171750FBBC371, 0x68871BB0CD499827, 0xEF713C8DA216B8A3, 0xE24F857C9E64D1C2, 0xE53C77A42D9F2DAF, 0x5D13C82770216C13, 0xC2C766D47E8FDA61, 0xDE8D3D468F01D0FA },
+        { 0xE367FDDFE9A675C2, 0x966A7CB3618F4517, 0x86ED6DF3D6A37C0B, 0xAEAF17F900B93290, 0xC3D9DE344B7E387B, 0x3E989DEDD26C5BE5, 0x32A5F68BA68FD380, 0x5DB1099B99FDE4AA },
+        { 0x76A720759768A80B, 0x7A8F789E41043773, 0x3B93798153FD14BD, 0x67CB172C562C7F7B, 0x06262A72893D204E, 0x32E7D55866EB17EE, 0xEC21611584D55FAF, 0x5AE0D76667BE1736 },
+        { 0x05C2D0F34213FEDD, 0xB21FB3793E195B89, 0x18E06648312C1182, 0xF9C75A15888C4C37, 0x23D8C85643CBB057, 0x5294FEA0880F2768, 0xFE289233BE574E05, 0xE4F6BCF6C7A2733B },
+        { 0xD86C1FEB2109C486, 0x1401B0D5722DA8FF, 0x8248DFE4888F8EE8, 0x0215DC84E665BAF8, 0x614B6646D89D55CE, 0x731012BF7D7C0C1B, 0xBC3B4C739F5C4988, 0xED97AD5F2C82C594 },
+    },
+    {   // 2^130·G
+        { 0xE12DC16B1AF7B8BB, 0xE462AFCA53893679, 0x4BAC5266256F1881, 0x4BAC6898CC267EF7, 0x9B72C54E44CBB149, 0x91118DE437092612, 0xBD2BBF39973DFC2A, 0xF87A708D05995F72 },
+        { 0x6D92FE41489CD529, 0xF75F52B15F3A033D, 0x374E926410A7ABF0, 0x9D4408A6F98A7F6A, 0x8EBAE5DEAD848066, 0xFE07AAA7708C090E, 0xE2495B6F3C03ABF5, 0xEE10845BC81AA298 },
+        { 0x9B1D7157876D95CB, 0x31CED7D658CC4BEE, 0x456D689C02C19617, 0x6B49082608D49C84, 0x07AA834BB6514C46, 0x3ADEE3467DA44D26, 0xA8AAD9EDC660CC56, 0x8876B8FE5FDB1386 },
+        { 0x025FCC7FF49807A7, 0xF559611D0EC62F8B, 0x4E51FB987486F350, 0xE09D1352C26B6628, 0x8F07A7C45FD549DE, 0x2E36C9029BA77658, 0xA2F2482497F85CC9, 0xF70D4D3326C4EC98 },
+        { 0xD4191835A70A0CAC, 0x1FE50FFDBABFA1AF, 0xC7086657EDB27D4E, 0xBA1186B202677D23, 0xFCD58C83CDF9573B, 0x796E556329970B59, 0xDF80434A01CDD77C, 0xB9031B96C694B3EA },
+        { 0x480906AEFD404EE4, 0x2B12E6B5D68F1F36, 0xBEE7AC46F05BEF43, 0xE4FBA571136F8E16, 0xDB6F6845C99C08DE, 0x91A729B2702E8D87, 0xBE688461FFA7EB26, 0x4BDD07F6120A7B54 },
+        { 0xA37EBFB891E58DAB, 0x1D7BC09268E61CF1, 0x25D8508F797111D1, 0xABA25583AEB7DE80, 0xBA9EAF82BF936899, 0x70F784A019F7D817, 0x920AC3630D8B4054, 0xF1A5D10321CCA779 },
+        { 0x1A2BBFCE72308753, 0x989462E2891146C3, 0x620FF72B80078D34, 0x2CDFA69689A1D76A, 0xCAEFC67590A9FFFE, 0x14E12331A0D49E4B, 0x3C504E6A928B9921, 0x3388D1F9E7A1DB29 },
+        { 0xA6A69E07A3B2575A, 0x9561F41B8DC11F86, 0x9B4A5A8CDA827D2A, 0x9D4D907159D3D9AD, 0x7F21CB643597C466, 0xF7D6BEA2082D1405, 0xDC07986130AD13F9, 0x32ECAA8353E6E9AD },
+        { 0xE8FA49A3FF272C56, 0x69E5AE3A74F13FB3, 0x0C0068A068F88280, 0x49E7101CD3AC2A7A, 0x9B8A0B0334280280, 0x233252A76815D62D, 0xBDBDDCBECF61FF23, 0x764CD6A7911C1DEC },
+        { 0x7AFE3AD2FD697710, 0x87A708ED71CC19E8, 0x034C371483333C79, 0x49DE6D901EBC9E7A, 0x1AAFCF1D0502EF55, 0x96A3E500B60D3E34, 0x26123E766CD34F41, 0x4DE99692B8A81684 },
+        { 0x48D030F4A4EF0452, 0x2799919496695526, 0xC3CF18F14008C576, 0xF0E1198DC72FCE38, 0x33BBE17C1B99F529, 0xC9A7EF8EFE39D005, 0x06F1A1BA2AA15538, 0xFD7A8F59241C23BF },
+        { 0x8B2E18E8E0A358C9, 0xC326187D48F97CC6, 0x24BB28BCA196FD0F, 0x5533D96AEA0AA39B, 0xE27724E58BAC553C, 0xF5820C74F70E41EC, 0xBEDC74954A9F4E08, 0xABCF7BE9EB0A912D },
+        { 0x737BEE9B61E2D823, 0x25AEB471F62D0AD9, 0x8AA871EB178F838D, 0x175C6263C5D3641E, 0xE32714B53B2D7449, 0x2E5D0EE0485C9B67, 0xC80A759E5C221DAB, 0x4D3BEDB93CA4B3BA },
+        { 0x08F6DCFF59DECFD1, 0x80AB2B041E1196D2, 0xC4A661C1ECE4BE28, 0x7E9DC93CA5A397B5, 0x72ABDDFE452BC71B, 0x3193BD3DFD5E47CC, 0x9217A031F515C4C4, 0x7B13CA660DF16A43 },
+        { 0xA4061417A7C9FDFD, 0x4BD7BD7343EF8994, 0x99C4D50BB26095CF, 0x155624A78E4F3A2C, 0x4992215F101EF1AA, 0x75EE42C932BC470A, 0x5390282AFCA5B442, 0xB2023C47FE233DF4 },
+    },
+    {   // 2^135·G
+        { 0xB986F6B15EACA9F2, 0x35A741F2BFFDB5C5, 0x7FCA371CAB594E00, 0xCF7EE8C03C880137, 0xED61D2C52F6A77DA, 0x3050B21711C873AC, 0x7EEDF740CC7853AF, 0x7D387E25F9C473B6 },
+        { 0x7443106E109B1C83, 0x5103066FCD875213, 0x17B1C21542A7AF00, 0xD1A1BAF19BC0516D, 0xE424206C4BBD8942, 0x10E9A9038462050C, 0xAB49C442054CD36B, 0x59AE29C9A92A6176 },
+        { 0x41927E840C642814, 0x036DF232C6C87FCC, 0x2DBCF27D93DE2C6F, 0x1D0BD9B3B73EDA3E, 0x97B384E2F64D1899, 0x0362CC8499C7591A, 0x10BA00A64F7BCAE5, 0xDD93589A26289BA8 },
+        { 0x11FD7CE3B7086F0E, 0x04E9EB97286FEBB6, 0x70C7AF00959B1668, 0x0A857B7BFAF79734, 0x0DF60B01960B0069, 0x0043BF693ACE3FA1, 0x19807881702CE4EE, 0x1BDBF66B669D357A },
+        { 0xD0429AF7DF2187B2, 0xA7F5BCE4CD5572AB, 0x233EBCCF68B0BE2A, 0x847E44DFEA463308, 0xDB06E213C4A0C05F, 0xDD5AA827B7F5E62D, 0x88AA97F1ECE13BC5, 0x8896D42499FDC9A8 },
+        { 0x8E9FC99DC5B5D1D5, 0xFC2822E19859F0C5, 0x06DF3DD33F452FFB, 0xF6A81D17527C057D, 0xF8DCBE4CDCD0A684, 0x9C5043CB774BE1E3, 0x7A1BF808950DAF0F, 0xA25E783CF0E0D5A5 },
+        { 0xF2AD4AE83E6250CF, 0x68844C6781992EC6, 0xF8084A82A2FC3298, 0xED52A205BACBFE32, 0x66E4D49C91111E10, 0xE21D79FBEF3BC421, 0x2497A70FE01061A3, 0xB0A52A129E647D01 },
+        { 0x115835CCFD8D9CE8, 0x0E6C031DE4642323, 0xDC1355BA5526ABE8, 0x22BAE3C40ACBC907, 0xAADB35BE9BF23A9B, 0x1FE76C0BD0E301C9, 0xA695393D65FEA3C7, 0x021BD98B8F6FC2C8 },
+        { 0x24ED97EFF8A902B6, 0xF0726B03970702AE, 0x7EF11CAD58B63D31, 0xAE1BE12B74E72A08, 0x972BD4252E1BDE96, 0x3AA26539CFF6112A, 0x5598A9B452E1D789, 0x87E3326C1C26CC90 },
+        { 0xA639CB1DADDCB1EA, 0xE345B9BA5B7763D1, 0x264F32D03B507A3B, 0x87F09B53F89A00D5, 0x639426D7FD8DDA30, 0x86D85E6042CD59FB, 0x8BBFE0DB45B48090, 0x899BA06019DB888E },
+        { 0x56EE9CC8ED2CF4F5, 0xE52B7ACD706957B9, 0x2901545E1716E7DE, 0x570A3CE332E44D76, 0xA7FCF5D8389CC3D3, 0x98E02F7719607B1B, 0x22D57F4D865C4507, 0xB471474F067B45C4 },
+        { 0x064ED803EBC5008A, 0xC4797733500F7009, 0x1C6FE64547CACE76, 0xACA66C1AB202FE4A, 0x3FC641CE16692F02, 0x8EA4853CEA3BC91C, 0x5262D06736F3B254, 0xE41EDE930CCBF080 },
+        { 0x929F31D7B35410AB, 0xEE44DC18922EBD08, 0x8D71A380AC4C219A, 0xD5AC9672B4A5156A, 0x643ED3DC7EB290A8, 0xE3DD1E8C1C7FC372, 0x617DFBEC3A405ADB, 0x1965A1326C2C1BA4 },
+        { 0xFE856A279DFB64BC, 0x93C6AA63768CD745, 0xDBA712676A6C0690, 0x671F22AB539C69C0, 0xE481A5D46583CF0D, 0xA8B8BF1ACB5B7107, 0xD3EBE997EF59AE94, 0x129EEE1B45EB8A58 },
+        { 0xD7155AC290076507, 0x282FDF52EE25BBD0, 0x5FDFB9295E8737A7, 0x88B2B27BDFD5FC9A, 0xA640EEC18CA79598, 0x558CE57CA3CC3DA2, 0x62D56663D85F76A0, 0xEF3E2D8C36BAE8F5 },
+        { 0x60C404773AF5A1AD, 0xE6F626DD5B4553F8, 0x667B67BDF40DC610, 0x59E95F355711F40F, 0x6F637A49CF925BA7, 0x783452DC09EB9BE6, 0xDC96B9BAA28140F6, 0xF86F7804AFE58E9B },
+    },
+    {   // 2^140·G
+        { 0xAF352E7FAA8B5D6D, 0x65A09EFFA85A4115, 0x2F1BBBB1BBA73800, 0xFA563D192E30C20D, 0xD170F48831CC2211, 0x5F6BD812ACFE0007, 0xBA0D9D835B742CDF, 0x43C56DA24A0FFF6E },
+        { 0x273CE471BE14DD53, 0x161264D8C6CEFBAB, 0x3C626C2B8D94C369, 0x95A83A7E5472262F, 0x06C228CDC0DA8D00, 0x1B0D4CF76AC8BD90, 0x2C62752C6B6717A2, 0xB2B03BBB65A7DEA5 },
+        { 0x8DA71A4031640A59, 0x4173D64407E843C5, 0xF9E173DFE991B2F0, 0x6383D9C8755A8ED4, 0x72DC08302D2DB9A0, 0x4A6F61B842D0095E, 0xD68F3877AAEF740F, 0xA4DD677E40F60184 },
+        { 0x30CA374E4F536059, 0xBC4A84759F5981D5, 0xD0959D3B068451D3, 0x51A57592120C4502, 0xDBDF49D437E21F94, 0x552A91C7FD2A5313, 0x008C122D577AEF93, 0x583DB63D1EA8584A },
+        { 0x0D2008928878FF00, 0x51AD6B4F06BA05EC, 0xD4B2F05062EB80E7, 0x0668B6741EE47257, 0x8021A2B19E1303E3, 0x55E75C7193AEFFAC, 0x8176DDCA9F114A47, 0xC57EB42277934ADB },
+        { 0xE16FB0E348D90DC5, 0x63B6A2EDFC4DB411, 0x3F02138208D2FA84, 0x807E6D4E08E1BEC9, 0x36EA4817580571DA, 0xD80F73DFB1C53D46, 0x0811D27AEB8BD1E0, 0x18CEA70472F18B00 },
+        { 0x129D819DDB0EB92F, 0xF43E9FF2B52FFD04, 0x33FE019FC1D6BB2C, 0x7EFAEAD9C3F4EAAE, 0x67590D94CBEEB19F, 0x9B11BEDA6BFB9AAB, 0xCC87B4E6FE37C5B9, 0x7F00133D26C5C9A4 },
+        { 0x8F87AA85856A1FF9, 0x8D5919D0266B42CB, 0x230CD605A3C7F08B, 0x7E65C7D353C3488D, 0x1FD6B143690312DE, 0x46DA922B22AC95F1, 0x2342B43ADE639535, 0xDE9C0A1A076883F3 },
+        { 0xF6E7C1547BA01A55, 0xB2A7C5CD775C334C, 0x6376D3EE89DCE245, 0xA9862CB0C9887708, 0x082ABC6E12D32499, 0x85C902DD31909B98, 0x09E8056EB189D732, 0xD215388B9E94C87E },
+        { 0x279D727623B13E6D, 0x98C6559611D34021, 0x235230FAA244AE21, 0x86265B2109645ED7, 0xB47BEB50193BECE2, 0xEBEDC1804FE39901, 0x3F44108F18001609, 0xD02D08EBD00DDFF8 },
+        { 0x996BBA3C2AF85DA3, 0xFDE9AEE9E62DEF56, 0xADFD9B6992E3F8AB, 0x7ACBDD770883806B, 0x54EB6BFACE173E76, 0x89DC723F76BBC643, 0xB97CEEA9BE228E2C, 0x3193F928015F7360 },
+        { 0xA9B3196DCF15E839, 0x3DA139741CE7B5EE, 0xB1AF99E4841F2CA1, 0x8FE2A5C89B407CF1, 0x1E54BA9951B000DD, 0xA2A9B49297E4C59B, 0x285052C4EF3C00E0, 0x05F4A350020A8E1F },
+        { 0xCC0EADF6E836F836, 0xF06516B4A528253C, 0x3781C2F892C3DBB7, 0x8967B24976368A74, 0x4DA1FF2C91CBD747, 0x3E5D1F3989041874, 0xC662EF72208AD945, 0x9A3C0CF9E24C50E2 },
+        { 0x9949981D594A6EB0, 0x13E0B5BF4A621838, 0x67362E9DA6E93DD1, 0x89A6DF70D100FD73, 0x17015FD427D70E25, 0x28F6B222BAB8B54D, 0x1DF8675FDDD93CE7, 0xCB7D9ABE093826FC },
+        { 0xEDAB3409F31FA492, 0x82D72065E6F07EEB, 0x5134DB8852C2573A, 0x79AAF1E9BA063109, 0x520976EB851E5F60, 0x17B991B89CC9CBE7, 0x2BF7753BE1EBC516, 0xBAD99CC67CCBEEFD },
+        { 0xC148E1E8D659D888, 0xAFA9AFEC3C4F6855, 0x940D27C0F654BE0B, 0x457F494FF0B67803, 0xD82D605965336877, 0xF0CCDC3D32C6DD3C, 0x748B3CF80FEFC9B5, 0xFA8F57707C1B01CF },
+    },
+    {   // 2^145·G
+        { 0x367FDE4141A343CE, 0xB1B932409A6C4F24, 0x204218453911E128, 0x982295AFE9C5698B, 0x634C3C14821E578C, 0xA70197B023A501CA, 0xC239F3196849921E, 0xCCF6B6247C8B030C },
+        { 0x28C5A27849A84E93, 0x34A1A9E85D8F8E3B, 0x4743B46CDD5CAFF1, 0xC3E8943269DF5215, 0x19347096E4EC78E7, 0x901FC8BDF1BE1A2B, 0x265337D60231EFBC, 0x3962F80E26BBF4CF },
+        { 0x82C757400C8C7CC4, 0xE77F1DC074B4BD23, 0xEACEF2CD0997C63C, 0xEC63A55E5C9292A8, 0x4F90A50C2721E1A1, 0x95D2D0A27BFB1EAA, 0xB54064FA54BCBFEE, 0x1B0D49993081D506 },
+        { 0xA35DF7A5B33F8015, 0x3060B130E3860E44, 0x3E8F4DC3AF9A745B, 0x8E828BA1E38FC46A, 0x98781B5FBE6F622D, 0x58D563EE175CB474, 0x40CD85D6E5067DE6, 0x5D6298C976CBB7D6 },
+        { 0x8FD6F37A8CAAD9DF, 0x19E4404E1649B089, 0x0A102D29053F4F61, 0x4782F4A7D89DA380, 0x5963451F926D8232, 0xEC7E31D53632C670, 0xAD52FA7AE8532254, 0xB470C262133F657F },
+        { 0x750B95D294E7632D, 0xF1B964E35D8725D6, 0xD31D1F69605CE857, 0xCD1E2ACE24DCD8DA, 0xB63A6E1228DE0724, 0x185CB465F56AFEC0, 0xF788A2900B78A3FD, 0x408A72E89AF4D709 },
+        { 0xF1F092B4C39A5060, 0x00DE3784A5B4E862, 0x71A5C5AB598B2CA6, 0x207889E43678018A, 0xD0FFACDBB0E01BB7, 0x6F3839EC5B4E2FAF, 0x6681CEF892EF4FDC, 0xF8409472B86970E4 },
+        { 0x05674759C9577439, 0x411AE1015C834416, 0x74DDD92C372C078C, 0x66B4C2E8025B6717, 0xD2ABDFB4B2DC3C05, 0x97C4C47CFF7F6BEA, 0x5527DAA745F9F7B7, 0xAE06FC3E501E8F74 },
+        { 0x89A771B06A17A588, 0x81D69F253F7CC41F, 0xACD884C266118AE4, 0xAC1EA70676873CB2, 0xF53E2B46BDBAC912, 0x2811CA3FFC0F2762, 0x347FBC3584A7C2D8, 0xB10AED0167070C77 },
+        { 0xBC5ADBC4EA4D64FC, 0xED0BA739945D975D, 0x43AEC39C9034D879, 0xC3C87B57B7380A70, 0x9C26A847AF220D5E, 0x026DEBBFC8339C0E, 0xAC4CCF362833B88D, 0x57EA2E7A9E6257D5 },
+        { 0x5789DF7757C8FC4B, 0x82BF90B9EFBDCB85, 0x450371F74ED30E07, 0xA96CBC0904EF57CF, 0x5418F4642595FEA5, 0xBA2AD73BEDA1DD57, 0x5E1897DDE2D931BE, 0x33A34BF286A0837F },
+        { 0x0E69EB6FEAAF7446, 0x69FFF3611E5C628D, 0xC14A8F37059BA4DC, 0x6F90DD2E1DD9CE7A, 0x7348F1755895ACB2, 0x723ED4A77771835E, 0xB45F484755B1D5F5, 0x40ED62CE88931AED },
+        { 0x7583C7482A3964D7, 0x8351F2100D77214D, 0xFC94EF3EF611BCF0, 0x85A67D61DD88C32B, 0xD929AC2272F142C3, 0x23C1DA0FB5EE7761, 0xADD7C2A83A9913DC, 0x26AE807A691CE8C9 },
+        { 0xAA499DC53F7949D6, 0x5A075E1F074BE86F, 0xFAE74003E5DA2050, 0x92DF03266178A012, 0x3A88B440B0BFF162, 0x5179C690B4959903, 0xB266139ACEB7CED5, 0xDEA9BBAFC141B1D6 },
+        { 0xF520B7374E565F5E, 0x3B9361B4F75D25CF, 0xEEC5DF85042F1165, 0x5ECC8BA003B46F2D, 0x70CA0DCBC7CD7DEB, 0x2A0300AA20CD62E6, 0x1AAB9E0C9C1D711B, 0xD3E2C2F631C3E007 },
+        { 0x2CD325A40F80EFDF, 0xF2DA15853D106245, 0xC5FABEEAD66324B7, 0x367670AF2F602772, 0x99CE8C9EE55D9F67, 0xA29B8377A708A449, 0x5725D79D73251D6F, 0xE8E3A87CC59FC27E },
+    },
+    {   // 2^150·G
+        { 0x75B61AA1E1607724, 0x0638FBD2AB0197E1, 0x291C3437F6AE0A9B, 0xE42F40B09A7E9098, 0x942D68FB64EBD2F6, 0x79F4240F328AEA1D, 0xE2271ABF21C8CA41, 0xDB988493B9D94647 },
+        { 0x13D069D03FB838EC, 0xE6890493587B3223, 0x38C03F8A7DAA4EC2, 0x11810327727EEA14, 0x90960451669CB4C1, 0x203611F635CE8605, 0x7A7E4D3729B3472C, 0xB469151DE6B06827 },
+        { 0x8ACA4E99D5E65686, 0x380C6DB971999663, 0xB6602CBA4EDF4EE0, 0x67B7E407FE5F53D7, 0xC9B91E583BD9828B, 0x94D5945ABC7B735B, 0xE313141BDDC61CB0, 0x64882D0E28501F9D },
+        { 0x57FD3179D844C619, 0x049A4138E289E3C4, 0x0038602C47499950, 0xA593BB360AA0197C, 0xF7178B3EDBB4200D, 0x898B360A350E74D0, 0x3C866E6B8DF19422, 0x97E7FAD195F52B3F },
+        { 0x09A0FB45D12FCA09, 0x4817F783E694827C, 0x7FE65F07FC49A54B, 0xADDDCBE74B133CA9, 0x9E097919EB83D161, 0x2DB48F93B4A8C1DC, 0x1CE10AA47C2D2E2E, 0xFE8FA98A5B86DA3C },
+        { 0x83ED108BFCAC52A6, 0xF2869E767176802E, 0x877760EEEE7EC21E, 0x690F97F36A6D8468, 0xACC7BA7ED1F71150, 0x3D5F322EC08AA009, 0x09C509B2ADFEEF88, 0x3D0843364502016B },
+        { 0x2505EFFD298A9504, 0xF741B3143A26A21E, 0x7B9A4193FF35D0D3, 0x602B0EE8F0EBFDE4, 0x4B3C5E48AD217971, 0x710943DED5F12F59, 0x2EF7053DFCA965C1, 0x794F6A6341A208D1 },
+        { 0x85891AD9DBD614F6, 0x60F87968A30BD713, 0xE6109408F45C4626, 0x35305432E113BF5E, 0xFC33B67129F46C82, 0xF231F95D98C60706, 0x7478D50B5DF11C35, 0x651BFB43C2DC51D3 },
+        { 0x42169F56E86E7F92, 0xE1836B8525052BD8, 0xCE35E2610A142B87, 0x6CA2F8BEECFE6010, 0x43F61E2842F98005, 0xD298C93EA3BD4CD3, 0x3ECC4EA51A6712F1, 0xE7530E10D280EAEF },
+        { 0x310B18560D3E88C0, 0x61C211C6FC20D696, 0x947DAF4C53AB5AEF, 0x4C070EE7DD79A175, 0x51223D36197DB300, 0x1E5650ED6B07B082, 0xAB1C4094F786A081, 0x7A4F10E47DDE5AA6 },
+        { 0xEBE9806CB4DDF828, 0x23C6A6A4EE622260, 0xB0B0DBB34C7FB713, 0x8AD6137ADC8BAE8F, 0x087240B3465A227C, 0x0A52853E34F0F892, 0x1566AE1478B1052D, 0x25F0C01A20E9F426 },
+        { 0x841FAB3049E8FE72, 0xF726F77B8D31F78F, 0xC77C0F8F7CD00BC2, 0x5C4CA30C3C9DBFA5, 0xFB03160782AF26C1, 0xBF13003A5A2E60A5, 0x68F3E9E42F6E1E2A, 0x4411D8B2AE9E79B4 },
+        { 0x5D28DB67C0DC27EA, 0xB35947EF28329EBF, 0x4172281B52F69107, 0xBE2FC2257E48A376, 0xA318ED9D809E01D1, 0x4CD82D2C0A401E40, 0xB69D59D3410117D4, 0xA0763BA336DFD337 },
+        { 0xB2D6C4A71E0CCA98, 0xC9732E3786FB04DF, 0xF659EE41568F6454, 0x06C40BB371C496C6, 0x01D696F51738A42C, 0x94CA84A11FCB560A, 0x5BFC3FFAD2001B5A, 0xB438E5BE48E4355C },
+        { 0x31BD6C32B3D42F01, 0x4B9295DCB398673F, 0xE0262B6924F8820F, 0xAF0697940A7460CC, 0xC2C0913C15246907, 0xC021E184AECCD589, 0xD28686FF295B5C8B, 0x25DE0F45F81E8608 },
+        { 0xDDD428924B1DE3C9, 0x0F3CD5139E81D010, 0xC8421AC08A07655C, 0xC7E470C8E35052D4, 0xEEC7CD958D61545D, 0x555D4F859FA9D92C, 0x85EE849B024F198B, 0xCC8F4ADE0C376BA1 },
+    },
+    {   // 2^155·G
+        { 0xEC93068E54FE6370, 0x23E8F22996689B71, 0x33740D31EB184703, 0xC84F773116418155, 0xBD0BA404052C2C4F, 0xD6C051C1EB21B54D, 0x0AC0DD54E06261F1, 0x380245F267754403 },
+        { 0xD5CCC0D981C86105, 0xEF38207FB6B53C9C, 0xC3E2DB630EFA6C87, 0x1C1CCC2C1BC04C8E, 0x0FE21E302194D8B9, 0xD2BFCAD02E6BDA28, 0x4574300CBB38CE15, 0x867F16A835ADD5FC },
+        { 0x83DF23153143E04B, 0x22A99125C73C5A6D, 0x051C91517FE3DE04, 0x13652A71D7E1CD45, 0xAB078084FEAF04B6, 0xA2C9B439282CA036, 0x7907EC117F87202E, 0x3BE8C40A15315DC0 },
+        { 0x57284699A4B29D76, 0xC5EA66E93BCDB658, 0xA92D621E1B324485, 0x84479B39CD5EA278, 0xD6E4DDCBD3C649AA, 0xAAACDB7A319656BC, 0x77D5568B1B583F6D, 0x4B7BA20C8E54693B },
+        { 0x6BB6F6172283E05E, 0xB012EAB6321C6EC8, 0xAC641D597D9019C6, 0x4D648D043A4E8748, 0xA2375339001B9CF9, 0xADA4648D8D0DC3E4, 0x4004D12B0A0D1DD4, 0xD20387E8759A524F },
+        { 0x60D978CFFA081E3C, 0x5BE06F645D693A06, 0x1ABDEAA0F3301E9D, 0x19DD54B112BA50D6, 0x52BB9528E5223894, 0x635070FC469A8AD2, 0x411EB7511019AE17, 0xA915001FA159AABF },
+        { 0xE71234EB70D03AC1, 0x96391244C1FFDA3A, 0xE579EFE1283B4825, 0x977EF1846832E63E, 0xACF7B77D1581A80B, 0x0019B7D5E2D2A3E5, 0xD75E868876250920, 0x44F83A7EF51F6857 },
+        { 0xB89EA0457C6314EE, 0x004930C7E3715FAA, 0x88B448D351F918FD, 0x5F482CC1D901B1AB, 0x572760107BBDDFD7, 0x069B90304AFACAC1, 0x9A99682B54885287, 0x1FACD5BE2F1294A4 },
+        { 0x60E0790A9B3DA320, 0xA67155461566FEDD, 0x5CAF6098EEC644C5, 0x1914E48B07B150B3, 0xADE8B48FED8D64F5, 0x5D74E9475606486F, 0xCA12E488D1EEB59D, 0x6B629604A35B37DD },
+        { 0xC9CDECDA07B309D4, 0xDDD7BF8D522FF68D, 0xFE2CF92627FC261B, 0x70C9254F57F2C2B8, 0x4A9FCEF9888B9FE6, 0x275C57AB6D6CF167, 0x94FBE062E3CE1366, 0xBB4942007C21EAEF },
+        { 0x1B4C0AABD9DCE0E6, 0x3DDDEFED24E17F00, 0x0503C6B53BE8A126, 0x120B2A2D8C1E66F8, 0xA270580C86A13E81, 0x5413D15B09D76D7D, 0xBAF4727DB5FF2980, 0x44FDD143D20DA814 },
+        { 0xE780D292154B61F9, 0x09CB12287223E34F, 0x9659F13221C95D23, 0x76B190E0510767D3, 0x445230143F70843B, 0x55E06D8CFD13F0AF, 0x9F7EC0FFF5C0B64C, 0xED3FA8BEEEC7C975 },
+        { 0x10B6F17CC0FB80A9, 0x021A31935B546561, 0x4A0CE2FFDA185806, 0x646A4A57FB11C849, 0x336EFF842BB4D613, 0x91076D5A5E281E69, 0x95AC47D63002F6B2, 0xA689C31C90AD9F20 },
+        { 0xF6BBBFCBE32DA0A7, 0xAD9F8998D9B0B659, 0xBA0DCDE66A3FA571, 0x084D1FC4236BA76C, 0x1E7B0AB173823E0B, 0x27FF05523D74EA43, 0xC2A9DA8BE6390EF4, 0x881F2154179089F3 },
+        { 0xBA293F02B7EC7C31, 0x9E775A56163D60BA, 0x889964209259BB1A, 0x5F09CA6197469BF4, 0x3C0D6198A8D17284, 0xF4B04E61F5F3D83B, 0x660E196E4102DDED, 0xAD30C74FEFD8DAEC },
+        { 0x14EAA0CF6ECB1240, 0xA6E2D477FA834EBE, 0x6A3E5AA64F39ECA3, 0x0B2A5E0080311D4D, 0xC2EF7569F975BD24, 0xDAE2A608EB817861, 0xB78CF43BAD00BAEF, 0x75F0F5B5E494B67F },
+    },
+    {   // 2^160·G
+        { 0x834DBFF6678337EE, 0xC607E811FEF0785A, 0xAAEFC62BE30A298B, 0xEB5CA335326AFAD3, 0x9774FE1384AF54A8, 0xCA4B6EF5785388B4, 0x1346C82D66F6C642, 0xEDCC0C2AAA2D53CE },
+        { 0x5D020728BD7D86FC, 0xD15BA07E713C1AC8, 0x7B8A85468316AA0B, 0xDE53BF4A0921C5D3, 0x3BACF926314274B1, 0xAA6473F0E489A20E, 0x1A35B2266183F440, 0x27E38367373832AB },
+        { 0x423066E6CB7C5AF7, 0x6D4AA104EF0DDDE1, 0xB50E24F20C0FA712, 0x14BD6AAEEEC4E1F2, 0x4C835329EFFF35E1, 0xBCF4BAEA96E851FA, 0x9A0F11623885B71D, 0x166707A74E19411F },
+        { 0x9B708568BB21CB79, 0x31493B87821D5C5B, 0x22F8418DDC2DD569, 0x992028FEDD061736, 0xD942C46B5191D9FF, 0x2BF067DF5511345D, 0x277E70715AA2E38C, 0xC4D3DD2C649895CF },
+        { 0xED0B054915382916, 0xED71547E28B9726B, 0xDD8D0423D588F46F, 0xB49596F9186BB489, 0x7B0BB2912E6E0AD0, 0xB6E3A6B5AAEBCA7C, 0x5D47BC7C5EC4CCC5, 0x615B74D006BCEE76 },
+        { 0x31E2D107846C72CF, 0x5196826A7C06EB69, 0xCAA792D5214B5B92, 0xE58BD074BB238A83, 0x3280C94E3325797E, 0x3BB4EDCE17974073, 0x2E0B3F5245CC5177, 0x23267F698E609923 },
+        { 0x221B517530317642, 0xACF0AFCD376D30C3, 0x08FB0BFC4B86F3E5, 0x747ADD2F86CD7C23, 0x7CBBAD6FE3E36CF6, 0xCBB66FD9A266E57C, 0x8DC9DC9D0D111B28, 0x031C17CB5D40A944 },
+        { 0xEF2B546422529F8F, 0xCB6CF3FE2A406BB9, 0x6566FFBB8D4EE8A2, 0xFD6508248A7F8A5F, 0xC06FE2D06B12A423, 0x197F3B8AD3DC4452, 0x9C61281388D05818, 0x261FF495F9228B2D },
+        { 0x0CB9235B41FA84E9, 0xCA99E159AE43E247, 0x48C713975061CD6E, 0x71278A093B84C968, 0x9CCADB3CFAAA12FF, 0x63CDD416FA1AF8AB, 0xDBC255D0E5AB5A5D, 0xED3136643F942F1E },
+        { 0x4E7F38D77FE247D2, 0xCB16934588AC9393, 0x1752E6F5C995B0A8, 0xC2BCD27F864EEF35, 0xC549ED814286E7B2, 0x3AEF8B12E5EE7EF8, 0xFE1E048B7BCF26AF, 0xB95ADE8441AB150D },
+        { 0x06712352C34318D7, 0x9585BBD9A27819B1, 0x290A347F8D7FA655, 0xAF0AEBC1DC20798A, 0x11D7E55A47627250, 0x5816F7D327B5CEA0, 0x4719B3B7D732D136, 0xA0B4BFBDA2519DB6 },
+        { 0xA5444030FAEDE6D3, 0xF0422412D517829E, 0xEB14C0D39EE9045A, 0x0C301AB47FDB44A2, 0xACA2EE4E6786F072, 0x1D87032D2F334582, 0x345FE5516C32F166, 0x74EE80AE0EBD7960 },
+        { 0xC9498001208B83D3, 0x6199028C8200F975, 0x711E5A0ED13FF0C5, 0x1F0285A9D183CC30, 0xF29675CD0A36ECD7, 0xB7CB5BDBBF4D666F, 0xD7875F55618FD235, 0xECDA9EF68C587561 },
+        { 0xA09B100821FA66CD, 0xF1EEC9F3886384AB, 0xFA208374DD80459C, 0x8E24516C85106C37, 0x572CD306A60CEFD9, 0x096F95AAA9517214, 0xF17697EC1A00392E, 0x17139C3BF7FBB785 },
+        { 0x6145626A9C4BB00B, 0xEF80302AB5DD292D, 0xF8D0111620FE7FAF, 0x9432A0D5EFEB4ED0, 0x2FE0A22DB22026D3, 0x8AC10FD791AE09EA, 0xF18E48939D42342C, 0x72AF9BD2482DD5C9 },
+        { 0x369E1B4A84BD8B30, 0xC2D183E647DAE27D, 0xAB9E0DC9D338469B, 0x7316B2E32CAC88EE, 0xD806BCB9524B211D, 0xCDDD2192951440D8, 0x77686FAFD0D7E10B, 0x791A76820F073947 },
+    },
+    {   // 2^165·G
+        { 0x7ADF1F6EEC0B49B7, 0xBFFF9310AD564CE3, 0xC5D423F9CEC8D505, 0x90987A8E587FFFB1, 0xE8544F0024AD27EF, 0xFB62130B397E7EFD, 0x588431F2B1F447A9, 0xEAD0C17A8556DA90 },
+        { 0x90F8CBB98CAB0737, 0x8D31BF010DD8C27A, 0x838957587A699C17, 0xFE82EE34A90F81BA, 0x1A7FFC5B3CE35282, 0x4F9067D32D68682E, 0xAC6378EEBED261C1, 0xB53F7C37A66C25F0 },
+        { 0x3DF0F25015AB3776, 0x447726F0BC89A254, 0x76AAB70446686F13, 0x455EB6627069F6A9, 0xDC176E711899564C, 0x33FA15BD2502985A, 0x1748FAD6AE8BD8C6, 0x0985B152F1ADC870 },
+        { 0xE88D875B109C6C53, 0xBD931DF445B0D3D4, 0xFC2894CA22EDCC5C, 0x1066A5577207BE0D, 0x37F816803F972D9F, 0x175FD13B5AE6BDFE, 0x1DC7E6B9D06D4917, 0xB323F50957F4F1B6 },
+        { 0x8DB7A8C58B51AD60, 0x90C63570900A5202, 0x791EABD3231D89A5, 0x67707F8BD5CFE98B, 0xD62625BAEB7E0E79, 0x9E50E0C8412D2988, 0x865051D0BAF851E4, 0xB4BFED79B5B42E77 },
+        { 0x0A8F37164860F65F, 0xEFB6452C64904B45, 0x6557F7F62B25352E, 0x61BA0C3226C8903F, 0x106C4995082C1B62, 0x7A3C800AC5E60B73, 0x856B9DB20AF3B7E6, 0xFFB207A8A159459A },
+        { 0x80A40E6FD7E27AE1, 0x0EE24A1AFB16F00C, 0x790FA8B36CF44643, 0xB9B7A5064D7C9F1B, 0x5AF4575657A064C3, 0x2EEBD4AEAFC2F63F, 0x483EF5FAE736043B, 0xEC8CEBC39DFC5D83 },
+        { 0x33BBEBD0D3ADA097, 0x5205A6935C907305, 0x6E57FCED62B9229C, 0xCE324D1751532A18, 0xD78D5087705A7604, 0xB5B8F7F449410DE4, 0x6DD23AEB9848885B, 0xCE9832A911BF9C1C },
+        { 0xB45162E4A7F13540, 0x7EB559FFBE9BD181, 0xCD63BBBAF66DA167, 0x985D8BEA5763E1AB, 0x174741AE508D9021, 0x9E6AB22123A54C3A, 0x36BA518A469EBD03, 0x89897F42633CD7A2 },
+        { 0x61EE777B2DEB3591, 0xA22827828CE635E6, 0xF90A35D237BE8A42, 0x527D194AA4E1B679, 0xF8B8FB827AB48012, 0x5241AEDD3C2D395F, 0x5640E0BDFE4E01AF, 0x78C97D7E71CBFF4E },
+        { 0xA1B4B6EE120AEB4A, 0x7E81B7A0CF379010, 0x93058161ABF973CB, 0x5418C91F2C887E1E, 0xD7A970952A8013CE, 0x6CB6FC8DF53F8AFF, 0x32AB1305EF5B9309, 0xF111A7FCBAB81433 },
+        { 0x61AB55D226EA18DC, 0x70EF969BE20D962A, 0x93305F85F154685D, 0x253B0F29C041B48B, 0x9D70933A9B9470B9, 0x40DF74EE896F0B3B, 0x9B76BFCE46734D71, 0x0810237C69CEE5E3 },
+        { 0x958DF713A3CE0BE0, 0xEC71AAF33D21F41C, 0x68CEE6838F17E162, 0xD898B8DE610BEBDE, 0x2D0AF15A9140C365, 0x8C76B80AD5416C2A, 0xA47EB04DE463465D, 0x12823384E0B1B3D5 },
+        { 0x2B9E1652715DDD13, 0xA836C57106046EE0, 0x5BC0381443E26F15, 0xA88F295A03656DD9, 0x3C1BCC63E6FD214E, 0x8B489FEAFB95A248, 0x228C9C9502EA3566, 0xC4F0F7F690B41057 },
+        { 0x1DD4E3BEAFC7E79F, 0x7AD483C15C9F3D93, 0x2D51AC2B495FF5CE, 0x26548866C0A095E5, 0x1888676FC8D80B98, 0x3943F339C7130489, 0x7E04A82025C75442, 0x3F6D61B050A9DDE5 },
+        { 0x77A7CA76BCCFFA66, 0x03BCD35942B1DB95, 0x6D4E94AE2C53F1F9, 0xB55318CA0D6C7BCC, 0xA850D6F58F0C71B2, 0xA3FC41D4BDA6B36D, 0x2DE2BB56314149CC, 0x0CC5C9A837AC2234 },
+    },
+    {   // 2^170·G
+        { 0xE563507A4A5C9E86, 0x3ED469FA90A3F7DA, 0xD9C1A904DFACBE50, 0xD3A9F9728EC1396E, 0xDAA67A58D9402A08, 0xA936ADEF62506D6A, 0xB9C19D615875A3DC, 0x61DF4BC427D24570 },
+        { 0x1818DA646B991B5F, 0x1FBD9E0F443A754C, 0x35D89ED5C436EADB, 0x00EE6B980B1385BC, 0x8C6C19977EB7CCC7, 0x7E068D39593EFCD6, 0xD94A26E618FD5C51, 0xE260CA63B5BF5457 },
+        { 0x8968EED57DDB53B3, 0xC5FD7D554CA0DFDD, 0x7D5F742A14E3FCF8, 0x600DFF0CBCA7D7C9, 0x1DB48658AFEC558C, 0xD8FE267F0D81688C, 0xCE4E4241375C6041, 0x80CDA5842B710CFC },
+        { 0x6653ADD72D8EC8B6, 0xC795382CA0E89B03, 0xC7E90AA5879493B5, 0x1D3B725757785553, 0xEAAB684CA4840157, 0x45489CDC127B0482, 0x0EEADE98DD6C5878, 0x076C2DDACA695FD3 },
+        { 0xD2172CC2FCD4B978, 0x9E4B1DD4CC9B2E47, 0x22C291C567A73BE2, 0x02E5919C4B3D36A7, 0x397FF3A415816D88, 0x490A83C41B04F0B9, 0x2CF2BDFD24CC53AC, 0x7D788D4942D22778 },
+        { 0xF70870C8079586C2, 0xD30BB2A77B7668C0, 0x8474CF4BFE5B6907, 0xFB437A3A78BBE41A, 0x3831D80C7292A47B, 0x20D68F0C570243BA, 0xB16843E72F1B6101, 0xE1BDE562F3617838 },
+        { 0xC484B8F1319DCBF5, 0x0770593606C406D3, 0x961FD507F6CBF4B3, 0x0DB98C3E6489DC33, 0x10D06B153C864857, 0xED4E4CFB17304D88, 0xF7DA72B989AC2076, 0x28194504B2130379 },
+        { 0x79865CE5F95CDD7E, 0x2FE876EE23E0AFE2, 0x85A0CBC260E2A112, 0xB4572A6B95BA6774, 0xD76A575AF98EF0DA, 0xBE7FD58E4019FADA, 0x9E31546F4480EB77, 0x2207255C4DA78544 },
+        { 0x48A538FBB3052BBB, 0x1CCCC3140A0DD8A5, 0x197544019FBF8294, 0x11C44DAE5B97DEB3, 0xD75E7D364A9F85D9, 0x17119F6D11E845EA, 0xC7377EBC4F4F57D3, 0xE5F5A3E4EC0E66FB },
+        { 0xD41757CF32472A2D, 0x523626F8A1C26B2D, 0x18921B9DF745480C, 0x8BEE769EBA287457, 0xCB27D05B0B352E39, 0xB1C3D655D7F11FFA, 0x9B2F3EA4D84D19DE, 0x6DC61172E8AF0E56 },
+        { 0xF8598D9996740FE8, 0xAF1D4AF39CFF83BD, 0x882532CF59669BE9, 0x36E54D04713113C1, 0x3F3AF394A1142C38, 0xADB98C08A17A5DE4, 0xC067884114ADD3C1, 0x5E4C1634ECBC83DC },
+        { 0x460E3E4AF7013D7C, 0xD6F79548BDCB19F7, 0xC6B41CC483A5C1F5, 0x42C6E10799029743, 0x3657222AC4D5251E, 0xEBCAF6B8B38EABF1, 0x980E92EAA8082F31, 0xDFC1D11ACEF82D97 },
+        { 0xFB26B5713F484A47, 0xE44AA02589A4BE16, 0xE6E8A6477F730028, 0x31A49B99B889F50F, 0x8F6B8F39C1E6CA22, 0xFB02CD89BC28609C, 0x63E17473A9FBF162, 0xD0A72354C5BFC2FA },
+        { 0x6DBE6A02B4A57BFB, 0xC3F8BF3AF89B1525, 0x80FF15C53E327172, 0x76D2A6FA659D042F, 0xA9AB3383A2F794EE, 0x81112970ABD546ED, 0x81E209E9E200EE84, 0x65C9CB20DA4F7126 },
+        { 0x23F2E72DBCF41418, 0x7C2C7501FA1B0759, 0xF6B780A85CFED843, 0x111C5C642993AC2F, 0x11604A9C9DC9C293, 0xFCC32E0E41FF9852, 0xD352C549219BD47C, 0xA8D0DD877CCF98E8 },
+        { 0x83247DA4D7C91444, 0x8BCDF605D4DFE8D2, 0xF659006120C57E8B, 0xB602840C48C2A29F, 0x436D6D528EBC98A0, 0xEEEC330AD6122438, 0x11CDD0F92E5EA03C, 0x06F80872A9DF0544 },
+    },
+    {   // 2^175·G
+        { 0x8DE3F0666F2C9BAA, 0xD61F2EC1B94964A3, 0x73449D5B8808E1AD, 0xC45B5423F0653260, 0xF3E85D462518BD75, 0x284C2D5849A27E7F, 0xE7271E78C92AAB81, 0xE80F69CC31528559 },
+        { 0xA383B727AE451951, 0x158DEB0BC21B0548, 0xFB67DD059AF6DB0E, 0x676DC3C7FFDA84D0, 0xD31A17368EBCA7A0, 0xF26D6ADC3A8626BE, 0x972DD2AC7FF9E6F0, 0x6C9D3BA2C27CBCD7 },
+        { 0x9C47D1E225F0CF9E, 0x3553E013E0B5C119, 0x9D8402ACF9BDFD6D, 0x0645F0DC3FA5C7B6, 0x26E48AA15EE184F2, 0x60B3FB638696A0E7, 0x8D6160D155D02268, 0x54A87788B6322337 },
+        { 0x13C650C3C7C29490, 0xACDAC68726D51D68, 0x177C6233B3BFB914, 0xBDAAF0A45A1C982D, 0xCD27487BCD2F4BCB, 0x5205FB392E894AAC, 0x023526C80E67B73E, 0xD6834CEC99DD2659 },
+        { 0x15ABA3661D6F550D, 0x12E3BCE7C3E58BB3, 0x43BFA18C56EC4C2B, 0x2AB1B44EC776C5CD, 0xFD3D18085BAC03DD, 0xE0A2DC87A3F455BD, 0x2BE4CC2ADAEC2CD1, 0xDD0685CED80037D0 },
+        { 0xD9B2406C9679AF9F, 0x15324F760CE9E6BB, 0x216C4D2AC83EA8BB, 0xE924BCA7112CBB53, 0x6ED540F3D306AB63, 0xE0E3448583930B92, 0xEA3248741306A93E, 0x86D7B9D7111DF8CE },
+        { 0x1B886C36FB3506AA, 0x0BD2F125ED353A23, 0x581DDE1E59AC98D8, 0xA8F4FFCE6034E15C, 0x9F4583E95F6E263B, 0x6DA4DFDE967776FF, 0x3585480C2179D0D0, 0x0048B4ABB6D1B71B },
+        { 0xF247AEB09391BB3F, 0xF85045B7E1B333BA, 0xCCD2AEE061BE7C6B, 0x4EAD247FA0EAB9EB, 0x74E684E7147ACA18, 0x9D9E719F92F35AF6, 0x914A4C8DD33D8DDB, 0x6055D33905E5E6CC },
+        { 0x5E9F5D2F89FC47A5, 0x8D2DFB2221D8FE30, 0xC36B3C5CB12F9AC1, 0x80630781C918F2F4, 0x0100DEEF597D8373, 0xE4061F1507683FBB, 0x8C15C865A9B37237, 0x4AD8116D9EDD2BCC },
+        { 0x2013574CBA147DD7, 0x78596C4907C36424, 0x2AF05660E4BD85CA, 0x636A1BACCDB03669, 0x206354272EA7C267, 0xDAA7897DD770DA16, 0xF679AB388417D8DD, 0xEAF93E289826A65C },
+        { 0x40E272EAD9FA0767, 0x296B567AB6FA1EE0, 0xE51EF1AC823EDD07, 0x06E67AE2BDAFEBBC, 0x255101BCA5FFEC96, 0xC3AE27F71809FD22, 0x97F295B35A838551, 0xF89F0F327F6E1143 },
+        { 0x57155461D6798E7D, 0xC074DF2AE7C3BA7A, 0x8B963403382F8955, 0xADC080421E15886E, 0xA7D3BF09A8CEDC54, 0x91DA1ACD0A533AE0, 0xA17402A208A6EAD5, 0x9297642281EC663E },
+        { 0xA833DEE3F7B42537, 0x6C29BAB0EFA88407, 0x05E78263610F0826, 0x24A0AB6FBC0C3236, 0x197BE17E0850E5FE, 0x6765D80C1700F36A, 0xE139680916F8CAA8, 0xB4AAEEBFB1BE182C },
+        { 0x8D5B84C5F506A40F, 0x570DD9CF420A96C5, 0x360967640670C12A, 0xF22BF5831A43DED3, 0x229589FCB54680C1, 0x4AB1BDA01A02A5C8, 0x7338B3F9F61FCAF7, 0xBB1492365643A3FC },
+        { 0x0119F1DDA20D3531, 0x6AD33CE3BA6D88BA, 0x05E6755B84553110, 0x604D5B0CD07037A5, 0xB0EB2C40AA80D7AC, 0x1671E21BCAD4F038, 0x0B708467347C77FD, 0xF2F3B7A2660949FA },
+        { 0x72E4A5FC97992E2E, 0xA0CE1AB50CF8ACC0, 0x4FBF370397FEE989, 0x196848A85E7D2743, 0x96E553BFAA3C456C, 0xB95AC9EB272E72DD, 0xDB9D54F1CE3E97FC, 0xAF6429B49D8DD770 },
+    },
+    {   // 2^180·G
+        { 0x138A4D1A8C366226, 0x147B1C72102E0468, 0xAEFE97255FEA946C, 0xAC66B96111BAAE83, 0x5D9F2078E454286E, 0x8F8E053574D650F5, 0x90D24265E998A42E, 0x8FB6390B553579E6 },
+        { 0x0BE4505DB5E8D56E, 0x4B7D8A274D9475AA, 0x0E1DF4606BA3F943, 0x8C743A37694180CA, 0x95079FD1EC2E10BD, 0xF2F2CA5DB9BD2D39, 0x6B451A304BFC8DBB, 0x61C0A15A7D616855 },
+        { 0x9B383A7E90D0D662, 0x20F5B0F910EB2BBC, 0x7DEED4083E4F4EBA, 0x6B4870849E7F292F, 0x6A1D957C7C08E6ED, 0x737AE55672417C64, 0x42D218E8433375E4, 0xCA8FEBF1CBE0F3D1 },
+        { 0xA7849D04EACA6DE5, 0x24C04BA701CDB49F, 0x06488D7FDFC00779, 0x9DC7E03065A80961, 0x296F1CC01B4FD5F8, 0xE0789F8DCD13E149, 0x1BE70CAB6119A011, 0x680ED3B4C15903EF },
+        { 0xB8C83ECCAE0633B0, 0x5B9BFC7EF4FCC118, 0x6E920F33BD31D9EB, 0x181CC425C7F44999, 0xEEA5B29B2A38F61E, 0x24E0D3F28A5FAF99, 0x5A091873A0BF9A77, 0xD09865C8A2DFA6B2 },
+        { 0x73C6200B8A1A585A, 0x563ECE8855C224A8, 0xEB0A0040EDEA7EFB, 0xB2A2413D768D7D76, 0xA651F857C7CD14D1, 0xCDD0417468A3AE62, 0x0C1B4B5DEB592ABD, 0xD63FEDA402A0FBB3 },
+        { 0x2378082B1AE861C7, 0xE84685174AE5E3C0, 0x1F05368123D194BC, 0xC6BE55029B5C5214, 0xA68EE1BD0028DF68, 0x1BDF8086E0945A96, 0xBEF6757F8747A107, 0x4C6B7675E8F464DB },
+        { 0x452AD8B66741C79B, 0xD0AE9D941A26CD7B, 0x8FDDBB4473334631, 0x9EC7A45E5982A62D, 0xB388E4222C02F4FF, 0xAEC63A9998E91BC4, 0x1D78F06AB0C9EA18, 0x6CD2C23C240B0C3F },
+        { 0xAE426B1BB786F1AE, 0xC85CE499B13EC12F, 0xA31A7F2E01BD92A6, 0xE32ADDF20B96E21C, 0x57AE8A165071C8A2, 0x19FAA9E0C20ACA96, 0xB6060E2A8408071F, 0xC0BE3D74710C3CEA },
+        { 0x48665755DF659341, 0x4B0994F87793E175, 0x9FBBFDCD67D56EAF, 0x2C42DAF1B154F072, 0xFF2F64FA9471101F, 0x3EADF80E70D234ED, 0xF3D54FD68784C6E6, 0x0D48D8AD7D3AE08C },
+        { 0x1F289100094B2E49, 0x5B362E522BDB0A9B, 0x25D5E31355BD4CC5, 0x209EB20A3E8CAA6D, 0x939CA142B4D54F0B, 0xE163A5076842C893, 0xEF8123F64B4AC12C, 0xFF69FEE965317939 },
+        { 0xE25478B0788438FD, 0x1C10A41127A608E1, 0xE9564F0B87B813AA, 0x154E9ABDB78C1DBF, 0xC82FA9BBEB5D9F33, 0xEDD535E614CAC700, 0xF8B280F8A06E7155, 0x5F432CB2EF81C5D1 },
+        { 0x0732D78826BB1C5F, 0x49EE8FDF46A48577, 0xF0953BC8C12BD837, 0x435147B9AE342765, 0x0AAE601B37198677, 0x35AA1222838FD8E6, 0x8009AFF21DAB264B, 0x424BF945C11DCC38 },
+        { 0x83CB690D9FA56A32, 0x156532BABE9A13C5, 0xF406D7B161DF0623, 0xF61ED9E04092DD4E, 0xA5B3DCEF436D7CC2, 0x1E21EB94750E37EB, 0x64B6BD5F35B11003, 0x001642BBA6D7D7A8 },
+        { 0x8708F4A84D3F6104, 0xEBE792DC516F5FF7, 0xF34C0BF9605DFB4E, 0x23B0406227E8FB0E, 0xD8D1B79223EC745C, 0x0A8575D7F2CD6137, 0x159F897E8C2AD3F5, 0x22DAED5B7014A57B },
+        { 0x458926D5457E5000, 0x85FED94F28573781, 0x69DB451E4A0CC2FA, 0x76D62B3D60E50D41, 0xA30C4E0340703BA2, 0x952C4CE589DBECE4, 0x20903900C0BD539F, 0x44CD287A4A167F61 },
+    },
+    {   // 2^185·G
+        { 0x7725CF740490E669, 0xCB58C73F4C575843, 0x4E44152901CC6310, 0xBA982DF20859E203, 0x392A81C3D34D6B1F, 0x814C5F88B1E6070A, 0xAAF3DDFF045056EF, 0xCB8953E509890774 },
+        { 0xC08D1F429C441D62, 0x56B7D209CAC1A3B5, 0x59ADC69C2D70501F, 0xDBB3B04B7F3ED2E7, 0x42C3D3BA4DD8234C, 0x98A0B5617C1969BB, 0x0AECD08F2CF1EC0F, 0x8653D196E94F0369 },
+        { 0x834015CD5198F21E, 0x447111CE5AE64215, 0x6F11401BFEA88AA2, 0xFFE75C4113BAFE86, 0xE2B48F7A200A42E5, 0x839DACD4288D1F5A, 0xD9444C95740475AC, 0xDD14E1D1EA3E6462 },
+        { 0x7957CB49D2D19E37, 0xF9617FB72AF823D6, 0xA7E332751050048D, 0x395596B56C51A5A7, 0x6083C6557DE3A2A4, 0x5257008061CC54F7, 0x0D689AC705D3154B, 0xF827966FCC134117 },
+        { 0xBA8A1B4DB0A1307B, 0xB744D84063A767A0, 0xEDBBC5D4445DE18C, 0x5432DA547D5F95BA, 0x9608786C271EC975, 0x2E3285837BAA917B, 0x869BA079B4987AAF, 0x5C16BF24EBF099EC },
+        { 0x0CEFE020A7454197, 0xD1252BDEC7B475CE, 0x0B9738A5E2C37A20, 0x0C83C66D0CA05F2F, 0x5FF2DDF364CF8A8F, 0x4343CCE75A1AC5AC, 0x8372369347FE36A0, 0x17FF4DE73F32A507 },
+        { 0xEC1727216E724B85, 0x8C38C1A29E6396D0, 0xC7DB58A979EAE9D5, 0x093F44F74A79471B, 0x332F317B801A95ED, 0x7EA31F1D689E4600, 0x9075B51DB8571F7B, 0x56905F2879BA787A },
+        { 0xBF367946F8DB52A4, 0xE97732EF63196670, 0xD6B550DB7C1E4D14, 0x5F9589B006D2E775, 0x48E2533301AF5F8A, 0x8AAE0060BD237052, 0x41E8CEF9C466DA00, 0x0F266246047C0F12 },
+        { 0xCD447B5BFF31F6DB, 0x3F977E5E48AFF7B9, 0x05DBEC11BD7AE285, 0xB8DF878A9C0C7DA9, 0xC4FF5B7BD7197E22, 0x28B26465DC31ED7D, 0xEAEFD22FD2EA3C56, 0x22CCF70CD9567FF1 },
+        { 0x95CBE58E42520BB7, 0xAAAC4FC762C86AAA, 0xCF1074DE23E51112, 0x0D920833A729EB0F, 0x6AF154E74E8B135C, 0xA97A2DD50D5B516C, 0xA2D039A4A918E042, 0xEC813189D2C95D4F },
+        { 0xD4E09513C51D3E6A, 0xCBBE3BA832D4DC6C, 0x2ECBE4CD103A903A, 0x0AF9D12360C1AB56, 0xBCE89100ADD7F40C, 0xFE0121C129F00B9A, 0x59C371EB5A539B62, 0x367526E5824A9238 },
+        { 0xEB7498D5A36A7C9D, 0x028B055DBD84C86A, 0x9C1BCBC63D311D1D, 0x8E0DAF51ECD1EDDA, 0x8B66511E0B6CAEC3, 0x8D870F8462E282BD, 0x7828AC68282ABA19, 0xCF23C72043F337A0 },
+        { 0xFBAEBF4B9E1A0CC6, 0x2E5B8046A170B020, 0x56E40559A96580F3, 0x5AFD166CDEAE5618, 0xBC03F598B2BCCF26, 0x7131809D54FDC324, 0x978DC5A70C305539, 0xE68F942DD8CCB778 },
+        { 0xC03EF9A49D8B9E0A, 0xDF42CB1EFF347366, 0xA3C92515CB7F4E0F, 0xDF0464E286E5F1C0, 0x3F73DB78018BDC6F, 0xE5F943807BD3A23F, 0x8C235211DF0994CF, 0x2CFE072A4E8BDEA2 },
+        { 0x5C88078224ADB34E, 0x63984819EDB72568, 0xB92397EC15B63AB2, 0x0F867FF3FE5846D6, 0xC37A596E39B13B5E, 0xE6A376CBC02C1804, 0xF8E312C5E9F281F0, 0x9C38A8541F50F2E1 },
+        { 0xB9DE59FB8ECD911F, 0xBB95C8D7732B567D, 0x86438156C29305F9, 0x82E32B80D2514700, 0x4BD94CF9C669A45F, 0x5AB5B7CB35A8BABF, 0x9C5B36FD20C00862, 0xD0554B39A8F40DDA },
+    },
+    {   // 2^190·G
+        { 0xDEE2B5D838DC9D2B, 0x5A05142D558C2991, 0xC2392C9BB4F9D5C1, 0x50C02EF42C3FF462, 0x783E01B44917E215, 0xD602419CC153CB99, 0xDD932AAB20C898E8, 0xDF10D6AA0959AD3A },
+        { 0x47918A2A0769603A, 0x4547F51B7FB424AE, 0xB33BE6D28027942E, 0x8E44B22119DC78B0, 0x54F950241FEC7316, 0x9246C6DBE38825C4, 0x3483B15A04262936, 0x563CA7BCE7202412 },
+        { 0xA4FB25FBD5DDAE4A, 0x3AF0F9C8111D687F, 0x30A4C27759086409, 0x01BF6468FD42CDAA, 0x1218CB8B6994C03F, 0xC8C34133D34D5EA0, 0x85609A1A73A4F847, 0x27066B039CB8CEDA },
+        { 0x54D9DD00FF538035, 0x678A08383AE22FF1, 0x5012701F99FB748F, 0xA58AD5EAFCB03970, 0x51976281A0FDA4C7, 0x99C16CDD95E7D456, 0x35190E0CC1CCB1AD, 0xCEB137BAF3162059 },
+        { 0x909DF7BCDD6ECEB5, 0x79CEFD6E63ECB04B, 0x1893F402EC944ED6, 0xD14FE58984C3D8F1, 0x3FDB68386396769D, 0xF82BA6E6AFFF1A91, 0x5881006677A86536, 0x07F9396173FE2AC4 },
+        { 0x38DB9E220A2F4CB9, 0x8FA7913A0F6B1F2C, 0x6E3292BE4CDAE295, 0xAF708F4E621727BC, 0x433AE8799CF425FD, 0x927803319D7FCD7F, 0xD761091D9BEFB495, 0x4AF811C5B54D4823 },
+        { 0x1F7EAD3D94A58D45, 0xF3A0781491AE611C, 0x40F6A6E8A4FBF279, 0xB75E7261B2586CB1, 0xDE7B6477BF738AE9, 0x1078C2626BAA33F7, 0xB9DFCE76742474BB, 0x8E5453D3D1AD3CE7 },
+        { 0xE853DF7344B9CC6F, 0x1CCD6F3AF753747B, 0x224B9C272E057BD8, 0xE44956082D721C19, 0x4FE4C67025C3197A, 0x5218BD83912333C4, 0x1EB25D34A5EEC172, 0xCF5485EF5540BFDC },
+        { 0x150AB8F5BE02D342, 0x32E7C17872F6C287, 0x68BC9FEE677A66FB, 0x4F8FF9CE15F7F875, 0xF7E8942CF208E87C, 0xDD6D083A37A402B2, 0x2E488C84CF69FD45, 0x3C6D060979B6F4EA },
+        { 0x0134988457C9AFE5, 0x86941A6F631ABEE1, 0x92929B36263DB746, 0xEE840E665DAE9781, 0x739F3F4963BFCBC0, 0xE13F31710A533976, 0xDE6651EF54973B19, 0x07E10A32C5486737 },
+        { 0x74BB570B667CAE28, 0x59D75AE326275A82, 0x01CCB955FE3A916C, 0x8DDE84EDD043C26E, 0xE89CDF85E9F04F7D, 0xF236AC3D85C5101C, 0xBCDBDE983D52BDAA, 0xBA5DD44FABFEF471 },
+        { 0x5A6D7D59A057F5A2, 0xECFBAD0977924315, 0x7167E50C1609ABB6, 0xDB3544D98B3958EB, 0x56FE73A9D9833BA4, 0xD25F9EAEA0B87D36, 0xDB133C743CECD95D, 0xBF4061A733AFEF90 },
+        { 0xBCFD77E732F12FE3, 0x8E199BB16FAC05E8, 0xDF15B3D13EBBFE5F, 0x63061B6620A9AA67, 0x84E1F0657E6DD042, 0x2B65472961EAB628, 0xA4C684DAD1B6882E, 0xF666FEB64F84078D },
+        { 0xC92E18BF9A863716, 0x7485417FED6FDC88, 0x8293D6959B4F1AD0, 0xE4A1DC80E91CC9CD, 0x56520259B01D3568, 0x54AC12C94B90B144, 0x66D4D9F4C3239126, 0x1B415C0CF334C69D },
+        { 0xC1F7A2FBE295795E, 0x43FA97635D00AE70, 0x1CBD1D3032BFA8EB, 0x40EC92E9408343FA, 0x57C5C7292A3A2F38, 0xAE5086E0230B87BD, 0x5CE9D14D6AF67040, 0xD1EA456518EA859C },
+        { 0xDD533DD9A9D543E6, 0xB568F178C361E238, 0x759BB68D01889D56, 0x649825376832C836, 0x4CAC87D4F86A714C, 0xE0B273F15E77434E, 0xDC0FAA6C97624150, 0x1B8447C8FDF9EBEE },
+    },
+    {   // 2^195·G
+        { 0x870D9541158C9176, 0x769F45E17527D450, 0xA74509D7328F6DE2, 0x6BAE6F172AE5297F, 0xBAECE7117891400F, 0x191F2080E989523D, 0xE5BF7D9851A2C974, 0x507C65E03B7DE2D6 },
+        { 0xB0EE8E87939C0DC0, 0xFBBE1111AC50CBF0, 0xB73663A5C09328E8, 0x3479B3C2B9B83324, 0x47EA9590BDFC6A52, 0x215B1A58397A980D, 0xB960B40E4D453D6E, 0x48F8036F37A5F313 },
+        { 0xEC19DD6CDD423BFA, 0xD2CEF2C12552FC65, 0xB4E2F036E4ADD7DC, 0x1CA87755C6DB3231, 0x7FBD7CBCE56ACC93, 0x960D4B4AB8959775, 0xA7398542D36068B4, 0xD7040B66FD0057D7 },
+        { 0x5AF0DF1289D0E48F, 0xC851CF5CBC4CE0B9, 0xB039E21B260DEF5A, 0xDB915088BAE00294, 0x90A875849F005FD0, 0x216E2FAC1C859DA7, 0x95B7031F134469DD, 0x660C5100A280D466 },
+        { 0x808382B0B9BFDE29, 0xF110E3E298971C57, 0x2C12E65E5C359F44, 0x750F21DB8DC849E0, 0xA6036536DF854AF6, 0xF5096A448D108C7C, 0xDF91F300D48A2133, 0x88B0876FBAEFB5C6 },
+        { 0xB17AF92889A84D36, 0x8BB41B3A81768E0A, 0x4B4A60E09C16DFCE, 0x6F82165AF73F76FE, 0xEF28729CD3131BE1, 0x2E2E6B3467EF084D, 0x034EBA547990F823, 0xC7E9FF1731B0FACE },
+        { 0x1A73236CBA236611, 0xC50E1C1338FDC6D2, 0x3E676C15AB5BACF8, 0x0A13A19241FC80DF, 0x98B39A2DA38DE97B, 0xECFF5A4F94D07F67, 0x502A193DA0FE8A8A, 0xDCBA794AD7CB47D7 },
+        { 0xD5E1B83119E35D3E, 0x49A459B8E91F0E3F, 0x8B36DE1C045386FD, 0x6C1A7BBEB803F2BF, 0xAC3696F05E24D9B9, 0xD56C41879E52A0A8, 0xF1188C1C5D640E4E, 0x70F6B11EBCE4C7CB },
+        { 0xA912A95ED9285F0C, 0xF127C60CE343BD86, 0xF6DD5A34FDBDEF49, 0x735A23B9A57A5FFF, 0x2BAF471C81515DDB, 0xEE3500E0532D6DF4, 0xFE093F860F193143, 0xF6E9C62B5B347205 },
+        { 0xA107B55E2E15DEB2, 0x89A8653D8070C4B2, 0x27A00795381198D1, 0xE842780D7CF406D6, 0xA05AF3D6F2AE3110, 0x874A4A5442978569, 0xCB283B2826A350B7, 0xB3A34521C47005B6 },
+        { 0xB3DBC3D93E875C10, 0xA55AF470429455EC, 0x26EA48A9A533FBE5, 0x03BC4BB30BEA7531, 0x6FA557845602C634, 0xFB790AC11B09BEF6, 0xD7B00D2ADDEEC181, 0x1D7EF2BCAAA182EC },
+        { 0xA24B4E7EB62F81EA, 0x9FEAE875867D079A, 0x22C2F6554FB1F052, 0xE44B6B16DF285E74, 0x76C4981976EBA103, 0xB2E660A177A1B405, 0x6765BC0744443970, 0x1ADB8CE12C39FFE0 },
+        { 0xA486C12923A46F8C, 0x6D14147F822FC06D, 0xB1685C72147A28E8, 0xAA83F0CE41F43423, 0x9725EE6CC0A2A926, 0x836085DD3014CF05, 0x3D2223A0977CCEFB, 0x4360915E79383583 },
+        { 0xCDAE6D6CCC43B15B, 0xC4BA5A3DDEA54E1F, 0x99E2B599CA42092E, 0x7A8A32283309B008, 0x5A0EA54020C0A459, 0x02DB74B093DC5E5E, 0xB28C6C32D5FB07C4, 0x56A6B5B384E75D15 },
+        { 0xB82CA378956C1673, 0x2830D7F787FCA139, 0xFE96BCF4D7D2AB68, 0x45A7018A030B7EE3, 0x836A637E366416BD, 0x9AA6A0DE17C80088, 0x5578CEEEB2E9F332, 0xEF71F48296B7068E },
+        { 0xC6898E3CA143D8A6, 0x94F41DF2677B8CF8, 0x2816C04F2838F793, 0x300D2137C9E52AC1, 0xA2B5820E482887A2, 0x1FCFDB00FECF0E83, 0xC6DC035B1EFF5CF5, 0x9A66E973C2A50111 },
+    },
+    {   // 2^200·G
+        { 0x6BA80D6D9E595BEF, 0xBF74E3A2DCEA2B33, 0x6CAF1DEFAF37AEC3, 0x05FB7D6F85A9D77E, 0x6324953A900B2D09, 0xB41D83E7132852E7, 0x1E1DD0E57108C827, 0xEE4AFCB8F9F4EBB0 },
+        { 0x697BBFDC594FA341, 0x360F0F6280B4E319, 0xC417B8B41AA1502D, 0xB0C70506AFCBACF9, 0x2EBB284C2F7F32A2, 0x08E9D3878C44042D, 0x1DBA1D5347E2FAFF, 0x3E15B1C1438709E1 },
+        { 0x66D0F0B8ADB1B594, 0xD73A91265710164E, 0x44F7E33EE7DE32AC, 0x97C0C025B33E1902, 0x2954C3CDD11CC6FB, 0xD5CB87117B75347C, 0x0EB11501D2585808, 0xBE7587E40C17E2F5 },
+        { 0xE397DC97E31F18FE, 0xA9D27661D2B7098B, 0x1B57D7BEB4DAB663, 0x3DCFFC0011459CD3, 0x968CCC7975670966, 0xB1110A7E0778599A, 0x0392AF40057FE183, 0x01136010174BF091 },
+        { 0x71D9ED185CBF8EE1, 0xE87CF67567F0AB1E, 0x9262EAD9284D7808, 0x2CB5D43CD596A7B8, 0x5FEF752A106E3EAF, 0x18060962E036100C, 0xD6CBD3AE55B346DF, 0x0A2EF6708035FC5A },
+        { 0x2262D86765467952, 0x5EE71BD0C12AE50A, 0x17A82729FCC74A77, 0xAB3774283B961F61, 0x9AAC1588549837E4, 0xBFA9C930DB51210D, 0xAF140F711BB37D3D, 0x00929A771E94853B },
+        { 0x9428D2611C978D99, 0x97CC5F8FAF299830, 0x3CDF07DA75870ABB, 0xA5076D9CAACA215B, 0x2E01D129C157ACA8, 0xEB4870BEC5A157F0, 0x01CC4C5F5E615A08, 0xA1790F82CAC8AFFC },
+        { 0x4B9410948D5E136B, 0x574B9AAD45E34A96, 0x9EC281430D14C61F, 0xAA0D009E0D893D73, 0xAAAD5BF3A355E88A, 0x138B3F41B169C060, 0x0460703DDCFBC08D, 0x86F7D7C990072AD1 },
+        { 0x2077225973C19257, 0x3FA0008A78B59D74, 0x1BCF59341E13C65D, 0x51CA4DA47B61B55E, 0x47C19AFC9603C0B3, 0x5BA14DE8D485B715, 0x3CCD7164ED35E57C, 0xFB77018D829E711C },
+        { 0x6FE3556135384EA8, 0xAD089435B3320BB5, 0xF1A1863876AB5200, 0x90F87630152EEC81, 0x2BE5EAF04AF33DDA, 0x5DA11256B39E9539, 0x385634C5F66B956C, 0x84E8DF37503E1FD9 },
+        { 0x4131B5B06290358B, 0x85CC3AB76FA87388, 0xCA017932CBB7778F, 0x0C94E0DCC0D8B2D5, 0x36374AC1D45D1BFB, 0x5FFCEB267182F45B, 0x02624993B4FE8022, 0x3F05BAF855FC313A },
+        { 0x4135EC1A2F0B17AB, 0x778593414BF40793, 0x6AF7214224BFD27C, 0xD307526D9139380D, 0x4D29F65DC1AB9C76, 0x65A9DC5AFE3C159F, 0x29C8CEF9E24C2646, 0xD4BC9355A2287256 },
+        { 0x89072BAD58AA6FDC, 0x9D8329821DB69F78, 0xBEC9701D31174300, 0x7CAF2E14E5FAA0B8, 0x3BEDA2C3B3AE8A47, 0xC1EDABC8E44AC9A0, 0x1C6971F03D250493, 0x19AF641011B39386 },
+        { 0x40D0E3BB2B49F922, 0x9084C0A8EAF63362, 0x5CCFEE1B98DF32BA, 0xD2E3EA2A37F0FD67, 0xE9BE4A66E542CFE5, 0x42C4DF27B443C8DC, 0x0AF533EB454BB47F, 0x684F114B5E0D2C0A },
+        { 0x5C7317918E592810, 0x212B5DC5C8D87C68, 0x2C1E6CD6E0BB127E, 0xC2103E097B708A7D, 0xC3084EEDDBB20E43, 0x061A9159FC390D92, 0x7F3F1498C5022245, 0xDA19F6BC9FA1E420 },
+        { 0x534AF0489194B5B9, 0x5BD021701CF0FB60, 0xAEB421979D02745B, 0x8C3A8F28184B18D3, 0x615990D325528F71, 0x77D61F56EF48DAB6, 0x121B39ECDD0FCB2D, 0x86B73FD8AD7D4BF6 },
+    },
+    {   // 2^205·G
+        { 0xDCD8ADE86269454B, 0xEB7CA8D2FE4974D3, 0x7AD07DD231B7B389, 0x817B19EC11AA92A1, 0xB5ADA6E94FCC0DC7, 0x1833B9BDCD69D646, 0x6F7908B696EF6F69, 0x5E5816F77DFF6CF8 },
+        { 0xAEE8F09C8F05EA07, 0x596AA430EBEED2CA, 0xFBF67DDB9F061E4B, 0xB8F4B112569E9FF0, 0x19579D5A908CA61A, 0x1EE4E2714E04E371, 0x341ABAB6E1667C4A, 0x886DBC62A9E95F26 },
+        { 0x1647E46DCE394B19, 0x218AAE56B7E15B4F, 0x001B9C655AD7CD50, 0xCF9A95ECE9AB6E9A, 0x44F0BC945369C81D, 0xBF743CC9E195663D, 0xC0F806F1DD906BAD, 0xD8DBD59384217DDE },
+        { 0xAD30333392C9F417, 0x6B2D7FBA9F09604B, 0x9E3DDC5CBE2CBF08, 0x55C3D2F1464D096B, 0x307CBB8246BF8DCD, 0x3730B0F1012EB0D5, 0x0C8393A4D48895A9, 0xB117032D9C0DBD50 },
+        { 0x7A3B452821537BEA, 0x6F200D12D122CCFC, 0xBAC06E12D4B2A8C1, 0xE0655F619845B0B5, 0x4DA92F161F9B18A6, 0xB6B8614069337A93, 0xF8F38399E9EAED18, 0x647D69EA46AE093E },
+        { 0x62E1EA612894CA74, 0xCECB2BD9288A9BD8, 0xEB652560954CFE35, 0x4A084BA4508E11C6, 0x8ADF26562AFE72D5, 0xD94BE8DAD8831C8C, 0x5FB2C7756C8D8FF5, 0x40462D0245C4C3A8 },
+        { 0x1992096773F3C4BD, 0x92B07E86FEF20209, 0x0E29091489EA912C, 0x742BA761ED8CE08B, 0x14AF35FDF600FFA6, 0x99DE8C0B3CD18C53, 0x8CBA1AC1E88D233F, 0x5A16B062A934928D },
+        { 0x00D15B282B61E4AE, 0x16ED09FABB0004E3, 0x52F2FFC99EC18A3E, 0xFB9F7B39871A700A, 0x3CFAF8C95E096128, 0x42499B7380CADDDF, 0x54D9A3F5E982A8E8, 0xE762828E85C32F10 },
+        { 0xBE1DFABF979DE201, 0xD561968838F8A97A, 0x0952F4878934E2F4, 0x832FE7ED56F5E6C0, 0x830DBEE0CEF5B5D9, 0x04667E78E947CF81, 0x6314E17871F2188F, 0x50F6ACED5ED4C1CB },
+        { 0x4A76949CF55A3F72, 0xF82348CBB584D1CA, 0x8894FDF71A3B7830, 0x5205C1490E5A38EA, 0xFE09DD5206FFA66F, 0x3859C7BC8650F53E, 0xD94DB8A66F9B6FCA, 0x0BAEF4C06837AD77 },
+        { 0x21142CF25E919F07, 0x9014A5060CC35828, 0x8BC7BC7D3C2FC6F7, 0xCB1531CB332A3E57, 0x8AC6E4F41DCB7BBD, 0x83579EAEF6002A58, 0xF762D9A77940CAD1, 0xF6E53AF9E9D4909C },
+        { 0x1864E083D3530AF7, 0x584BE1EE0E4D8342, 0xF89A56160C2F834F, 0x130FA795D2AC7A82, 0x8DD77E7F31C18743, 0x20E4E0D9D90BC221, 0x29AB25A418E7C2BE, 0x9D28A72AA15C9451 },
+        { 0x6BFB521443A7F28D, 0x495C5A663274C111, 0xC482FFA0BA7A3C4B, 0x26B9F199DA2A2309, 0x7072379C10D0671E, 0xE76393B4CEFBC9DE, 0xA6CFAF93E57E2A04, 0x7E070A43596D828E },
+        { 0x31F0469F79D80DD3, 0x5F3E84D59C2F318B, 0x8A73013C018B1AEE, 0x578C67368D35DBFB, 0xFA517705B2897FE7, 0x606B7A83C180E603, 0x4613DAEF9B20413D, 0x48B1567CD1F88C2B },
+        { 0xBD8B84A6CD1D5CA6, 0xFC41E23C6DA00370, 0x4CD1D18509E2C78C, 0x67203CF7766AEE99, 0x89D4F4051E77B62C, 0x701A21F184739454, 0x54EB6D4D45674C89, 0x2BF8E63B0200755C },
+        { 0x9EE4A5AF053513AA, 0x00DED85A846EA76F, 0x4AB31611D23E55EC, 0x3A7108F5CE4D87BF, 0x59FA915AC4076F54, 0x0B8E5B5140CB2B15, 0x3B279F95C8ECC3D7, 0x563C4CDC51D1ABFE },
+    },
+    {   // 2^210·G
+        { 0xDA3FD31EACB4C0BE, 0x6C4897A56975E65B, 0xCE21BA7B2F3782CD, 0x87FEECC2B2FB1245, 0x20EDF5AA560D4A58, 0x0BEDFB01609CDE9E, 0x2EC53F5943829DC3, 0x01FA61EEBD049076 },
+        { 0x9B8CC6650616D74D, 0x38E6432CE39488EC, 0xB19C9EF2AE396DDB, 0xB240E3A5BFA3D7B1, 0x3C2E79D6D1AF706D, 0xF3DDF33A537353A5, 0x2F70B6A05B16BBFA, 0xC3277C04CD96252C },
+        { 0x22003CCFB7DF4AFA, 0x6FE17AED18A1EEF5, 0x8B4D08C3A7B01BF7, 0x97441D7435875EEC, 0xB1C09EC91A0DBB15, 0xD1224B3004B77C71, 0x337AE492F4DCB3B6, 0x979F3C259B268CC0 },
+        { 0xB185073AD4EE70E9, 0x5303CF55725CC965, 0xD02BAE7F388F29CD, 0xEF6C95D804001C34, 0xD08F063051125A7E, 0xBD16DB472737AB4B, 0x9B4A2C87F779A94D, 0x3BCD4E2C70023B97 },
+        { 0xA39AC2BDECF5A35B, 0x5C584231369EDAF7, 0xF14CAEF9EAD95F57, 0x7A1FE266D14FF9E5, 0x2FFA4AA05DD20078, 0xFC1640C5F8AD649F, 0xC2C842B7CA977417, 0xB8F6F8BED57D1787 },
+        { 0xD413A38EB3333DE7, 0xAF2665B565A8EFE7, 0xC7EDCC1879A55733, 0x8EFCC1A446668E9F, 0x9A505F0EAB1AC263, 0xB158989A9B5CD50D, 0xE531FE0D9C6F3093, 0xF2CE8F9CBEE3B7A1 },
+        { 0xC4286C611347A206, 0xBA757CE138460497, 0x16C7F4E4106A1BBF, 0xC7944DB997763BE8, 0x0F82326A0E08580C, 0x4BB0DAA0A7928719, 0x5372C25318AC2DA3, 0x3C499E8DB4091448 },
+        { 0xE05AB2F5DF16E74E, 0x7BAADDFA1548D180, 0xFB783D7474D89A33, 0x2CFA83C5A876F786, 0xB6873B3E0ADB43F3, 0x80F2E14096F518A0, 0x1E62C8ADA3ED7C29, 0x9AFA34AC874B131F },
+        { 0x67EEE9E82B5605E9, 0x858F5B24945A88BD, 0x22915E49FE42C35A, 0x776ED5D365290CBD, 0xE2F5B20A25C5B7B8, 0xED5CBCC0E4F7C8B7, 0xF46ACF4DACE016F9, 0x4DEDBBE548F230DD },
+        { 0xFDA298673AC05F6B, 0xFA37E9F5351A0D0B, 0x3A6A0E3A9EE687EA, 0x877F92C95AA3079B, 0xC81DD4ED48F9A625, 0x741EED7861AEF93B, 0x2DCDB8A805578A59, 0x458D27F03B58ADC1 },
+        { 0xCBEBCA317C508F8D, 0x18E901268FE63A44, 0x99B51BBCFF6315B6, 0x5C2517277008524E, 0xA95A2DEE52129A65, 0x69219CAA898B34B1, 0x5A6DC81CD41157F2, 0xBF939234128EE31F },
+        { 0x492A438492FB034E, 0xC43C3FC1C583DD06, 0x56ADE41C5FCDD732, 0x14CB33EFBA06863E, 0x86C7EE1AD9DB42F8, 0xEABBB93F5D15060A, 0xC5D1D11D33BEC8BC, 0x671E6AA0A3A17B93 },
+        { 0x9FB75E4A22E38677, 0xD3A559B66E7D61EC, 0xF8DC074C7E0E08B7, 0x200350B52F2BD6EF, 0xFAA9877213A52229, 0xCE77A2D78791FCA8, 0xC78E9F6DAA775BFC, 0xA08CE0A4EB935900 },
+        { 0xE8BFCEFB5D732D25, 0x34FFFECAF92EB30B, 0x8220F7D787D1B84A, 0xAB38B08D772A57C0, 0x40A859994765C098, 0x8F3F26BA662F79F4, 0x0037DCC078B2C32D, 0xD0B5A5E8F03668B4 },
+        { 0x5C6C5A2D85065882, 0x7B109BB09655DEBF, 0x56BACC5BC5DB2767, 0xEF8BABAB6935664C, 0x1EB15C0BEE6C8B37, 0x258B0C1BF2B5BBB4, 0xD95CCAD6FA92715D, 0x9577EE75B742CEE6 },
+        { 0x5E7C667E7890CD9A, 0xF3EFA39B825DC8D9, 0x3982E744260A5BFA, 0xEA9A954644A2C3A2, 0x79C9828626CBB23B, 0x89AFBE946EC766F5, 0xF3C829AAEABA4732, 0x7BC93A3F35DCD86E },
+    },
+    {   // 2^215·G
+        { 0xF8E996C937040556, 0x965AB458322FDCB2, 0x4A21D0A2B9411D1D, 0x20DC3A017E6B3E61, 0x143A57F20804D010, 0x0D18F09A537888A1, 0x085914296F7CEEF0, 0x2BD03EEC6509D5F1 },
+        { 0x16C324193BD97756, 0x5C2E1BB51B96D097, 0xC5450825B45F97F9, 0xAE2A3ABF9F84252A, 0xDDB3146F30580080, 0xA99623C7414A8188, 0xF4FC249918FB2DF7, 0x45FEE240DCF8289F },
+        { 0xAC5E8C88851CA5C9, 0x0BE3B3A25F31D97B, 0x2E7D1DE0D38C6991, 0x5720FB649FE78546, 0x4F9CB5FC276C910E, 0x5498E9F6947DBAF4, 0x663396F38E145F17, 0x012DD38DACEFF217 },
+        { 0xE4B87A281FBB56FE, 0x25D8A66488C73556, 0x07F954D63CF1037A, 0x9DA9EE4E93444681, 0xDBB7DEFF81D3411F, 0xD2F9A7B0476DA17C, 0x144546EF9082D6B3, 0x043CE595EB37333C },
+        { 0xF36E4746CC7B98B6, 0xFF81EEB394B3776A, 0xB48ECB69DCEF0F91, 0x5039B3779572C52B, 0x1DCD45F875F46521, 0xCB654E860A4B86B4, 0xF06C74EC2DCBDB6F, 0x351410EA4F20ABEF },
+        { 0x6C4BA7B3AB0A8672, 0xF62FF65A2B076DA1, 0x560C77F73169BA39, 0x920A74A4CFA1441A, 0x99D949DD88BB9540, 0xD8168556D73C1169, 0x934D0269C6780B32, 0x66F9A282A09DED95 },
+        { 0xB47A05EFF353ABB3, 0xCC165D28DCDB90AA, 0x7EF9C2806B524924, 0xB8C7B8C007487659, 0x6807F2EE761D09AE, 0x15719D29716DC6FD, 0xBF767B3ED42A5A51, 0xB7550DC6879B3E66 },
+        { 0xA83B87ECA5ADE53F, 0x0055FDA36AADEADE, 0x0DE7B8D1AC1EBA3C, 0xCC37B080CC27F6B9, 0x49AABC0A455E0894, 0xE8BAE88E0D060B53, 0xC3E59C02726B4D3E, 0x034C9D789602F298 },
+        { 0xBFB8A4BC53E5D36B, 0xC1C8BBB22AD37157, 0xDE0F3BCD858C9ED1, 0xB3A8A5617519850C, 0x336BF9D4D0179848, 0x82C4C960A3478FBD, 0x14E8585D32D1935C, 0x389EA93CD2E0DC2C },
+        { 0xF3D7EBDF70C37EEB, 0x5269589F130DB034, 0xEC4EB25AADB33704, 0x41A0317C6EAEB594, 0xE3F6631469C958E9, 0x9D968172E66F0E3A, 0x6780F9FA190723CE, 0x92E6A4944C913682 },
+        { 0x65F803092E61EF16, 0x58E27B88322C5CA6, 0xC7D7153E76D963C6, 0x7107027FB1103278, 0x7E46D4375DA76DE4, 0x1062192E9A97CB17, 0xAAB11BCE08E62A02, 0x95943CA28EB9D161 },
+        { 0x3BFB8B5FEFF01747, 0xCE499C8F162F05B5, 0x1FCDA69BD94207DB, 0x404F82DEEFF5BED6, 0xEB1D8A47C2CC6CCC, 0x0953ED8391D918BC, 0x647C023B5D1886D2, 0xA1946354E49768CB },
+        { 0x0B765CC7362D7CA0, 0x8201AEADFE2DC4C4, 0x1C47973696A2C269, 0xE48859C35B2FCC7D, 0xDC78D717E7DA3AE8, 0x1533003070BDB98D, 0xD8CCA47DECDD1FE4, 0x23E77972AF5B0FDC },
+        { 0x53FEEAE24A5A6F22, 0x038D180CFCCD7483, 0xB05DD88502836018, 0xEFFF262557432D7E, 0x1B6EC1FD14F747EC, 0xFFF0A30B8D821BDF, 0x0D9EA80E6F732962, 0x8E0F880A7DEDEEAD },
+        { 0x352A38CB3A04D75F, 0x5661BF97A029F405, 0xFD22DBE17EB32CE0, 0xE1DBF3A12607E516, 0x40812568AAB2745A, 0xE727E0EA74CA769A, 0xD9D3D34425E94505, 0xEEBE02F448C8F043 },
+        { 0xEDD3A6FCE7829558, 0x3B491CBC4656F5A0, 0x5E004A6A5A4BAF2A, 0xEA52FB20BEA31BB1, 0x9BBE3B6264134BCC, 0x1BFE1547CBAB6410, 0xFE2360A6D2E1877D, 0x6492C8062C85BEB1 },
+    },
+    {   // 2^220·G
+        { 0x43E595021FAA54C7, 0xC311927829447A71, 0x751CBEF4B9FD1EA7, 0xECB35D16EE4E539D, 0xE111DFD9F78ECF4F, 0x679B22875F6D1BF3, 0x9F4249E0FE378D58, 0x8563E4ED075F6430 },
+        { 0x79E4059B0AD702F4, 0x32CF27C54BE88D73, 0x3701750A39367A6A, 0xE107278EE64F3777, 0x82107D39ACF8345D, 0x7804BF75A9ABB466, 0x4B78494248485962, 0x3E06CD87B792262D },
+        { 0xB809C54D29FC4F73, 0x274EB5B328273039, 0x7FE7F99E93C2EF46, 0xD162721DBA9FF92D, 0x8921D4C29918B280, 0x03268B8D337CE637, 0x4F6417EAA2A9EBDC, 0x1D66A055D5CA69D8 },
+        { 0xFC8676950158553A, 0xE0740582315D4E2C, 0x9F9429AAA4F6359F, 0xF93BF7D8EFEA289F, 0xB7B66C63B0F6760A, 0x3A05C33CF07F8AD9, 0x46F19879C89CBB3E, 0xBA1A1535FEC0CEB3 },
+        { 0xAA3C6BB83427261A, 0x412D42EEC1C2EAAF, 0xE982B25A3C9FF0D9, 0x39E2CDA6088C4499, 0xD8D92B0E4ECADA0D, 0xC721F579E91D5C63, 0x009ECEC67E0EB399, 0xF10CF96D915FC0AD },
+        { 0x9C93D8349DB1B40F, 0x335AC00B1B54C676, 0x616516766C88F062, 0x1438B7B48DBA49C4, 0x55B7A6BA3C79EA56, 0xC77317577B714E92, 0x9ACAAC22095AD972, 0xFDDF82596867B42E },
+        { 0x05B528D0B47D19DB, 0x59FB7FD9C792BEA0, 0xE9CEE2D0A3D5DBB1, 0x586F0E6CC71B96FD, 0x5B52BAA2A3188661, 0xFB8B6AB325556DBD, 0xA9ADFE73DC0962C0, 0x905A21F9C782597C },
+        { 0x78C1D76084463259, 0xDE7C8A29CC9F3A04, 0x30ED6B9D28AF4FB9, 0x62DF82DB1FAEAE1A, 0xDF9A60F1FAB60989, 0x2DA3F791892B6536, 0x80BB450D424891AA, 0xCDE3C3EFA07A9F7B },
+        { 0x7E29F07188E7A4D7, 0xCAEBD6D3C9071AE9, 0xFF21A7F48B175102, 0x86B8335C141C43A5, 0xEDE9463F0C3A3FCE, 0x1D5C7B3A16058BF7, 0xC7B2E344593278A9, 0x97492A9A28016684 },
+        { 0x046795FBC00C15C4, 0x250040C0AF3DAB34, 0x68C3326BC412AAC4, 0x1687E655B7DFD606, 0x70146638B7AF25CE, 0x03BC327EDDB0FBF6, 0x931A45BEEF465DA7, 0x57CF0C33CCD9E648 },
+        { 0x388F7D9E347BA4A4, 0xCE5D2D3672F05711, 0x2715622A03E7B34E, 0x4586796A3E3871F3, 0xEC5A1C508BB03383, 0x17589E3A23A6DFCD, 0x515DB365FCC6EF1A, 0x4BCCD57F7346CFA6 },
+        { 0xFA493F63FA2ED86A, 0x304E50CD5835A273, 0x1EB8442230611ED0, 0xE1B47BD0E6CF74FB, 0xCA06A152FD383FBB, 0x13364DE587768854, 0xB95309D51B31C1B3, 0xDC736CE5F67A2DE6 },
+        { 0xA87071C1EBD907E0, 0x7C0F461278ED8CE2, 0x61521D68FA0130A7, 0xCB5A0F933D05331D, 0x437B1D5ACC7721A2, 0x669468B00DACD98E, 0x8E2F83CF58A2CFE5, 0xF9707F6385AAE29E },
+        { 0xF46602A610A0BED6, 0x78369FAB6C474095, 0x01A9396AB51F6443, 0x3E28AF8A211DE351, 0x6D4B711B3FC13481, 0x1A815FCB38F788F9, 0xDADA57E672851870, 0xF076B1B6BD5A3FD6 },
+        { 0xF515253F2B48AA55, 0x1EEDC8419BD6AA63, 0x3967FB2343DFE135, 0x7B20EA59DCE9B41C, 0x1510796F26FE3A97, 0xA74328A59552A63D, 0xB43587B20FAA477E, 0x633A65BE7C865F30 },
+        { 0x4F284268672227BE, 0xE29D192D604FE7B3, 0x6954A5C8D64FE549, 0xA8C0EA585F51A70F, 0x6A46CE94F1234AD8, 0xC95BBCBFEFFA5180, 0xEF573B56266CBE5D, 0x0B01738918940B50 },
+    },
+    {   // 2^225·G
+        { 0xF099E607DBEA8B56, 0x45384E961066AADE, 0xE812CE3A6E619C13, 0x4DDB9DBB5AEF9BA2, 0x306430FA89D1E30A, 0x36C524282680BEF0, 0x9AD0572140EAC595, 0x81388541730ED3CA },
+        { 0x5C4E46C6E4873662, 0x2D6E3A54A2E97A8E, 0x7871BF3FA82E4677, 0x6CCF55FD51D27779, 0x9101056D3018CF94, 0x0ECB1B58431EAD27, 0x57240D7CAD2ABEAC, 0xE311E77A16BFC4CF },
+        { 0x3199666F7304B16D, 0x486801FFB471B6E4, 0x0309E4180B375750, 0x5818A3E192B6E8DA, 0x23D0D3D6A6533245, 0x65A9785B77CC1DAD, 0xD7D3DA1059A9E09F, 0x7C0CB95463DE4933 },
+        { 0x2841414A33C27393, 0x72D07A561A685FC5, 0x494783D68E30CEAE, 0xDC58D9589104349C, 0x296B5A7E240C1970, 0x1A93083F79534BF9, 0x766B9784FECDA8EC, 0x1C512440B2BBAC11 },
+        { 0xFDAAF702046E057B, 0x34A5AEC17DBF58BD, 0xEFA12A78C1577177, 0xE7FB8CBC58B75A90, 0x30DE2F053F17C411, 0xCBA1CF8CD568C856, 0xEC2225771B9B9A66, 0xD1B0740A6E8C9962 },
+        { 0x59B73583A5C0F665, 0xD70866AC91FF1CD3, 0xCC3DD1169F7B1F9C, 0x25F51AC247C2B225, 0xF048DAFB6271FD48, 0xEC7899FB6CA75DCF, 0x93E3BFC7AC0EDBFC, 0xF7DD0B07EF3F5B1F },
+        { 0x8A80E16D8708B973, 0x1A9E476C68F4DD89, 0x8613D15CD2A271CA, 0x84B33C2DCDCD03B8, 0x095C8A49654E0005, 0xE1C4877CFC2C3678, 0x575F5945610B798D, 0xE7EA478B6C34AA16 },
+        { 0x6766061027100721, 0x888A4D27842894D0, 0x89FAEB50C0304E1E, 0x7A8384E1102C9C16, 0x0681D0BE7256DDBF, 0x8F95989EBD25CF8C, 0x9162107DBC58F3CB, 0x9F9C9F43E242E3FC },
+        { 0x1A51282269CD2012, 0xB627F55FBA10FAB4, 0x33EC0D96F74F8FB3, 0x7B34EF95636A933C, 0x0613997A7940836B, 0x8747F93575ECD08B, 0xB7B6A468727AEED0, 0xD5AD2044C756A707 },
+        { 0x13564A56F6F24410, 0x6B08FD3D98DF1E9B, 0xF404100B72799FC2, 0xB4C573429072E967, 0x2363AD90E162314E, 0xE6028B199010F2CA, 0xE1E2F78FA29A4199, 0x55946C1A97F5C6C2 },
+        { 0x695299836EBEF661, 0x357D8355852FDF49, 0x0609642EABE12212, 0x1CBA0E6948B4B37A, 0xEE65FDB9653CFCD1, 0x5A7E2AFD709BE9AB, 0xFF768F5E03C00C32, 0x76C64D874FF38DB9 },
+        { 0xEDEAD1882EE55BC8, 0xAC886F76095E37A0, 0x3C9FA4E34DF74A87, 0x2B0CED3CEB88D596, 0xD17AEDDC7E2B06FB, 0xEE80027D862AD1CA, 0x9E4E9E096A4C6E6E, 0x7FEB261CB7E906EE },
+        { 0xDD49A88E258525AD, 0x20742CADF95ABD6F, 0x396091E873BB2A41, 0xBA850DCF89C6D6CA, 0x27BA660067976236, 0x2D87DAC3FE8E3A4B, 0xD3ED4BB4DAAB95C5, 0x2CCD903D96FCAE74 },
+        { 0x23A6059B2B8D16EE, 0xF26486A658A03C0E, 0x64CE96378D313981, 0xE0D4755CF099E1DA, 0xFCD556652E4EBA0C, 0xBC87E55B0AE8E5A8, 0x5377ADE7A2BF6946, 0x777EF8251035B6AB },
+        { 0x12CB0AF2C3E39967, 0x1B28F0C321079617, 0xC4555EA30C9EC07E, 0xE78E5E6F3EE8E8A9, 0xA2012C734EC96C41, 0x5A6DB63F8C0FE25D, 0x2BE4C45CB8F49A48, 0xA3F73761A93C2C22 },
+        { 0x9980E7CC490E3460, 0x9D583C192423ECE7, 0xC4CB452FBB290438, 0x320D12D474FF5AF2, 0x1B6D16F068A309C7, 0x8D9CD5F266520731, 0xCD15E057EEF65045, 0x4972E1BC94622A87 },
+    },
+    {   // 2^230·G
+        { 0x39EAC06111BE893D, 0x63053090FB23D45C, 0x945F37FE9D2B3DBA, 0x4E6D4A186A4A021B, 0x2C29CD2F941FD695, 0x3845A49612C3F6C1, 0x8CE30F2D46F4ABFD, 0x72279B205BD83DEE },
+        { 0x36C7AC287EF8FBE4, 0x60F6E17A89441B01, 0xBC664B82D970DF38, 0xEF310C6A90F90C40, 0xE32DC9525F01207B, 0x96B7BEB6F0ECE79D, 0xE5819290148E39E5, 0x5A1D4782C194FA5F },
+        { 0xB719450CBBD5268A, 0x133B5A2D4E7C2321, 0xC7AF3CA047F067F9, 0xCE0AC1FB64927B52, 0x64BDF81A48AA00EB, 0xFE07D6F546FF6401, 0xCF1532FF157ADB27, 0xFD8381AB47D1CA6E },
+        { 0x5C37B442FF9C49D4, 0x6BBF80BAB87BF16D, 0xDB1D5A31D753C035, 0xB54EB473AB1FE93D, 0x58D4605B54962E52, 0xA2EDE285B852311E, 0xFBFC10CEDEDB17BA, 0xECD57446DDC9A13E },
+        { 0xBA7203411E44878D, 0x1A84BA443F782CC3, 0x54ABF172F017D880, 0xD5DF9ACCC2A5BD86, 0x30BED81354E6FBEC, 0xC28CB75CF37E54EF, 0xABEC03556209DBA6, 0x52D1DC2EA07BDD0B },
+        { 0xBF94A6FE30DECB12, 0x23E8A283DD677A4B, 0x710EBE88626B012D, 0xBD032EE4F49A27A6, 0x832980199A97FB9C, 0xCD0000A2195BE55E, 0xE694C00F325027E9, 0x74B560F0137D8085 },
+        { 0x8C2280741842D495, 0x8480BE85D5ADA797, 0xB399ED955712C4F1, 0x92FEE6386EEE5CA7, 0xF69E78CB18A70227, 0xEB1040F3B3F48DB8, 0xEC7E6D88B6B00DF4, 0xB9F6EE7A541D852A },
+        { 0xD74C9499DEBD89EF, 0x40B08F8A087D931A, 0xE52584D88F8ADF5F, 0x5779DD1990B6ACB7, 0x849C6B1C5B2D9905, 0x2879FCEBD4E20C4C, 0x529FDB5365B7C47D, 0x08E40305F08E6AF2 },
+        { 0xB775778919050C29, 0x36FE48965E7D517A, 0x463F771BDD9E95E0, 0x7DBE39B14EA7C635, 0x992610AC23A7990B, 0x8819F377821BE47F, 0x349A2C4B3B84BD6C, 0x4BB15E2427D11622 },
+        { 0xE794B724728DA0B5, 0x3F457CB56D462CE4, 0xA2B7397AB83DDB15, 0x78165268A0838CB0, 0x3F210B29CB52C1E0, 0x636DBD35440014B8, 0xAF1C794357379D5A, 0x860F0E4A83AC399C },
+        { 0xC68220F8A98D6D00, 0xBB4C19FF2377F15B, 0x0504B6E93F8895BB, 0xE682C7CBF9204C78, 0xCF05B86B16543157, 0x74043D71B8EB5E09, 0xA951B26080F942EF, 0x76716BC803DE0759 },
+        { 0xFF637D0C1EC482FF, 0xBB17BCA62854E008, 0x74A6C4780342B2F0, 0x363B508BCE9BE590, 0xC64B08269037CDB4, 0xD393F142773331B4, 0x8D79E8920A03F402, 0x12F7BC7A66235279 },
+        { 0x1AE12CFFD3A0A43A, 0xA85F64B3EF606A4D, 0xDA9367E71CD41DAF, 0x4A60E837D2859B44, 0x1261E1534D1D3F9A, 0xD884B35AE0272A77, 0xCAE7331BD1FF182E, 0xFE11B57B0A6AAFE7 },
+        { 0xB881C60270B86A8A, 0x4E1695BB4C3E51F4, 0x11E1728BEBCE35A8, 0x8F548B51E22AEB72, 0xC35AA1E4B8D09ACE, 0x0259AE5E2A0CE07C, 0xEEFCB8A262ABA8BD, 0x317A76B28629AA1E },
+        { 0x5B34EF6D66C346D8, 0x183D50F1D3858821, 0x84169255A2459432, 0x57ABD31DCB519812, 0x83AEE4BFF044F9E0, 0x79E56E7DF1730651, 0x27B778EBD6677208, 0xF4319CCA2E2FFA90 },
+        { 0x1E6B5739B9B7F668, 0x218EA221DAB165C6, 0xBAF7786A019ADEBD, 0x4FD52FEF0EB84328, 0x047B2261F8A9B0E0, 0x08E5557330CF54ED, 0xABE5049EEEC3FDD7, 0x8D0F713BEA12A0D4 },
+    },
+    {   // 2^235·G
+        { 0x6CBC2B983E1E1356, 0x8A1788B60C50BB85, 0x856700D0B3A6E5C4, 0x326DB9B3C0404F94, 0xF8A8B9784BEB4290, 0xD0D605F7226A5BBE, 0x13188B88BAD882C3, 0x80CC3A5CBAB6D0DC },
+        { 0x3457057796F912FD, 0x353C7747122BAC3E, 0x19AFE95B9FAD0CC8, 0xF4398CB00B315B6E, 0x570F4A850A1C1BD6, 0xA7ACF5534A027BF3, 0x9208A7F04DBC1C5B, 0xB7CAF3D84168E7CB },
+        { 0x96B73FC380CF2ABF, 0x078ACC97D354748D, 0xF7BE1AA7E172AE88, 0x4AA421E56226F386, 0x520A1618BC986407, 0x1D38912202329D2B, 0x10CEB5BCDD43F752, 0x4E0A4B88C8D83ADC },
+        { 0xC86F751325D07547, 0x15399118652C8725, 0x37FC1BD5A9EFF988, 0x6FBFF63AE0A20136, 0xDA6EF7D1E983EC66, 0x44E6B7A75666E745, 0x2DFCC47FD4CB7094, 0x0400478C07BC04FC },
+        { 0x1FB75D41DE6598E7, 0x20A3DD4C53D71BBC, 0x3B0B5E12293CE057, 0x4ADD38F98989F5F7, 0x7CC9BEEA66794CD2, 0xCD9B5EE7BEC63649, 0x22464CEB180B9AA7, 0x5FEAB28127B2D474 },
+        { 0x7F09C543205F0002, 0xFED94FC034159367, 0x43D880D95B61C2B0, 0x9230CC07C96CB9C8, 0x342CDD7459DA425C, 0x32B4197EB933EE08, 0x28FCF27EFFF09B89, 0xA220B1EADD974B70 },
+        { 0xB3A4122829259000, 0x002F99695410243B, 0xFFDC89E0AB42822C, 0x08C94A3A89D895DF, 0x063B74450488A225, 0x1730C89EF2F3DE37, 0xF0C1F0F99550778D, 0x454DB280618EEA7E },
+        { 0xA4123A90279AE8B1, 0x8C188230A016C60C, 0xA36D77D73B89772E, 0x58E28B702E0FEE8B, 0xD1ABFA4E92028F34, 0x1D92D71DF471F4B8, 0xEEDEB23F952C8BDF, 0xA9110A198C3F0AA4 },
+        { 0xBA1A083965D2A7A9, 0x7233A9B59210D680, 0x9868E5DEAA900AF7, 0xFFFE4E1B775F163B, 0xD5B11CC522BC04A3, 0x675D09684778A5D6, 0xF7F6FA6DE487CF75, 0x700153765F780EDF },
+        { 0x083A329B97D0BAF0, 0x23264B5A053A2AE5, 0x043CD21D02A08B4A, 0x706962B35833D46F, 0x8ABDF4B88EE771F3, 0xCB69E30641684DCB, 0x730DAAB85CCD3253, 0x30DC6048D99E65D3 },
+        { 0x655F1AF80FA15186, 0x7345FACE5C4482E2, 0x180C9C070C3CA83B, 0x1B658D13D49F8AC3, 0xAB58549B16A3887F, 0xA73AE60FFEF6FA1D, 0x04115AFF4D29C200, 0x26283A1BCF4CEAC1 },
+        { 0x40BF58F1183B2A12, 0x1187D9A74A52D59A, 0xAB34438B0F6BFFA1, 0xF427B44B819E7D76, 0x9DC6868428366AC7, 0x66173E587002F51D, 0xB299339D9A0B9F50, 0x78461075D04E91F4 },
+        { 0x8EBC655438425902, 0xE381C4F7764373C0, 0xF55A1C9E527A2731, 0x823EC8C368AAB1C6, 0x3D56702357BFBA4C, 0xE719E916B1D2C3CB, 0x05076D29150FB0EF, 0x34913AD9987F7C5D },
+        { 0xF3147A5B6C624209, 0xF515673029F99236, 0xF620BE1322C847ED, 0x4ED126FDE6A16377, 0x669F15CF97F240F4, 0xE3496C8FAFA842AC, 0xC83EAF3DCE2DA5B2, 0xDF6B5B3929B13B69 },
+        { 0xAF9B1793DBF4E0CF, 0xDE4E145D0F853896, 0x26C49F78B4E07403, 0x812102C6F16C0568, 0x2EA7878A5663DF55, 0xBA66060EF6FB8D73, 0xDCE96610CBC8E0E8, 0x488A0069EE3CABA7 },
+        { 0x079B2CC30740B636, 0xC243F006C7EA6992, 0x6A47BC4CEBFFF325, 0x4F279336F7F37AF7, 0x35DA4A7C18178644, 0x63D0E77EBE46D719, 0xCB3E316DA4E2E649, 0xC2FCED014D8D2AB3 },
+    },
+    {   // 2^240·G
+        { 0x568A5ADA3D11FC00, 0xF16449014EB881A4, 0xFDB9A3A516062F82, 0x1EB2CC06C3A45F29, 0x0551F4D6ABB5A6B8, 0x7AC9D46537CA1CC5, 0xB1D327B4A4225F64, 0x2FE98D3CCBF07CF9 },
+        { 0x803717C70BBD66F7, 0x70C7484AD9AFFC20, 0xA72F25C94C6C4E87, 0x3295F1837E9DEF4C, 0x5A15A75E2A6EA548, 0x7A3AB24802462236, 0xA97406A52525FA97, 0x51F79023E3DA2274 },
+        { 0xA5F2BA3335DA361C, 0x76119CCF521CF5DD, 0x4B960103950903B3, 0xCBD165BAEC1B0D7B, 0x3C107EFB3644114F, 0x589B67B3A82455CA, 0x782CD45FE886F2AD, 0x93C3CC70CD80B778 },
+        { 0x09CB112D880868B6, 0x48BF8767193D9BD4, 0x87A9C7AED7FBC606, 0x3B1304A237B1EAB0, 0xA7985C5452F6CE7E, 0x8884978B04F38903, 0x03ABB5ACBCCEBB5A, 0xCC7EF88F290AEB0F },
+        { 0x50D9A918871C494D, 0x0E149CE2FC437479, 0xA4625A1E2E3D7563, 0xE301AA6487651EF8, 0x4720B1DFE57B07CA, 0x834C5274326E8620, 0x8E0DE9C83E63FBF2, 0xB2E87A0A21A791BB },
+        { 0xDED3541BC7013D3B, 0xAE0872A63B62A51A, 0xF40E98EE53F12982, 0xE4763A5315234BE7, 0x90795978778DC380, 0xCFC8E6D0BB335BBF, 0x61C1503ED7C707DA, 0x5E40D98579F2B455 },
+        { 0x75DD51640467743B, 0xD21C9B4BEE046531, 0xAE0C0B45DAEE208A, 0x969723003200F0A4, 0x16C5102BA9441DDB, 0xB90CDFD1B84B4D1B, 0x2FD6229DB9DDC7CE, 0xA2E12C5689773733 },
+        { 0x52452D0A461BB497, 0x5D3522F0B6C0F164, 0xB5C85C8D45E81752, 0x6B1DEADFA5B55505, 0x8EB084732935F50D, 0x8A5AD3E8D147B7BD, 0xE98C512914B8E039, 0x15EAD3915FEB8973 },
+        { 0x18148B5AF51D8282, 0x53310A3E5C09F72C, 0xAA3F5A57EA32DDC9, 0x95D00F2BAB6A7816, 0x1FE0A0371F87B3DE, 0x2C2CFA4E665D2B42, 0xE044BA27F75B9BC6, 0xEB8F8C274F270A2D },
+        { 0x2315E9AA327E8699, 0x536B540938A2A1FF, 0xB0DC0DEB1C90F653, 0x26D7F36D5D7739B1, 0xD48FA67D69407D44, 0x0D3B576DC5EBE830, 0x56C14E24AE356432, 0x367E0D0208FE79CE },
+        { 0x038000FB2107289B, 0x6288E840AE379857, 0x032FC4CBD4EDC911, 0xE93B4E69B409517E, 0x2E1777C356E42E9E, 0xF2ECF6BD76058CF0, 0x7F01F1386B62EC89, 0x5B6E4126B125D292 },
+        { 0x6D2C0C400539A7CF, 0x6F4465BF7BE39F39, 0x4278A5CDF515731C, 0x4B199F4191800018, 0x6D2D3D308A429152, 0x2EC35F1CAF45076D, 0xFAF6C3BCC842CD44, 0xA9C2D67A38EABD3E },
+        { 0xE47AD69DD19F724F, 0x0FF88C2A5C663813, 0x207A142146536943, 0xBF3250861DC875C0, 0xF3DC43DE59F39B40, 0x523C480B8837A567, 0x130BFC1263CC409D, 0xDB7C6ACBF3F704EE },
+        { 0xB741530501BC5C87, 0xD22D02546551D16D, 0x0C359D176E31BDB9, 0xFA42A081FA22C752, 0xD35FC73DA6B4957C, 0x57DF7D193CED18B9, 0xCC05A496AD8CF7A9, 0xDB967409F70D431E },
+        { 0x511CE1B7BBCF810B, 0x32E2E0FD162876B1, 0x6E0F67BD35C807DC, 0x17D9E8B2D0A3FB69, 0xFA493ECE987557D8, 0xA400E8F4C9399ABA, 0x13A19CFC0E3C0E3F, 0xB05368ADD2F05413 },
+        { 0x6E0C69322F03DC3D, 0x664989D53113974F, 0xB7A12DD99A5C1285, 0x9402B517F30EB11A, 0x613CCD93FFFF9A9B, 0x5570CDDFA6E44922, 0x3C09C35AD52FC26D, 0xAAA902239697E3A6 },
+    },
+    {   // 2^245·G
+        { 0x2016A1B23AE3E7B1, 0xEEAB4DE64804ED97, 0x3CBFFF1D346A0BEA, 0xE114FC93514F1A81, 0x674C2170A25A08A3, 0xF3BADC0DA3E54B38, 0xC38B9C44E04AC730, 0x0151B3ACBE897BBB },
+        { 0x50B05D276030DD52, 0x59C83F1B9A572AFA, 0xB798B41F2F62F6C6, 0x886B1F3377BEE660, 0x247A361319FE3CC1, 0x1ED0BFBBA66110E8, 0xB30D1712172942DD, 0x35FF6D0D87F5F362 },
+        { 0x6B91E16E3E2F1E54, 0x36DEF7D01FE5549D, 0xC77BB054FCAC8E88, 0x3B734208F5A74C13, 0xFC9FB0EE355FE37F, 0x1D709883A4EAC78C, 0xBAE05DFDFA33724A, 0xF88EF75C2F849690 },
+        { 0x57638D9C60B719DC, 0xF6689F77F6F83171, 0xB4DF983A0B0BF70F, 0xF59AE1562BA18DAE, 0x963BFCCCCFAFC1CF, 0xDB4D2F74D57B2701, 0xAF4A34F60EF9D5EA, 0x6A65FF0450CBCC47 },
+        { 0x575B154A199887B1, 0x9D172C65A3FF1903, 0x07B7294B15C7FEFE, 0x93F3FACC7D1B03A3, 0x739AD74E9A424733, 0x4E9227259A470C01, 0x2791DEE8F6C07662, 0xDE47CAA8EE895F2E },
+        { 0x5260D2272D7FA4EB, 0x43B230DBEC7C4D27, 0x5A39057FBD4F3E24, 0x472F896468B87F86, 0xEF70280868FB4403, 0x7F90B41831037E33, 0xE986212D22A43381, 0xD3EF5D0CE1A6DD88 },
+        { 0xF96854F5CC7B1FDC, 0x571FB42C7E83203A, 0xC0C5816AE27AA42E, 0x13560C5812A1A299, 0x115D058CB0A14CCE, 0x46F868471843A7B1, 0x205453786CE8682C, 0xCD7825BF2E490C98 },
+        { 0x64F0F6B9FA1A50CE, 0x5B206389AA6D168F, 0x2C8FA967ECADBE89, 0x427695B8AB79072A, 0xFE596B7F739046C5, 0x7A5EFEC89AC90C86, 0x891C952444EAB7E2, 0xF577EA61366C4840 },
+        { 0x1FD36AD8C6DBA8F9, 0x52C92E614C6AED47, 0x438F438E2294F02D, 0x88BE230ADF8C7FDD, 0xF0A7206F4A3948F5, 0x3FEF4D55131C46CA, 0x9A5C23E4A4EFD767, 0x4F26BAEBFB78F2F7 },
+        { 0x76DB6B6CA7F32E97, 0x9B00842B3E743B90, 0x7167A4D45E699270, 0xA02E04ECC22E8900, 0xF61186B43C54E76C, 0xDF5C8FD67D8EA83A, 0x50695514FF228E16, 0x0AB45FAB96D98D81 },
+        { 0x56101B153C7BC20C, 0x8B0EA6FFF24DFC03, 0x1CE7807A17B7253A, 0xB6E9E0CDCE49A45D, 0x8F5F67DBC0A77FFF, 0x2D898CE94E1327DE, 0x824BCD73D9E35A91, 0xCB2385EC3A3F7C61 },
+        { 0xF702FE314FD6C219, 0xFD504C78583BC98B, 0x5BE9EB616ABB608F, 0x9AA76072B38F6A8E, 0x69D4FC92002B8D07, 0x0D2964F989C9FC2F, 0x8B4274B0EB4DB86E, 0x691B791C76974AFA },
+        { 0x4E9C9021B3D0AD5A, 0x71F0509980867821, 0x03828759E8278F3C, 0xF04503061F5B7AB5, 0x351C6EF2583E0027, 0xDEDF447431E7C2B8, 0xD7934464094C0CF3, 0x8777F1B682FA4576 },
+        { 0x8C05DA01EFBD510C, 0x6E1C25A45395256C, 0x48FCA844FD8FBA4E, 0xD018FA72DCA0045A, 0xB74D50F84CA1C0EC, 0x4A41FA5888B3CAB7, 0x5895E369AF408244, 0x35ACCBE166820D92 },
+        { 0x8A25C020B11B259E, 0xA77E3C8F21023FB0, 0x7141BF1B8368B1A7, 0x2F07C9E42FBD060E, 0x77192788F1E7B904, 0x62B8CDB4B0C2ACED, 0xEE312E5817EDFB25, 0x7F0FBFD56405E0D8 },
+        { 0xFB6720984B97E3B5, 0xCCD04CA5D3276ABC, 0x35B21EE8580A79E2, 0x0C7DDCA53BD19AC0, 0x4AB61E1477185F0D, 0xEBFFB1CF4AD9E80F, 0xA2D0319ABFBB900C, 0x1F255483AFA83964 },
+    },
+    {   // 2^250·G
+        { 0x107B4DFAA9E1EBBB, 0xF7EE4D8AC4C3D95F, 0x3672EF04D269AD96, 0xBF822ABFD1EE162C, 0x5AA76CC7B0D35FFA, 0x069AFDBC39A0A204, 0x7E734908F3D1A9AE, 0x10C4DEF6FDB04A51 },
+        { 0xF0EE36539251AA08, 0x8793CE0C732ECA08, 0x1C7D5BA42F94144C, 0x9BF23B4911ED9EE6, 0x8A0AD0B4F553CB88, 0x733229BD5FCB40CE, 0x133B9A981721963F, 0xE33B1E3526647681 },
+        { 0x0E9F85157DED4102, 0x1AC277A70EF62372, 0x10897F3039068712, 0xC5C7C4517DE3A2C5, 0x14EB10E0EDFC5B70, 0xD7B6E5CAE42D74F1, 0x2B51D550B91638E8, 0x2EA372748BDFF08C },
+        { 0x6238FA7472FC15F8, 0x0193FB0658CFE5CD, 0x6903C93374FAB7D2, 0x18D7E2053EC6AFEF, 0xFCD6CB5E5B6C23EE, 0x80659E2041881669, 0x51A1AA99F6D0557A, 0xB937A825EA1C421E },
+        { 0x05FF99EB1E80C2AA, 0x127CEC655C54C936, 0xB2F409127AC3B569, 0x116010D2DBF26F92, 0xDB0188DC239CE264, 0xAB36C117DAE86D0D, 0x88E61D55ECE6046C, 0x80724E50916FA23E },
+        { 0x3379A56371B73E60, 0x127ECE581B4D8B72, 0x200C404016F88733, 0xCBB09D18513FD83B, 0x4DD4E41BF7FF149C, 0xAEF71150B6BB4D3F, 0x803526F19EA4EB9A, 0x86DA6C0F9A5837A0 },
+        { 0xDBA3BE7723E54176, 0x2D950165B245C062, 0x9F6362D8E215CC04, 0x5BFF2CB0A2BB93C9, 0x173545D3287366C9, 0x9031A75685128EE2, 0x3C090269906B7B2F, 0x856E74E3A3AE3C44 },
+        { 0xDBFE19CACB4267AB, 0xE5CCB6EA49751ABC, 0xB89454F51281F80B, 0x5DC8F49B0CCE3A94, 0xC82ABC9A6FB024C3, 0x9419E2710009DE15, 0x7C2A3546C1C45A28, 0x69ABD0296368AE15 },
+        { 0x3682D43D9E6ACBEE, 0x942770AAE0DDC133, 0x26FC12A3E06FDA22, 0x241EE9A530D815C1, 0x76948E593C5F673A, 0x6E01659071D81D9C, 0xA27BC40353043E00, 0x13382352D181F82F },
+        { 0x5A1C652AFCB897E2, 0x5D8CE4E0FB478381, 0x306F2724CB358CDE, 0xB9618E69B272DF95, 0xC50F972362C0B896, 0xBE24C6AB4428C6C3, 0xAEFA08B4981DF8B0, 0x7AA7948F968ED4A3 },
+        { 0x6633C665EE69894A, 0xBF5EF6A780924AAC, 0x96EC0ED946877A18, 0x8E3761DB8C422725, 0x48C655F96542B2A5, 0x8892187473D2C244, 0x75A6EE7A77450D5B, 0x5526059C2E25AF00 },
+        { 0x557B28A2D6527810, 0x42E96860B7D12B9E, 0x0315898DE306506D, 0xEC2506492DBE3307, 0xB01A66AC8046A09F, 0x9FA552E01B6DA177, 0x0859D132693B1A39, 0x4EE835C331EECB61 },
+        { 0xA60C20E070AC0C7E, 0xFE0B5D813A87BC03, 0xB317D5ADA1293804, 0xD247F1BB7A6BD79E, 0x35D4D7627D2845B9, 0x18194ABC3F8E889F, 0x8A4FC7259A38EA72, 0xAB9C0963D0F279C6 },
+        { 0xEDDC179E981E7F43, 0xD04AECE1CAF65C0A, 0xA6C52D7D54F66F36, 0x14EDB8B3C3CA38E1, 0x84ADC30C6D57261B, 0x3E078E1BBBD18DC3, 0x05C807755E414FF6, 0x69EE344B7614302C },
+        { 0x7963708CF2D50DC3, 0x269C2C9CDA4C3442, 0x6DC0A13CD28478E9, 0xB9A999DB6710D907, 0x965D39DDD6A6862F, 0x990CAC6E42F9BCD7, 0xC2B604DC4AA811C7, 0x4DADD75970BCC69D },
+        { 0x515834BA4AAAAF6D, 0x0445886EC969CD2D, 0x7BCB1AD709E49082, 0x3DDDEC714DA63EEF, 0xCD73E4B630EB18AD, 0x0692FFD2899E3912, 0xC034C7D5730F633A, 0xF985AD589D81FFBF },
+    },
+    {   // 2^255·G
+        { 0x48BB387A1529DB42, 0xA3FA4BFBDAEDA1EB, 0x881158CFE779F44A, 0xDCB53EB5B07C0513, 0x63D0ACA20746E1AA, 0x083D8D22BC547380, 0xF0AB2AD4E5FD9181, 0x571ADB13E629A820 },
+        { 0xE6B9CC62B3F553B8, 0x6A42476F6EADE6D7, 0xA5914C834D25D163, 0x8F955EEAC1CBA34C, 0x46558E34BCC5FD14, 0x477A823581DF2730, 0x6A7482CDC9D16727, 0xA08ACE1DAC26E218 },
+        { 0x16D092FE7C815527, 0x1429019C2131B23C, 0xBCF1C2B9B740A280, 0x04BACE4E6C9FAD89, 0xBCE06166B5CDC481, 0xE53E1E7579E990D1, 0x5A6F5FB386DBB1C9, 0x84FE43DA709E4F99 },
+        { 0xEBD8C2EF958FCECC, 0xAFE20C35EAC4D763, 0xC4C01A0047675473, 0xC3A91CAAAF52AB23, 0xEA9464758B43E679, 0xB548D6F95044A6F2, 0x5440C16A603FF005, 0xBF32AF168D27824B },
+        { 0x85DED59AD7675D45, 0x0F7D00CB86A1696C, 0x92CBBB045AF6DD14, 0x70A7831E777319F8, 0x2C34726AE6BEE1FE, 0x3D0AA753B095E8F0, 0x0AF7CF97F662B493, 0x6590DEEF514E4247 },
+        { 0xB63A787B48AAD04D, 0x6BAA29345BBCC861, 0x26DAD08B73E059DB, 0xCCA9FE7A8516F2DE, 0x7F803195B79D1B91, 0x197D84D2E9003331, 0xC68D1A9F0339604F, 0x459B1396A35F0ECB },
+        { 0xAA273FADCE266A9C, 0xEE7E20995ACD017E, 0xAF8563C4FD6FBE1C, 0x67E82BD02DA47E1C, 0xC35F360EFAC19D4C, 0x9E9C6BCBEEF63611, 0x1A6B32CD1C103A1E, 0xC2D212106ECB4FCA },
+        { 0xBC1CEC4761BC0337, 0x46081BA7FF5138C5, 0xF830006FBAA7B64B, 0xDA901C1FA33DAAA2, 0xED217E4A3C189805, 0x44D0E6E91F2E25EB, 0x412F7F470E817423, 0x449553133FCEBDAB },
+        { 0x10BAF2807B6330D3, 0x11816E80F026475A, 0xE5D10D548E0B05AC, 0x5567CB58084E5E42, 0xE904D5547E23F03E, 0x3FBF830B9603E09E, 0xD00D6C350ED9EDA0, 0xA7891247B9B5B282 },
+        { 0x11F6B05607C6D2CD, 0x8861089C50A3091E, 0xBCD95416B5D2542D, 0x1B9140AB0A973FDE, 0x2405F5A1901C29C8, 0x4E39C7421FF1E197, 0x2ED50CD9837D82B2, 0x31CE515A6AC24C7E },
+        { 0x88B1EE8B5305661C, 0x214E951D3A4940D7, 0x50FB3D75BF20550B, 0x3469C94234265E31, 0xCF29A804945328CD, 0x692554186C7F7AEA, 0x4D1148F13E847A1F, 0xBD16C5E9DA0CEB9D },
+        { 0xFF9F68BCCD1B2A4E, 0x9735AE4E70F80474, 0x2878E66C5DC65A78, 0x67957A0F9CF7FB9C, 0x8A157DA0C7AEAAEF, 0x4F1E8B960AD74737, 0xEB5113B1B36605F6, 0x710CD0CD465B8CDD },
+        { 0x0840F170DDCDD668, 0x45B8903B2018EBCC, 0xBF6C3FED81D22AD5, 0x2872C21385BF1562, 0x50B1AE352F0BC7B2, 0x6A5D4772373A325E, 0xAE612312640AE111, 0x382DD190C90B0C61 },
+        { 0x5F59412E21028907, 0xA2A86B5437E47C53, 0xDF536AE2F9A73A61, 0x75832D5F2B580CD8, 0x5372CEED04E9CD58, 0x2E6CD3F9D94EE1DE, 0x583FB6EE3DACC2C2, 0xD9CF1F7EFB765704 },
+        { 0x4C273D644FB23C8C, 0xF6DEC09371EC9649, 0x657C7D8001DFF909, 0xDD424DA7C578A666, 0x177A0EA0B5D34B52, 0x55A2DEC3F0E0801C, 0xDD56D0A9CEDE2C0B, 0xB7CA4AA0F87FFB91 },
+        { 0xF1F8CB5EFA6BA6E1, 0xFF0902048891FF67, 0x337C35E2F79E33E3, 0x8F0AA81CDF7F60BB, 0xF87EE9F6A11F8C6F, 0x7DAC5D8DE13D731D, 0x3B2ED45966A1BBCB, 0x4238ACD6D5467075 },
+    },
+};
+
+#endif